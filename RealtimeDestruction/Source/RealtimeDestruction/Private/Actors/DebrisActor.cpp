@@ -9,18 +9,33 @@
 
 #include "Actors/DebrisActor.h"
 #include "Components/RealtimeDestructibleMeshComponent.h"
-#include "Components/BoxComponent.h"
+#include "Subsystems/DebrisManagerSubsystem.h"
+#include "Settings/RDMSetting.h"
+#include "Components/DebrisCollisionComponent.h"
 #include "ProceduralMeshComponent.h"
 #include "Net/UnrealNetwork.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
 #include "DrawDebugHelpers.h" 
+#include "PhysicsEngine/BoxElem.h"
 
 #include "BoxTypes.h"
 #include "IndexTypes.h"
 #include "DynamicMesh/DynamicMesh3.h"
 #include "DynamicMesh/DynamicMeshAttributeSet.h"
 
+namespace
+{
+	/** Rest check interval (s) */
+	constexpr float DebrisSettleCheckInterval = 0.25f;
+
+	/** How long a client waits for a settled debris mesh to be built before leaving the piece unbaked (s) */
+	constexpr float DebrisSettledMeshWaitTime = 10.0f;
+
+	/** Server: a settled actor lives at least this long so clients can receive bSettled and bake (s) */
+	constexpr float DebrisSettledMinLifetime = DebrisSettledMeshWaitTime + 2.0f;
+}
+
 ADebrisActor::ADebrisActor()
 {
 	PrimaryActorTick.bCanEverTick = false;
@@ -29,8 +44,8 @@ ADebrisActor::ADebrisActor()
 	bReplicates = true;
 	SetReplicateMovement(true); // Transform 자동 동기화
 
-	// BoxComponent가 Root - 물리 시뮬레이션 담당
-	CollisionBox = CreateDefaultSubobject<UBoxComponent>(TEXT("CollisionBox"));
+	// DebrisCollisionComponent(박스)가 Root - 물리 시뮬레이션 담당
+	CollisionBox = CreateDefaultSubobject<UDebrisCollisionComponent>(TEXT("CollisionBox"));
 	RootComponent = CollisionBox;
 
 	CollisionBox->SetBoxExtent(FVector(1.0f, 1.0f, 1.0f)); // 기본 크기
@@ -54,7 +69,22 @@ ADebrisActor::ADebrisActor()
 	SourceMeshOwner = nullptr;
 	DebrisMaterial = nullptr;
 	DebrisLifetime = 10.0f;
+	bConsolidateWhenSettled = true;
+	SettleLinearSpeed = 5.0f;
+	SettleAngularSpeed = 10.0f;
+	SettleTime = 1.0f;
+	bAllowSecondaryDestruction = true;
+	MinSecondaryDebrisCells = 2;
+	bCellMeshOnly = false;
+	DetachEventId = INDEX_NONE;
+	DetachEventSize = 0;
+	bSettled = false;
+	CellToLocalScale = 1.0f;
+	CellToLocalOffset = FVector::ZeroVector;
 	bMeshReady = false;
+	SettledTime = 0.0f;
+	bConsolidated = false;
+	bLocallyCulled = false;
 }
 
 void ADebrisActor::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -66,11 +96,17 @@ void ADebrisActor::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLife
 	DOREPLIFETIME_CONDITION(ADebrisActor, SourceMeshOwner, COND_InitialOnly);
 	DOREPLIFETIME_CONDITION(ADebrisActor, SourceChunkIndex, COND_InitialOnly);
 	DOREPLIFETIME_CONDITION(ADebrisActor, DebrisMaterial, COND_InitialOnly);
+	DOREPLIFETIME_CONDITION(ADebrisActor, bCellMeshOnly, COND_InitialOnly);
+	DOREPLIFETIME_CONDITION(ADebrisActor, DetachEventId, COND_InitialOnly);
+	DOREPLIFETIME_CONDITION(ADebrisActor, DetachEventSize, COND_InitialOnly);
 
 	// 비트맵 압축 데이터 (CellIds 대신)
 	DOREPLIFETIME_CONDITION(ADebrisActor, CellBoundsMin, COND_InitialOnly);
 	DOREPLIFETIME_CONDITION(ADebrisActor, CellBoundsMax, COND_InitialOnly);
 	DOREPLIFETIME_CONDITION(ADebrisActor, CellBitmap, COND_InitialOnly);
+
+	// 정지 상태 (Dormant 전 마지막 갱신 + 늦게 받는 클라이언트의 초기 상태)
+	DOREPLIFETIME(ADebrisActor, bSettled);
 }
 
 void ADebrisActor::OnRep_DebrisParams()
@@ -101,7 +137,16 @@ void ADebrisActor::OnRep_DebrisParams()
 
 		bMeshReady = true;
 	}
-	// 2. 비트맵이 있으면 → CellIds 디코딩 → 메시 생성 (데디서버 클라이언트)
+	// 2. 2차 파편: 원본 메시에 해당 형상이 없으므로 셀에서 바로 생성
+	else if (bCellMeshOnly && CellBitmap.Num() > 0)
+	{
+		if (URealtimeDestructibleMeshComponent* SourceMesh = GetSourceMeshComponent())
+		{
+			DecodeBitmapToCells(SourceMesh->GetGridCellLayout());
+			GenerateMeshFromCells();
+		}
+	}
+	// 3. 비트맵이 있으면 → CellIds 디코딩 → 메시 생성 (데디서버 클라이언트)
 	else if (CellBitmap.Num() > 0)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[DebrisActor] Decoding bitmap and generating mesh - DebrisId=%d, BitmapBytes=%d"),
@@ -121,10 +166,10 @@ void ADebrisActor::OnRep_DebrisParams()
 
 				if (bUseBooleanExtraction)
 				{
-					// RemoveTrianglesForDetachedCells에 TargetDebrisActor를 전달하여
-					// Subtract + Intersection 모두 수행 (Standalone과 동일)
-					UE_LOG(LogTemp, Warning, TEXT("[DebrisActor] Using RemoveTrianglesForDetachedCells for mesh extraction (Standalone quality)"));
-					SourceMesh->RemoveTrianglesForDetachedCells(CellIds, this);
+					// 같은 분리 이벤트의 Debris를 모아 한 번에 Subtract + Intersection 수행 (Standalone과 동일 품질)
+					UE_LOG(LogTemp, Warning, TEXT("[DebrisActor] Queueing batched extraction - DetachEventId=%d, EventSize=%d"),
+						DetachEventId, DetachEventSize);
+					SourceMesh->QueueClientDebrisExtraction(this);
 				}
 				else
 				{
@@ -143,7 +188,7 @@ void ADebrisActor::OnRep_DebrisParams()
 			UE_LOG(LogTemp, Error, TEXT("[DebrisActor] SourceMeshComponent is null! Cannot decode bitmap - DebrisId=%d"), DebrisId);
 		}
 	}
-	// 3. 둘 다 없으면 대기열에 등록
+	// 4. 둘 다 없으면 대기열에 등록
 	else
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[DebrisActor] No local mesh or bitmap, registering as pending - DebrisId=%d"), DebrisId);
@@ -175,6 +220,194 @@ void ADebrisActor::OnLifetimeExpired()
 	Destroy();
 }
 
+void ADebrisActor::OnSettleCheck()
+{
+	// 물리 시작 전(ApplyDebrisPhysics 이전)에는 대기
+	if (!CollisionBox || !CollisionBox->IsSimulatingPhysics())
+	{
+		SettledTime = 0.0f;
+		return;
+	}
+
+	// Sleep 상태이거나 속도가 임계값 이하면 정지로 판단
+	const bool bAtRest = !CollisionBox->RigidBodyIsAwake()
+		|| (CollisionBox->GetPhysicsLinearVelocity().SizeSquared() <= FMath::Square(SettleLinearSpeed)
+			&& CollisionBox->GetPhysicsAngularVelocityInDegrees().SizeSquared() <= FMath::Square(SettleAngularSpeed));
+
+	SettledTime = bAtRest ? SettledTime + DebrisSettleCheckInterval : 0.0f;
+
+	if (SettledTime >= SettleTime)
+	{
+		Settle();
+	}
+}
+
+void ADebrisActor::Settle()
+{
+	// 정지 감지 타이머만 정리 - 수명 타이머는 유지 (굽지 못한 조각/잠든 서버 Actor도 결국 제거)
+	GetWorldTimerManager().ClearTimer(SettleTimerHandle);
+
+	CollisionBox->SetSimulatePhysics(false);
+	CollisionBox->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	bSettled = true;
+
+	// 리슨 서버/Standalone은 자기 메시를 직접 굽는다 (데디서버는 메시 없음)
+	const bool bBaked = ConsolidateIntoRubble();
+
+	UDebrisManagerSubsystem* DebrisManager = GetWorld()->GetSubsystem<UDebrisManagerSubsystem>();
+
+	if (GetNetMode() == NM_Standalone)
+	{
+		if (bBaked)
+		{
+			if (DebrisManager)
+			{
+				DebrisManager->UnregisterDebris(this);
+			}
+			Destroy();
+		}
+		// Rubble이 받지 않으면(비활성/영역 가득) 조각은 남지만 예산 등록과 수명 타이머는 유지
+		return;
+	}
+
+	if (DebrisManager)
+	{
+		DebrisManager->UnregisterDebris(this);
+	}
+
+	// Dormant 전환: bSettled와 최종 위치를 한 번 보낸 뒤 복제 비용이 사라짐
+	// 늦게 접속하거나 나중에 relevant해진 클라이언트도 초기 상태로 받아 각자 굽는다
+	ForceNetUpdate();
+	SetNetDormancy(DORM_DormantAll);
+
+	// 잠든 Actor가 무한히 쌓이지 않도록 수명으로 제거 - 단, 클라이언트가 메시를 기다려 굽는 시간은 보장
+	// (제거돼도 클라이언트가 이미 구운 Rubble은 남음)
+	FTimerManager& TimerManager = GetWorldTimerManager();
+	const float RemainingLifetime = TimerManager.IsTimerActive(LifetimeTimerHandle)
+		? TimerManager.GetTimerRemaining(LifetimeTimerHandle)
+		: 0.0f;
+	TimerManager.SetTimer(
+		LifetimeTimerHandle,
+		this,
+		&ADebrisActor::OnLifetimeExpired,
+		FMath::Max(RemainingLifetime, DebrisSettledMinLifetime),
+		false);
+}
+
+void ADebrisActor::ForceSettle()
+{
+	if (!HasAuthority() || bSettled)
+	{
+		return;
+	}
+
+	Settle();
+}
+
+void ADebrisActor::CullLocally(bool bBakeIntoRubble)
+{
+	if (HasAuthority() || bLocallyCulled)
+	{
+		return;
+	}
+	bLocallyCulled = true;
+
+	GetWorldTimerManager().ClearTimer(SettleTimerHandle);
+
+	if (CollisionBox)
+	{
+		CollisionBox->SetSimulatePhysics(false);
+		CollisionBox->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	}
+
+	// 복제 Actor는 클라이언트에서 파괴할 수 없으므로 굽거나 숨기기만 함 (서버 상태는 그대로)
+	if (!bBakeIntoRubble || !ConsolidateIntoRubble())
+	{
+		if (DebrisMesh)
+		{
+			DebrisMesh->SetVisibility(false);
+		}
+	}
+}
+
+void ADebrisActor::OnRep_Settled()
+{
+	// 로컬 예산으로 이미 정리된 조각은 다시 굽지 않음
+	if (!bSettled || bLocallyCulled)
+	{
+		return;
+	}
+
+	if (UDebrisManagerSubsystem* DebrisManager = GetWorld()->GetSubsystem<UDebrisManagerSubsystem>())
+	{
+		DebrisManager->UnregisterDebris(this);
+	}
+
+	if (CollisionBox)
+	{
+		CollisionBox->SetSimulatePhysics(false);
+		CollisionBox->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	}
+
+	// 물리 보간 중이던 위치를 서버의 최종 위치로 맞춘 뒤 굽는다
+	const FRepMovement& FinalMovement = GetReplicatedMovement();
+	SetActorLocationAndRotation(FinalMovement.Location, FinalMovement.Rotation, false, nullptr, ETeleportType::TeleportPhysics);
+
+	SettledTime = 0.0f;
+	TryConsolidateSettled();
+}
+
+void ADebrisActor::TryConsolidateSettled()
+{
+	// 메시가 아직 없으면 (Late Join 직후 추출 대기 등) 잠시 후 재시도
+	const bool bHasMesh = DebrisMesh && DebrisMesh->GetNumSections() > 0;
+	if (!bConsolidated && !bHasMesh && SettledTime < DebrisSettledMeshWaitTime)
+	{
+		SettledTime += DebrisSettleCheckInterval;
+		if (!GetWorldTimerManager().IsTimerActive(SettleTimerHandle))
+		{
+			GetWorldTimerManager().SetTimer(
+				SettleTimerHandle,
+				this,
+				&ADebrisActor::TryConsolidateSettled,
+				DebrisSettleCheckInterval,
+				true);
+		}
+		return;
+	}
+
+	GetWorldTimerManager().ClearTimer(SettleTimerHandle);
+
+	// 복제 Actor는 클라이언트에서 파괴할 수 없으므로 굽고 나면 숨긴 채로 잠든 상태 유지
+	// Rubble이 받지 않으면 멈춘 조각이 그대로 보임
+	ConsolidateIntoRubble();
+}
+
+bool ADebrisActor::ConsolidateIntoRubble()
+{
+	if (bConsolidated)
+	{
+		return true;
+	}
+
+	// 클라이언트 Boolean 추출 경로는 bMeshReady를 세우지 않으므로 섹션 유무로 판단
+	if (!DebrisMesh || DebrisMesh->GetNumSections() == 0)
+	{
+		return false;
+	}
+
+	UDebrisManagerSubsystem* DebrisManager = GetWorld() ? GetWorld()->GetSubsystem<UDebrisManagerSubsystem>() : nullptr;
+	if (!DebrisManager || !DebrisManager->ConsolidateDebris(DebrisMesh))
+	{
+		return false;
+	}
+
+	// 병합은 다음 Flush에서 일어나지만 데이터는 이미 복사됨
+	bConsolidated = true;
+	DebrisMesh->SetVisibility(false);
+	return true;
+}
+
 void ADebrisActor::BeginPlay()
 {
 	Super::BeginPlay();
@@ -182,14 +415,35 @@ void ADebrisActor::BeginPlay()
 	// 수명 타이머 (서버에서만)
 	if (HasAuthority() && DebrisLifetime > 0.0f)
 	{
-		FTimerHandle TimerHandle;
 		GetWorld()->GetTimerManager().SetTimer(
-			TimerHandle,
+			LifetimeTimerHandle,
 			this,
 			&ADebrisActor::OnLifetimeExpired,
 			DebrisLifetime,
 			false);
 	}
+
+	// 전역 Debris 예산에 등록 (모든 넷모드)
+	// 서버는 제거/Settle을 복제로 전파하고, 클라이언트는 자기 렌더링 비용만큼 로컬에서 숨기거나 굽는다
+	if (UDebrisManagerSubsystem* DebrisManager = GetWorld()->GetSubsystem<UDebrisManagerSubsystem>())
+	{
+		DebrisManager->RegisterDebris(this, CollisionBox, DebrisMesh);
+	}
+
+	// 정지 감지 타이머 (서버에서만, 정지 후 bSettled 복제로 클라이언트에 전파)
+	if (HasAuthority() && bConsolidateWhenSettled)
+	{
+		const URDMSetting* Settings = URDMSetting::Get();
+		if (Settings && Settings->bConsolidateSettledDebris)
+		{
+			GetWorldTimerManager().SetTimer(
+				SettleTimerHandle,
+				this,
+				&ADebrisActor::OnSettleCheck,
+				DebrisSettleCheckInterval,
+				true);
+		}
+	}
 }
 
 // 서버 전용 Methods 
@@ -391,6 +645,189 @@ void ADebrisActor::InitializeDebris(int32 InDebrisId, const TArray<int32>& InCel
 	}
 }
 
+void ADebrisActor::SetDetachEvent(int32 InEventId, int32 InEventSize)
+{
+	if (!HasAuthority())
+	{
+		return;
+	}
+
+	DetachEventId = InEventId;
+	DetachEventSize = InEventSize;
+}
+
+void ADebrisActor::SetCellFrame(const TArray<int32>& InCellIds, float InCellScale, const FVector& InCellOffset)
+{
+	if (!HasAuthority())
+	{
+		return;
+	}
+
+	CellIds = InCellIds;
+	CellToLocalScale = InCellScale;
+	CellToLocalOffset = InCellOffset;
+}
+
+void ADebrisActor::BuildCellMesh()
+{
+	if (!HasAuthority())
+	{
+		return;
+	}
+
+	bCellMeshOnly = true;
+
+	// 데디서버는 메시 불필요
+	if (GetNetMode() != NM_DedicatedServer)
+	{
+		GenerateMeshFromCells();
+	}
+}
+
+bool ADebrisActor::ApplyDestruction(const FVector& WorldCenter, float WorldRadius)
+{
+	FCellDestructionShape WorldShape;
+	WorldShape.Type = ECellDestructionShapeType::Sphere;
+	WorldShape.Center = WorldCenter;
+	WorldShape.Radius = WorldRadius;
+	return ApplyDestructionShape(WorldShape);
+}
+
+bool ADebrisActor::ApplyDestructionShape(const FCellDestructionShape& WorldShape)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(Debris_ApplyDestruction);
+
+	const float ShapeRadius = (WorldShape.Type == ECellDestructionShapeType::Line) ? WorldShape.LineThickness : WorldShape.Radius;
+	if (!HasAuthority() || !bAllowSecondaryDestruction || bConsolidated || IsActorBeingDestroyed()
+		|| CellIds.Num() == 0 || ShapeRadius <= 0.0f)
+	{
+		return false;
+	}
+
+	URealtimeDestructibleMeshComponent* SourceMesh = GetSourceMeshComponent();
+	if (!SourceMesh)
+	{
+		return false;
+	}
+
+	const FGridCellLayout& GridLayout = SourceMesh->GetGridCellLayout();
+	if (!GridLayout.IsValid())
+	{
+		return false;
+	}
+
+	// 월드 → 셀 로컬 (원본 컴포넌트 스페이스)
+	const FTransform CellToWorld = FTransform(FQuat::Identity, CellToLocalOffset, FVector(CellToLocalScale)) * GetActorTransform();
+	const FVector CellCenter = CellToWorld.InverseTransformPosition(WorldShape.Center);
+	const FVector CellEndPoint = CellToWorld.InverseTransformPosition(WorldShape.EndPoint);
+	const double CellRadius = ShapeRadius / FMath::Max(CellToWorld.GetScale3D().GetAbsMax(), UE_KINDA_SMALL_NUMBER);
+	const double CellRadiusSq = FMath::Square(CellRadius);
+
+	// 1. 툴 형상과 겹치는 셀 제거 (원본 메시의 셀 판정과 같은 형상: 구 / 원기둥은 두께 있는 선분)
+	auto OverlapsCell = [&](int32 CellId) -> bool
+	{
+		const FVector CellMin = GridLayout.IdToLocalMin(CellId);
+		const FBox CellBox(CellMin, CellMin + GridLayout.CellSize);
+		switch (WorldShape.Type)
+		{
+		case ECellDestructionShapeType::Sphere:
+			return FMath::SphereAABBIntersection(CellCenter, CellRadiusSq, CellBox);
+
+		case ECellDestructionShapeType::Line:
+			{
+				// 셀 중심에 가장 가까운 선분 위 점에서 셀 박스까지의 거리
+				const FVector ClosestOnLine = FMath::ClosestPointOnSegment(CellBox.GetCenter(), CellCenter, CellEndPoint);
+				return CellBox.ComputeSquaredDistanceToPoint(ClosestOnLine) <= CellRadiusSq;
+			}
+
+		default:
+			return WorldShape.ContainsPoint(CellToWorld.TransformPosition(GridLayout.IdToLocalCenter(CellId)));
+		}
+	};
+
+	TArray<int32> RemainingCells;
+	RemainingCells.Reserve(CellIds.Num());
+	for (int32 CellId : CellIds)
+	{
+		if (!OverlapsCell(CellId))
+		{
+			RemainingCells.Add(CellId);
+		}
+	}
+
+	const int32 NumRemoved = CellIds.Num() - RemainingCells.Num();
+	if (NumRemoved == 0)
+	{
+		return false;
+	}
+
+	// 2. 남은 셀을 6방향 연결 조각으로 분리
+	static const FIntVector NeighborOffsets[6] = {
+		FIntVector(1, 0, 0), FIntVector(-1, 0, 0),
+		FIntVector(0, 1, 0), FIntVector(0, -1, 0),
+		FIntVector(0, 0, 1), FIntVector(0, 0, -1)
+	};
+
+	TSet<int32> Unvisited(RemainingCells);
+	TArray<TArray<int32>> Pieces;
+	TArray<int32> Stack;
+	for (int32 SeedId : RemainingCells)
+	{
+		if (Unvisited.Remove(SeedId) == 0)
+		{
+			continue;
+		}
+
+		TArray<int32>& Piece = Pieces.AddDefaulted_GetRef();
+		Stack.Reset();
+		Stack.Add(SeedId);
+		while (Stack.Num() > 0)
+		{
+			const int32 CellId = Stack.Pop(EAllowShrinking::No);
+			Piece.Add(CellId);
+
+			const FIntVector Coord = GridLayout.IdToCoord(CellId);
+			for (const FIntVector& Offset : NeighborOffsets)
+			{
+				const FIntVector NeighborCoord = Coord + Offset;
+				if (GridLayout.IsValidCoord(NeighborCoord))
+				{
+					const int32 NeighborId = GridLayout.CoordToId(NeighborCoord);
+					if (Unvisited.Remove(NeighborId) > 0)
+					{
+						Stack.Add(NeighborId);
+					}
+				}
+			}
+		}
+	}
+
+	// 3. 충분히 큰 조각만 새 Debris로 (부모 속도 유지), 나머지는 소멸
+	const FVector LinearVelocity = CollisionBox ? CollisionBox->GetPhysicsLinearVelocity() : FVector::ZeroVector;
+	const FVector AngularVelocity = CollisionBox ? CollisionBox->GetPhysicsAngularVelocityInDegrees() : FVector::ZeroVector;
+
+	int32 NumSpawned = 0;
+	for (const TArray<int32>& Piece : Pieces)
+	{
+		if (Piece.Num() >= MinSecondaryDebrisCells)
+		{
+			SourceMesh->SpawnSecondaryDebris(Piece, CellToWorld, LinearVelocity, AngularVelocity);
+			++NumSpawned;
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[DebrisActor] ApplyDestruction: DebrisId=%d, Removed=%d/%d cells, Pieces=%d, Spawned=%d"),
+		DebrisId, NumRemoved, CellIds.Num(), Pieces.Num(), NumSpawned);
+
+	if (UDebrisManagerSubsystem* DebrisManager = GetWorld()->GetSubsystem<UDebrisManagerSubsystem>())
+	{
+		DebrisManager->UnregisterDebris(this);
+	}
+
+	Destroy();
+	return true;
+}
+
 void ADebrisActor::SetCollisionBoxExtent(const FVector& Extent)
 {
 	if (CollisionBox)
@@ -399,6 +836,18 @@ void ADebrisActor::SetCollisionBoxExtent(const FVector& Extent)
 	}
 }
 
+void ADebrisActor::SetCompoundCollision(const TArray<FKBoxElem>& Boxes)
+{
+	if (!HasAuthority() || !CollisionBox || Boxes.Num() == 0)
+	{
+		return;
+	}
+
+	// 바디 셋업은 CollisionBox가 소유 - 물리 상태를 재생성해도 compound가 유지됨
+	// 콜리전 채널/질량 설정은 BodyInstance 설정을 그대로 사용
+	CollisionBox->SetCompoundBoxes(Boxes);
+}
+
 void ADebrisActor::EnablePhysics()
 {
 	if (!CollisionBox)
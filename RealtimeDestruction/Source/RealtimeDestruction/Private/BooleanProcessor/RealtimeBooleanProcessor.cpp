@@ -29,6 +29,8 @@
 #include "Actors/DebrisActor.h"
 #include "Operations/MeshClusterSimplifier.h"
 #include "Debug/DebugConsoleVariables.h"
+#include "Debug/DestructionDebugger.h"
+#include "Misc/ScopeExit.h"
 
 TRACE_DECLARE_INT_COUNTER(Counter_ThreadCount, TEXT("RealtimeDestruction/ThreadCount"));
 TRACE_DECLARE_INT_COUNTER(Counter_UnionThreadCount, TEXT("RealtimeDestruction/UnionThreadCount"));
@@ -88,6 +90,9 @@ bool FRealtimeBooleanProcessor::Initialize(URealtimeDestructibleMeshComponent* O
 		}
 
 		ChunkNextBatchIDs.SetNumZeroed(ChunkNum); 
+
+		ChunkPendingOps.SetNum(ChunkNum);
+		DirtyPendingChunks.Reserve(ChunkNum);
 	}
 
 	LifeTime = MakeShared<FProcessorLifeTime, ESPMode::ThreadSafe>();
@@ -110,6 +115,12 @@ void FRealtimeBooleanProcessor::Shutdown()
 
 	if (OwnerComponent.IsValid())
 	{
+		// Drop our backlog report so the scaler stops counting ops that no longer exist.
+		if (URDMThreadManagerSubsystem* ThreadManager = GetThreadManager())
+		{
+			ThreadManager->ReportPendingOps(OwnerComponent.Get(), 0);
+		}
+		LastReportedPendingOps = 0;
 		OwnerComponent.Reset();
 	}
 
@@ -140,6 +151,13 @@ void FRealtimeBooleanProcessor::Shutdown()
 
 	ChunkStates.Shutdown();
 
+	BulkChunkBatches.Empty();
+	BulkDirtyChunks.Empty();
+
+	ChunkPendingOps.Empty();
+	DirtyPendingChunks.Empty();
+	BatchPool.Empty();
+
 	ShutdownSlots();
 }
 
@@ -166,18 +184,50 @@ void FRealtimeBooleanProcessor::EnqueueOp(FRealtimeDestructionOp&& Operation, UD
 	Op.ChunkIndex = Operation.Request.ChunkIndex;
 	Op.BatchId = BatchId;
 	Op.TargetMesh = ChunkMesh;
-	FTransform ComponentToWorld = Op.TargetMesh->GetComponentTransform();
+	Op.ToolTransform = MakeLocalToolTransform(Op.TargetMesh->GetComponentTransform(), Operation.Request.ToolShape,
+		Operation.Request.ToolOriginWorld, Operation.Request.ToolForwardVector);
+
+	Op.bIsPenetration = Operation.bIsPenetration;
+	Op.TemporaryDecal = TemporaryDecal;
+	Op.ToolMeshPtr = Operation.Request.ToolMeshPtr;
+
+	if (FRDMCVarHelper::EnableAsyncBooleanOp())
+	{
+	UE_LOG(LogTemp, Warning, TEXT("High Queue Size: %d"), DebugHighQueueCount);
+	UE_LOG(LogTemp, Warning, TEXT("Normal Queue Size: %d"), DebugNormalQueueCount);
+
+	if (Op.bIsPenetration)
+	{
+		HighPriorityQueue.Enqueue(MoveTemp(Op));
+		DebugHighQueueCount++;
+		UE_LOG(LogTemp, Warning, TEXT("[Enqueue] ✅ High Priority Queue Size: %d"), DebugHighQueueCount);
+	}
+	else
+	{
+		NormalPriorityQueue.Enqueue(MoveTemp(Op));
+		DebugNormalQueueCount++;
+		UE_LOG(LogTemp, Warning, TEXT("[Enqueue] ✅ Normal Priority Queue Size: %d"), DebugNormalQueueCount);
+	}	
+	}
+	else
+	{
+		BooleanOpSync(MoveTemp(Op));
+	}
+}
 
-	const FVector LocalImpact = ComponentToWorld.InverseTransformPosition(Operation.Request.ToolOriginWorld);
+FTransform FRealtimeBooleanProcessor::MakeLocalToolTransform(const FTransform& ComponentToWorld, EDestructionToolShape ToolShape,
+	const FVector& ToolOriginWorld, const FVector& ToolForwardWorld)
+{
+	const FVector LocalImpact = ComponentToWorld.InverseTransformPosition(ToolOriginWorld);
 
 	// Scale correction: compute axis scales in the rotated frame.
 	const FVector ComponentScale = ComponentToWorld.GetScale3D();
 
-	switch (Operation.Request.ToolShape)
+	switch (ToolShape)
 	{
 	case EDestructionToolShape::Cylinder:
 	{
-		const FVector LocalNormal = ComponentToWorld.InverseTransformVector(Operation.Request.ToolForwardVector).GetSafeNormal();
+		const FVector LocalNormal = ComponentToWorld.InverseTransformVector(ToolForwardWorld).GetSafeNormal();
 		FQuat ToolRotation = FRotationMatrix::MakeFromZ(LocalNormal).ToQuat(); // Cylinders and cones must rotate to match direction.
 
 		// Tool mesh local axes after rotation in component local space.
@@ -197,50 +247,124 @@ void FRealtimeBooleanProcessor::EnqueueOp(FRealtimeDestructionOp&& Operation, UD
 			1.0f / FMath::Max(KINDA_SMALL_NUMBER, ScaledAxisZ.Size())
 		);
 
-		Op.ToolTransform = FTransform(ToolRotation, LocalImpact, AdjustedScale);
-		break;
+		return FTransform(ToolRotation, LocalImpact, AdjustedScale);
 	}
 	case EDestructionToolShape::Sphere:
-	{ 
-		  FVector InverseScale = FVector(
-		  1.0f / FMath::Max(KINDA_SMALL_NUMBER, ComponentScale.X),
-		  1.0f / FMath::Max(KINDA_SMALL_NUMBER, ComponentScale.Y),
-		  1.0f / FMath::Max(KINDA_SMALL_NUMBER, ComponentScale.Z)
+	{
+		FVector InverseScale = FVector(
+			1.0f / FMath::Max(KINDA_SMALL_NUMBER, ComponentScale.X),
+			1.0f / FMath::Max(KINDA_SMALL_NUMBER, ComponentScale.Y),
+			1.0f / FMath::Max(KINDA_SMALL_NUMBER, ComponentScale.Z)
 		);
 
-      Op.ToolTransform = FTransform(FQuat::Identity, LocalImpact, InverseScale);
-		break;
+		return FTransform(FQuat::Identity, LocalImpact, InverseScale);
 	}
 	default:
-		break;
+		return FTransform::Identity;
 	}
-	  
-	Op.bIsPenetration = Operation.bIsPenetration;
-	Op.TemporaryDecal = TemporaryDecal;
-	Op.ToolMeshPtr = Operation.Request.ToolMeshPtr;
+}
 
-	if (FRDMCVarHelper::EnableAsyncBooleanOp())
+int32 FRealtimeBooleanProcessor::EnqueueBulk(const FRealtimeDestructionBulkRequest& Bulk,
+	TConstArrayView<TSharedPtr<FDynamicMesh3, ESPMode::ThreadSafe>> ShapeToolMeshes)
+{
+#if !UE_BUILD_SHIPPING
+	TRACE_CPUPROFILER_EVENT_SCOPE("EnqueueBulk");
+#endif
+
+	if (!OwnerComponent.IsValid() || !Bulk.IsValid() || ShapeToolMeshes.Num() != Bulk.ToolShapes.Num())
 	{
-	UE_LOG(LogTemp, Warning, TEXT("High Queue Size: %d"), DebugHighQueueCount);
-	UE_LOG(LogTemp, Warning, TEXT("Normal Queue Size: %d"), DebugNormalQueueCount);
+		return 0;
+	}
 
-	if (Op.bIsPenetration)
+	const int32 ChunkNum = OwnerComponent->GetChunkNum();
+	if (ChunkNum <= 0)
 	{
-		HighPriorityQueue.Enqueue(MoveTemp(Op));
-		DebugHighQueueCount++;
-		UE_LOG(LogTemp, Warning, TEXT("[Enqueue] ✅ High Priority Queue Size: %d"), DebugHighQueueCount);
+		return 0;
 	}
-	else
+
+	const bool bAsync = FRDMCVarHelper::EnableAsyncBooleanOp();
+	const FTransform OwnerToWorld = OwnerComponent->GetComponentTransform();
+
+	// Per-chunk scratch batches are reused across calls; dispatched ones are refilled from BatchPool.
+	if (BulkChunkBatches.Num() != ChunkNum)
 	{
-		NormalPriorityQueue.Enqueue(MoveTemp(Op));
-		DebugNormalQueueCount++;
-		UE_LOG(LogTemp, Warning, TEXT("[Enqueue] ✅ Normal Priority Queue Size: %d"), DebugNormalQueueCount);
-	}	
+		BulkChunkBatches.SetNum(ChunkNum);
 	}
-	else
+	BulkDirtyChunks.Reset();
+
+	int32 RoutedCount = 0;
+	for (int32 i = 0; i < Bulk.Num(); ++i)
 	{
-		BooleanOpSync(MoveTemp(Op));
+		const uint8 ShapeId = Bulk.ShapeIds[i];
+		if (!ShapeToolMeshes.IsValidIndex(ShapeId) || !ShapeToolMeshes[ShapeId].IsValid())
+		{
+			continue;
+		}
+
+		const EDestructionToolShape ToolShape = Bulk.ToolShapes[ShapeId];
+		const FDestructionToolShapeParams& Params = Bulk.ShapeParams[ShapeId];
+		const FVector& ImpactPoint = Bulk.ImpactPoints[i];
+		const FVector& Forward = Bulk.ToolForwardVectors[i];
+
+		// Same tool origin convention as UDestructionProjectileComponent::SetShapeParameters.
+		const FVector ToolOrigin = (ToolShape == EDestructionToolShape::Cylinder)
+			? ImpactPoint - Forward * Params.SurfaceMargin
+			: ImpactPoint;
+
+		// Probe slightly inside the surface so impacts on a slice boundary resolve to the hit chunk.
+		const int32 ChunkIndex = OwnerComponent->LocalPositionToChunkId(
+			OwnerToWorld.InverseTransformPosition(ImpactPoint + Forward));
+		UDynamicMeshComponent* ChunkMesh = OwnerComponent->GetChunkMeshComponent(ChunkIndex);
+		if (!ChunkMesh)
+		{
+			continue;
+		}
+
+		++RoutedCount;
+
+		if (!bAsync)
+		{
+			// Sync path consumes the tool mesh, so hand it a private copy of the shared palette mesh.
+			FBulletHole Op = {};
+			Op.ChunkIndex = ChunkIndex;
+			Op.TargetMesh = ChunkMesh;
+			Op.bIsPenetration = Bulk.bIsPenetration;
+			Op.ToolMeshPtr = MakeShared<FDynamicMesh3, ESPMode::ThreadSafe>(*ShapeToolMeshes[ShapeId]);
+			Op.ToolTransform = MakeLocalToolTransform(ChunkMesh->GetComponentTransform(), ToolShape, ToolOrigin, Forward);
+			BooleanOpSync(MoveTemp(Op));
+			continue;
+		}
+
+		FBulletHoleBatch& Batch = BulkChunkBatches[ChunkIndex];
+		if (Batch.Num() == 0)
+		{
+			BulkDirtyChunks.Add(ChunkIndex);
+		}
+
+		Batch.Add(MakeLocalToolTransform(ChunkMesh->GetComponentTransform(), ToolShape, ToolOrigin, Forward),
+			Bulk.bIsPenetration, ShapeToolMeshes[ShapeId]);
+
+		// Flush as soon as the chunk reaches its adaptive union limit.
+		const int32 ChunkUnionLimit = MaxUnionCount.IsValidIndex(ChunkIndex) ? MaxUnionCount[ChunkIndex] : 10;
+		if (Batch.Num() >= ChunkUnionLimit)
+		{
+			DispatchChunkBatch(MoveTemp(Batch), ChunkMesh, ChunkIndex, Bulk.bIsPenetration);
+			Batch = BatchPool.Acquire();
+		}
 	}
+
+	for (const int32 ChunkIndex : BulkDirtyChunks)
+	{
+		FBulletHoleBatch& Batch = BulkChunkBatches[ChunkIndex];
+		if (Batch.Num() > 0)
+		{
+			DispatchChunkBatch(MoveTemp(Batch), OwnerComponent->GetChunkMeshComponent(ChunkIndex), ChunkIndex, Bulk.bIsPenetration);
+			Batch = BatchPool.Acquire();
+		}
+	}
+	BulkDirtyChunks.Reset();
+
+	return RoutedCount;
 }
 
 void FRealtimeBooleanProcessor::EnqueueRemaining(FBulletHole&& Operation)
@@ -325,9 +449,10 @@ URDMThreadManagerSubsystem* FRealtimeBooleanProcessor::GetThreadManager() const
 
 void FRealtimeBooleanProcessor::InitializeSlots()
 {
+	// Sized for the upper worker limit; FindLeastBusySlot only uses the slots the current limit allows.
 	if (URDMThreadManagerSubsystem* ThreadManager = GetThreadManager())
 	{
-		NumSlots = ThreadManager->GetSlotCount();
+		NumSlots = ThreadManager->GetMaxSlotCount();
 	}
 	else
 	{
@@ -348,6 +473,13 @@ void FRealtimeBooleanProcessor::InitializeSlots()
 		SlotSubtractQueues[i] = MakeUnique<TQueue<FUnionResult, EQueueMode::Mpsc>>();
 	} 
 
+	// Create scratch pools (one union + MaxSubtractWorkerPerSlot subtract workers per slot).
+	SlotScratchPools.SetNum(NumSlots);
+	for (int32 i = 0; i < NumSlots; ++i)
+	{
+		SlotScratchPools[i] = MakeShared<TBooleanScratchPool<FBooleanWorkerScratch>, ESPMode::ThreadSafe>(MaxUnionWorkerPerSlot + MaxSubtractWorkerPerSlot);
+	}
+
 	// Create active flags.
 	SlotUnionActiveFlags.SetNum(NumSlots);
 	SlotSubtractActiveFlags.SetNum(NumSlots);
@@ -387,6 +519,8 @@ void FRealtimeBooleanProcessor::ShutdownSlots()
 		}
 	}
 	SlotSubtractQueues.Empty();
+
+	SlotScratchPools.Empty();
    
 	// Clear flags.
 	SlotUnionActiveFlags.Empty();
@@ -403,7 +537,14 @@ int32 FRealtimeBooleanProcessor::FindLeastBusySlot() const
 	int32 BestSlot = 0;
 	int32 MinScore = INT32_MAX;
 
-	for (int32 i = 0; i < NumSlots; i++)
+	// Dynamic scaling gates dispatch to the slots the current worker limit allows.
+	int32 NumActiveSlots = NumSlots;
+	if (URDMThreadManagerSubsystem* ThreadManager = GetThreadManager())
+	{
+		NumActiveSlots = FMath::Clamp(ThreadManager->GetSlotCount(), 1, NumSlots);
+	}
+
+	for (int32 i = 0; i < NumActiveSlots; i++)
 	{
 		// Score based on active worker counts.
 		int32 Score = SlotUnionWorkerCounts[i]->load() + SlotSubtractWorkerCounts[i]->load() * 2;
@@ -532,35 +673,34 @@ void FRealtimeBooleanProcessor::ProcessSlotUnionWork(int32 SlotIndex, FBulletHol
 	int32 ChunkIndex = Batch.ChunkIndex;
 	if (ChunkIndex == INDEX_NONE)
 	{
+		ReleaseBatch(MoveTemp(Batch));
 		SlotUnionWorkerCounts[SlotIndex]->fetch_sub(1);
 		return;
 	}
 
+	// Pooled scratch meshes keep their buffers between jobs on this slot.
+	TSharedPtr<TBooleanScratchPool<FBooleanWorkerScratch>, ESPMode::ThreadSafe> ScratchPool = GetScratchPool(SlotIndex);
+	FBooleanWorkerScratch Scratch = ScratchPool.IsValid() ? ScratchPool->Acquire() : FBooleanWorkerScratch();
+
 	// Perform union (no chunk mesh access; tool meshes only).
 	FDynamicMesh3 CombinedToolMesh;
 	TArray<TWeakObjectPtr<UDecalComponent>> Decals;
 	int32 UnionCount = 0;
 
-	int32 BatchCount = Batch.Num();
-	TArray<FTransform> ToolTransforms = MoveTemp(Batch.ToolTransforms);
-	TArray<TWeakObjectPtr<UDecalComponent>> TemporaryDecals = MoveTemp(Batch.TemporaryDecals);
-	TArray<TSharedPtr<FDynamicMesh3, ESPMode::ThreadSafe>> ToolMeshPtrs = MoveTemp(
-		Batch.ToolMeshPtrs);
+	// Batch arrays are read in place so their storage can go back to the pool afterwards.
+	const int32 BatchCount = Batch.Num();
 
 	bool bIsFirst = true;
 	for (int32 i = 0; i < BatchCount; ++i)
 	{
-		if (!ToolMeshPtrs[i].IsValid())
+		const TSharedPtr<FDynamicMesh3, ESPMode::ThreadSafe>& ToolMeshPtr = Batch.ToolMeshPtrs[i];
+		if (!ToolMeshPtr.IsValid())
 		{
 			continue;
 		}
 
-		FTransform ToolTransform = MoveTemp(ToolTransforms[i]);
-		TWeakObjectPtr<UDecalComponent> TemporaryDecal = MoveTemp(TemporaryDecals[i]);
-
 		// Skip empty meshes (avoid crash).
-		FDynamicMesh3 CurrentTool = *(ToolMeshPtrs[i]);
-		if (CurrentTool.TriangleCount() == 0)
+		if (ToolMeshPtr->TriangleCount() == 0)
 		{
 			UE_LOG(LogTemp, Warning,
 			       TEXT(
@@ -569,27 +709,27 @@ void FRealtimeBooleanProcessor::ProcessSlotUnionWork(int32 SlotIndex, FBulletHol
 			continue;
 		}
 
-		//FDynamicMesh3 CurrentTool = MoveTemp(*(ToolMeshPtrs[i]));
-		MeshTransforms::ApplyTransform(CurrentTool, (FTransformSRT3d)ToolTransform, true);
+		// The first tool seeds the combined mesh; later tools go through the pooled scratch mesh.
+		FDynamicMesh3& CurrentTool = bIsFirst ? CombinedToolMesh : Scratch.ToolMesh;
+		CurrentTool = *ToolMeshPtr;
+		MeshTransforms::ApplyTransform(CurrentTool, (FTransformSRT3d)Batch.ToolTransforms[i], true);
 
-		if (TemporaryDecal.IsValid())
+		if (Batch.TemporaryDecals[i].IsValid())
 		{
-			Decals.Add(TemporaryDecal);
+			Decals.Add(Batch.TemporaryDecals[i]);
 		}
 
 		if (bIsFirst)
 		{
-			CombinedToolMesh = MoveTemp(CurrentTool);
 			bIsFirst = false;
 			UnionCount++;
 		}
 		else
 		{
-			FDynamicMesh3 UnionResult;
 			FMeshBoolean MeshUnion(
 				&CombinedToolMesh, FTransform::Identity,
 				&CurrentTool, FTransform::Identity,
-				&UnionResult, FMeshBoolean::EBooleanOp::Union
+				&Scratch.UnionMesh, FMeshBoolean::EBooleanOp::Union
 			);
 
 			bool bUnionSuccess = false;
@@ -602,7 +742,8 @@ void FRealtimeBooleanProcessor::ProcessSlotUnionWork(int32 SlotIndex, FBulletHol
 
 			if (bUnionSuccess)
 			{
-				CombinedToolMesh = MoveTemp(UnionResult);
+				// Swap so the previous combined buffer becomes the next union output.
+				Swap(CombinedToolMesh, Scratch.UnionMesh);
 				UnionCount++;
 
 				UE_LOG(LogTemp, Display, TEXT("ToolMeshTri %d"), CombinedToolMesh.TriangleCount());
@@ -617,6 +758,12 @@ void FRealtimeBooleanProcessor::ProcessSlotUnionWork(int32 SlotIndex, FBulletHol
 		}
 	}
 
+	if (ScratchPool.IsValid())
+	{
+		Scratch.ResetForPool();
+		ScratchPool->Release(MoveTemp(Scratch));
+	}
+
 	if (UnionCount > 0 && CombinedToolMesh.TriangleCount() > 0)
 	{
 		FUnionResult Result;
@@ -626,12 +773,14 @@ void FRealtimeBooleanProcessor::ProcessSlotUnionWork(int32 SlotIndex, FBulletHol
 		Result.UnionCount = UnionCount;
 		Result.ChunkIndex = ChunkIndex;
 		// 배치 완료 추적용 ID 배열 복사
-		Result.CompletionBatchIds = MoveTemp(Batch.CompletionBatchIds);
+		Result.CompletionBatchIds = Batch.CompletionBatchIds;
 
 		// Enqueue into subtract queue.
 		SlotSubtractQueues[SlotIndex]->Enqueue(MoveTemp(Result));
 	}
 
+	ReleaseBatch(MoveTemp(Batch));
+
 	SlotUnionWorkerCounts[SlotIndex]->fetch_sub(1);
 
 	// Kick subtract (on GameThread).
@@ -724,8 +873,13 @@ void FRealtimeBooleanProcessor::ProcessSlotSubtractWork(int32 SlotIndex, FUnionR
 							          }
 						          }
 
+						          // 배치 추출: 한 분리 이벤트의 모든 Actor에 결과를 나눠 적용 (Client extraction)
+						          if (Context->BatchDebrisActors.Num() > 0)
+						          {
+							          Owner->DistributeBatchedDebris(MoveTemp(Context->AccumulatedDebrisMesh), Materials, *Context);
+						          }
 						          // TargetDebrisActor가 있으면 기존 Actor에 메시 적용 (Client extraction)
-						          if (Context->TargetDebrisActor.IsValid())
+						          else if (Context->TargetDebrisActor.IsValid())
 						          {
 									  Owner->SpawnDebrisActor(MoveTemp(Context->AccumulatedDebrisMesh), Materials, Context->TargetDebrisActor.Get());
 
@@ -733,7 +887,7 @@ void FRealtimeBooleanProcessor::ProcessSlotSubtractWork(int32 SlotIndex, FUnionR
 						          // 그 외: 새 DebrisActor 스폰 (Standalone/Listen Server)
 						          else if (Context->Owner.IsValid())
 						          {
-					          Context->Owner->SpawnDebrisActor(MoveTemp(Context->AccumulatedDebrisMesh), Materials);
+					          Context->Owner->SpawnDebrisActor(MoveTemp(Context->AccumulatedDebrisMesh), Materials, nullptr, &Context->PieceCellIds);
 				          }
 			          }
 
@@ -778,9 +932,21 @@ void FRealtimeBooleanProcessor::ProcessSlotSubtractWork(int32 SlotIndex, FUnionR
 	FDynamicMesh3 ResultMesh;
 	bool bSuccess = false; 
 	bool bHasDebris = false; 
+	double SubtractDurationMs = 0.0;
 	{	
-		// Fetch chunk mesh.
-		FDynamicMesh3 WorkMesh;
+		// Fetch chunk mesh into pooled scratch (the copy is only read, so small chunks reuse its buffers).
+		TSharedPtr<TBooleanScratchPool<FBooleanWorkerScratch>, ESPMode::ThreadSafe> ScratchPool = GetScratchPool(SlotIndex);
+		FBooleanWorkerScratch Scratch = ScratchPool.IsValid() ? ScratchPool->Acquire() : FBooleanWorkerScratch();
+		ON_SCOPE_EXIT
+		{
+			if (ScratchPool.IsValid())
+			{
+				Scratch.ResetForPool();
+				ScratchPool->Release(MoveTemp(Scratch));
+			}
+		};
+
+		FDynamicMesh3& WorkMesh = Scratch.WorkMesh;
 		if (!OwnerComponent->GetChunkMesh(WorkMesh, ChunkIndex))
 		{
 			HandleFailureAndReturn();
@@ -826,6 +992,8 @@ void FRealtimeBooleanProcessor::ProcessSlotSubtractWork(int32 SlotIndex, FUnionR
 
 			CurrentSubtractDurationMs = (FPlatformTime::Seconds() - CurrentSubtractDurationMs) * 1000.0;
 
+			SubtractDurationMs = CurrentSubtractDurationMs;
+
 			if (bSuccess)
 			{
 				AccumulateSubtractDuration(ChunkIndex, CurrentSubtractDurationMs);     
@@ -857,15 +1025,16 @@ void FRealtimeBooleanProcessor::ProcessSlotSubtractWork(int32 SlotIndex, FUnionR
 			// Intersection (Debris): 원본 크기 DebrisToolMesh 사용
 			if (UnionResult.DebrisSharedToolMesh.IsValid() && UnionResult.IslandContext.IsValid())
 			{
-				FDynamicMesh3 DebrisTool = *UnionResult.DebrisSharedToolMesh;
+				// ApplyMeshBooleanAsync only reads the tool, so the shared mesh is passed without a copy.
+				const FDynamicMesh3* DebrisTool = UnionResult.DebrisSharedToolMesh.Get();
 				FDynamicMesh3 Debris;
 
 				UE_LOG(LogTemp, Warning, TEXT("[BooleanProcessor] Intersection START - WorkMesh Tris=%d, DebrisTool Tris=%d"),
-					WorkMesh.TriangleCount(), DebrisTool.TriangleCount());
+					WorkMesh.TriangleCount(), DebrisTool->TriangleCount());
 
 				bool bSuccessIntersection = ApplyMeshBooleanAsync(
 					&WorkMesh,
-					&DebrisTool,
+					DebrisTool,
 					&Debris,
 					EGeometryScriptBooleanOperation::Intersection,
 					Ops);
@@ -905,10 +1074,9 @@ void FRealtimeBooleanProcessor::ProcessSlotSubtractWork(int32 SlotIndex, FUnionR
 			// Subtract (구멍): 스케일된 SharedToolMesh 사용
 			if (UnionResult.SharedToolMesh.IsValid())
 			{
-				FDynamicMesh3 LocalTool = *UnionResult.SharedToolMesh;
 				bSuccess = ApplyMeshBooleanAsync(
 					&WorkMesh,
-					&LocalTool,
+					UnionResult.SharedToolMesh.Get(),
 					&ResultMesh,
 					EGeometryScriptBooleanOperation::Subtract,
 					Ops);
@@ -933,6 +1101,7 @@ void FRealtimeBooleanProcessor::ProcessSlotSubtractWork(int32 SlotIndex, FUnionR
 			          Decals = MoveTemp(UnionResult.Decals),
 			          UnionCount = UnionResult.UnionCount,
 			          CompletionBatchIds = MoveTemp(UnionResult.CompletionBatchIds),
+			          SubtractDurationMs,
 			          bSuccess]() mutable
 		          {
 			          if (!LifeTimeToken.IsValid() || !LifeTimeToken->bAlive.load())
@@ -961,6 +1130,11 @@ void FRealtimeBooleanProcessor::ProcessSlotSubtractWork(int32 SlotIndex, FUnionR
 				          TRACE_CPUPROFILER_EVENT_SCOPE("SlotWorkerUnion_ApplyGT");
 #endif
 				          WeakOwner->ApplyBooleanOperationResult(MoveTemp(ResultMesh), ChunkIndex, true);
+
+				          if (UDestructionDebugger* Debugger = WeakOwner->GetWorld() ? WeakOwner->GetWorld()->GetSubsystem<UDestructionDebugger>() : nullptr)
+				          {
+					          Debugger->RecordEvent(EDestructionEventSource::Boolean, WeakOwner, 0, static_cast<float>(SubtractDurationMs));
+				          }
 			          }
 
 			          // 배치 완료 추적: 모든 BatchId에 대해 완료 알림
@@ -994,8 +1168,13 @@ void FRealtimeBooleanProcessor::ProcessSlotSubtractWork(int32 SlotIndex, FUnionR
 							          }
 						          }
 
+						          // 배치 추출: 한 분리 이벤트의 모든 Actor에 결과를 나눠 적용 (Client extraction)
+						          if (Context->BatchDebrisActors.Num() > 0)
+						          {
+							          WeakOwner->DistributeBatchedDebris(MoveTemp(Context->AccumulatedDebrisMesh), Materials, *Context);
+						          }
 						          // TargetDebrisActor가 있으면 기존 Actor에 메시 적용 (Client extraction)
-						          if (Context->TargetDebrisActor.IsValid())
+						          else if (Context->TargetDebrisActor.IsValid())
 						          {
 							          UE_LOG(LogTemp, Warning, TEXT("[BooleanProcessor] Calling ApplyMeshToDebrisActor with %d triangles"), Context->AccumulatedDebrisMesh.TriangleCount());
 							          WeakOwner->SpawnDebrisActor(MoveTemp(Context->AccumulatedDebrisMesh), Materials, Context->TargetDebrisActor.Get());
@@ -1004,7 +1183,7 @@ void FRealtimeBooleanProcessor::ProcessSlotSubtractWork(int32 SlotIndex, FUnionR
 						          // 그 외: 새 DebrisActor 스폰 (Standalone/Listen Server)
 						          else if (Context->Owner.IsValid())
 						          {
-							          Context->Owner->SpawnDebrisActor(MoveTemp(Context->AccumulatedDebrisMesh), Materials);
+							          Context->Owner->SpawnDebrisActor(MoveTemp(Context->AccumulatedDebrisMesh), Materials, nullptr, &Context->PieceCellIds);
 						          }
 					          }
 
@@ -1188,79 +1367,44 @@ void FRealtimeBooleanProcessor::UpdateUnionSize(int32 ChunkIndex, double Duratio
 
 void FRealtimeBooleanProcessor::KickProcessIfNeededPerChunk()
 {
-	/*
-	 * Build TMap by priority.
-	 * Use chunk address as key to gather per-chunk ops.
-	 */
-	TMap<UDynamicMeshComponent*, FBulletHoleBatch> HighPriorityMap;
-	TMap<UDynamicMeshComponent*, FBulletHoleBatch> NormalPriorityMap;
+	if (!OwnerComponent.IsValid() || ChunkPendingOps.IsEmpty())
+	{
+		return;
+	}
+
+	// Nothing new and nothing left over: skip without touching any container.
+	if (DirtyPendingChunks.IsEmpty() && HighPriorityQueue.IsEmpty() && NormalPriorityQueue.IsEmpty())
+	{
+		ReportPendingOpsToThreadManager();
+		return;
+	}
 
 	/*
-	 * TMap does not preserve order.
-	 * Use arrays to preserve order.
+	 * Move queued ops into per-chunk pending lists indexed by ChunkIndex.
+	 * The lists persist across ticks, so no per-tick maps or overflow arrays are needed.
 	 */
-	TArray<UDynamicMeshComponent*> HighPriorityOrder;
-	TArray<UDynamicMeshComponent*> NormalPriorityOrder;
-
-	
-
-	// Pre-allocate some memory.
-	HighPriorityOrder.Reserve(100);
-	NormalPriorityOrder.Reserve(100);
-
-	auto GatherOps = [&](TQueue<FBulletHole, EQueueMode::Mpsc>& Queue,
-	                     TMap<UDynamicMeshComponent*, FBulletHoleBatch>& OpMap,
-	                     TArray<UDynamicMeshComponent*>& OrderArray, int& DebugCount)
+	auto GatherOps = [&](TQueue<FBulletHole, EQueueMode::Mpsc>& Queue, int& DebugCount)
 	{
-		// Temporary overflow array for ops beyond union limit (for re-enqueue).
-		TArray<FBulletHole> OverflowOps;
-		OverflowOps.Reserve(50);
-		
 		FBulletHole Op;
 		while (Queue.Dequeue(Op))
 		{
-			auto TargetMesh = Op.TargetMesh.Get(); 
+			DebugCount--;
+
+			UDynamicMeshComponent* TargetMesh = Op.TargetMesh.Get();
 			if (!TargetMesh)
 			{
 				continue;
 			}
 
-			const int32 ChunkIndex = OwnerComponent->GetChunkIndex(TargetMesh);
-			if (ChunkIndex == INDEX_NONE)
+			const int32 ChunkIndex = ChunkPendingOps.IsValidIndex(Op.ChunkIndex)
+				? Op.ChunkIndex
+				: OwnerComponent->GetChunkIndex(TargetMesh);
+			if (!ChunkPendingOps.IsValidIndex(ChunkIndex))
 			{
 				continue;
 			}
-			
-			const int32 ChunkUnionLimit = MaxUnionCount.IsValidIndex(ChunkIndex) ? MaxUnionCount[ChunkIndex] : 10;
 
-			// Use Find to avoid creating unnecessary keys.
-			FBulletHoleBatch* Batch = OpMap.Find(TargetMesh);
-			const int32 CurrentCount = Batch ? Batch->Num() : 0;
-
-			// If union limit exceeded, store in overflow and re-enqueue.
-			if (CurrentCount >= ChunkUnionLimit)
-			{
-				OverflowOps.Add(MoveTemp(Op));
-			}
-			else
-			{
-				if (!Batch)
-				{
-					// Record order.
-					OrderArray.Add(TargetMesh);
-
-					// Create map entry.
-					Batch = &OpMap.Add(TargetMesh);
-					Batch->Reserve(ChunkUnionLimit);
-				}
-				Batch->Add(MoveTemp(Op));
-				DebugCount--;
-			}
-		}
-
-		for (FBulletHole& OverflowOp : OverflowOps)
-		{
-			Queue.Enqueue(MoveTemp(OverflowOp));
+			AddPendingOp(MoveTemp(Op), ChunkIndex);
 		}
 	};
 
@@ -1268,63 +1412,107 @@ void FRealtimeBooleanProcessor::KickProcessIfNeededPerChunk()
 #if !UE_BUILD_SHIPPING
 		TRACE_CPUPROFILER_EVENT_SCOPE("GatherOps");
 #endif
-		GatherOps(HighPriorityQueue, HighPriorityMap, HighPriorityOrder, DebugHighQueueCount);
-		GatherOps(NormalPriorityQueue, NormalPriorityMap, NormalPriorityOrder, DebugNormalQueueCount);
+		GatherOps(HighPriorityQueue, DebugHighQueueCount);
+		GatherOps(NormalPriorityQueue, DebugNormalQueueCount);
 	}
 
-	auto ProcessTargetMesh = [&](TMap<UDynamicMeshComponent*, FBulletHoleBatch>& OpMap,
-	                             TQueue<FBulletHole, EQueueMode::Mpsc>& Queue,
-	                             TArray<UDynamicMeshComponent*>& OrderArray, int32& DebugCount)
+	/*
+	 * Form at most one batch per chunk and priority.
+	 * Ops beyond the union limit stay in place for the next tick.
+	 */
+	auto ProcessPending = [&](bool bHighPriority)
 	{
-		if (OpMap.IsEmpty() || OrderArray.IsEmpty())
+		for (const int32 ChunkIndex : DirtyPendingChunks)
 		{
-			return;
-		}
+			FPendingOpList& Pending = bHighPriority
+				? ChunkPendingOps[ChunkIndex].HighPriority
+				: ChunkPendingOps[ChunkIndex].NormalPriority;
+			if (Pending.IsEmpty())
+			{
+				continue;
+			}
 
-		for (auto TargetMesh : OrderArray)
-		{
-			const int32 ChunkIndex = OwnerComponent->GetChunkIndex(TargetMesh);
+			UDynamicMeshComponent* TargetMesh = OwnerComponent->GetChunkMeshComponent(ChunkIndex);
+			if (!TargetMesh)
+			{
+				Pending.Reset();
+				continue;
+			}
 
-			if (ChunkIndex == INDEX_NONE)
+			// In single-worker mode a busy chunk keeps its ops pending (no batch is formed).
+			if (!bEnableMultiWorkers && OwnerComponent->CheckAndSetChunkBusy(ChunkIndex))
 			{
 				continue;
 			}
 
-			if (FBulletHoleBatch* Batch = OpMap.Find(TargetMesh))
+			const int32 ChunkUnionLimit = MaxUnionCount.IsValidIndex(ChunkIndex) ? MaxUnionCount[ChunkIndex] : 10;
+			const int32 TakeCount = FMath::Min(Pending.Num(), FMath::Max(1, ChunkUnionLimit));
+
+			FBulletHoleBatch Batch = BatchPool.Acquire();
+			Batch.Reserve(TakeCount);
+			for (int32 i = 0; i < TakeCount; ++i)
+			{
+				Batch.Add(MoveTemp(Pending[i]));
+			}
+			Pending.Consume(TakeCount);
+			Batch.ChunkIndex = ChunkIndex;
+
+			UE_LOG(LogTemp, Display, TEXT("ToolMeshTri/lamda %d/ %d"), Batch.Num(), Batch.ToolMeshPtrs[0].IsValid() ? Batch.ToolMeshPtrs[0]->TriangleCount() : 0);
+
+			if (bEnableMultiWorkers)
+			{
+				DispatchChunkBatch(MoveTemp(Batch), TargetMesh, ChunkIndex, bHighPriority);
+			}
+			else
 			{
-				Batch->ChunkIndex = ChunkIndex;
-				UE_LOG(LogTemp, Display, TEXT("ToolMeshTri/lamda %d/ %d"), Batch->Num(), Batch->ToolMeshPtrs[0].Get()->TriangleCount());
-				 if (bEnableMultiWorkers)
-				 {
-				 	// Decide slot for this chunk.
-				 	int32 TargetSlot = FindLeastBusySlot();
-				 	
-				 	// Enqueue into union queue.
-				  	SlotUnionQueues[TargetSlot]->Enqueue(MoveTemp(*Batch));
-				 	// Wake union worker.
-				 	KickUnionWorker(TargetSlot);
-				 }
-				 else
-				 {
-				 	if (!OwnerComponent->CheckAndSetChunkBusy(ChunkIndex))
-				 	{
-				 		const int32 Gen = ChunkGenerations[ChunkIndex];
-				 		StartBooleanWorkerAsyncForChunk(MoveTemp(*Batch), Gen);
-				 	}
-				 	else
-				 	{
-				 		/*
-				 			* Add logic to re-queue batches for busy chunks.
-				 			*/
-				 		EnqueueRetryOps(Queue, MoveTemp(*Batch), TargetMesh, ChunkIndex, DebugCount);
-				 	}
-				 }
+				// Busy bit was already taken above.
+				const int32 Gen = ChunkGenerations[ChunkIndex];
+				StartBooleanWorkerAsyncForChunk(MoveTemp(Batch), Gen);
 			}
 		}
 	};
 
-	ProcessTargetMesh(HighPriorityMap, HighPriorityQueue, HighPriorityOrder, DebugHighQueueCount);
-	ProcessTargetMesh(NormalPriorityMap, NormalPriorityQueue, NormalPriorityOrder, DebugNormalQueueCount);
+	ProcessPending(true);
+	ProcessPending(false);
+
+	// Keep only chunks that still have ops waiting.
+	int32 WriteIndex = 0;
+	for (int32 ReadIndex = 0; ReadIndex < DirtyPendingChunks.Num(); ++ReadIndex)
+	{
+		const int32 ChunkIndex = DirtyPendingChunks[ReadIndex];
+		if (ChunkPendingOps[ChunkIndex].IsEmpty())
+		{
+			ChunkPendingOps[ChunkIndex].bDirty = false;
+		}
+		else
+		{
+			DirtyPendingChunks[WriteIndex++] = ChunkIndex;
+		}
+	}
+	DirtyPendingChunks.SetNum(WriteIndex, EAllowShrinking::No);
+
+	ReportPendingOpsToThreadManager();
+}
+
+void FRealtimeBooleanProcessor::ReportPendingOpsToThreadManager()
+{
+	// Only dirty chunks hold ops, so this stays proportional to the backlog itself.
+	int32 NumPendingOps = 0;
+	for (const int32 ChunkIndex : DirtyPendingChunks)
+	{
+		NumPendingOps += ChunkPendingOps[ChunkIndex].Num();
+	}
+
+	if (NumPendingOps == LastReportedPendingOps)
+	{
+		return;
+	}
+
+	if (URDMThreadManagerSubsystem* ThreadManager = GetThreadManager())
+	{
+		ThreadManager->ReportPendingOps(OwnerComponent.Get(), NumPendingOps);
+		LastReportedPendingOps = NumPendingOps;
+	}
 }
 
 void FRealtimeBooleanProcessor::StartBooleanWorkerAsyncForChunk(FBulletHoleBatch&& InBatch, int32 Gen)
@@ -1335,8 +1523,7 @@ void FRealtimeBooleanProcessor::StartBooleanWorkerAsyncForChunk(FBulletHoleBatch
 	}
 
 	FGeometryScriptMeshBooleanOptions Options = OwnerComponent->GetBooleanOptions();
-	UE::Tasks::Launch(
-		UE_SOURCE_LOCATION,
+	TFunction<void()> Work =
 		[OwnerComponent = OwnerComponent, LifeTimeToken = LifeTime,
 		Batch = MoveTemp(InBatch), Options, Gen]() mutable
 		{
@@ -1389,14 +1576,24 @@ void FRealtimeBooleanProcessor::StartBooleanWorkerAsyncForChunk(FBulletHoleBatch
 
 			using namespace UE::Geometry;
 
+			// Pooled scratch meshes and batch storage are handed back however this task exits.
+			TSharedPtr<TBooleanScratchPool<FBooleanWorkerScratch>, ESPMode::ThreadSafe> ScratchPool = Processor->GetScratchPool(0);
+			FBooleanWorkerScratch Scratch = ScratchPool.IsValid() ? ScratchPool->Acquire() : FBooleanWorkerScratch();
+			ON_SCOPE_EXIT
+			{
+				if (ScratchPool.IsValid())
+				{
+					Scratch.ResetForPool();
+					ScratchPool->Release(MoveTemp(Scratch));
+				}
+				Processor->ReleaseBatch(MoveTemp(Batch));
+			};
+
 			int32 AppliedCount = 0;
 			TArray<TWeakObjectPtr<UDecalComponent>> DecalsToRemove;
 			DecalsToRemove.Reserve(BatchCount);
-			// 배치 완료 추적용 ID 배열 (다른 데이터 move 전에 먼저 추출)
-			TArray<int32> CompletionBatchIds = MoveTemp(Batch.CompletionBatchIds);
-			TArray<TWeakObjectPtr<UDecalComponent>> TemporaryDecals = MoveTemp(Batch.TemporaryDecals);
-			TArray<FTransform> Transforms = MoveTemp(Batch.ToolTransforms);
-			TArray<TSharedPtr<UE::Geometry::FDynamicMesh3, ESPMode::ThreadSafe>> ToolMeshPtrs = MoveTemp(Batch.ToolMeshPtrs);
+			// 배치 완료 추적용 ID 배열
+			TArray<int32> CompletionBatchIds = Batch.CompletionBatchIds;
 
 			int32 UnionCount = 0;
 			bool bIsFirst = true;
@@ -1409,39 +1606,37 @@ void FRealtimeBooleanProcessor::StartBooleanWorkerAsyncForChunk(FBulletHoleBatch
 				for (int32 i = 0; i < BatchCount; i++)
 				{
 
-					if (!ToolMeshPtrs[i].IsValid())
+					if (!Batch.ToolMeshPtrs[i].IsValid())
 					{
 						SafeClearBusyBit();
 						return;
 					}
 
-					FTransform ToolTransform = MoveTemp(Transforms[i]);
-					TWeakObjectPtr<UDecalComponent> TemporaryDecal = MoveTemp(TemporaryDecals[i]);
-
-					FDynamicMesh3 CurrentTool = *(ToolMeshPtrs[i]);
-					MeshTransforms::ApplyTransform(CurrentTool, (FTransformSRT3d)ToolTransform, true);
+					// The first tool seeds the combined mesh; later tools go through the pooled scratch mesh.
+					FDynamicMesh3& CurrentTool = bIsFirst ? CombinedToolMesh : Scratch.ToolMesh;
+					CurrentTool = *(Batch.ToolMeshPtrs[i]);
+					MeshTransforms::ApplyTransform(CurrentTool, (FTransformSRT3d)Batch.ToolTransforms[i], true);
 
-					if (TemporaryDecal.IsValid())
+					if (Batch.TemporaryDecals[i].IsValid())
 					{
-						DecalsToRemove.Add(MoveTemp(TemporaryDecal));
+						DecalsToRemove.Add(Batch.TemporaryDecals[i]);
 					}
 
 					if (bIsFirst)
 					{
 						bIsFirst = false;
-						CombinedToolMesh = CurrentTool;
 						bCombinedValid = true;
 						UnionCount++;
 					}
 					else
 					{
-						FDynamicMesh3 UnionResult;
 						FMeshBoolean MeshUnion(&CombinedToolMesh, FTransform::Identity,
 							&CurrentTool, FTransform::Identity,
-							&UnionResult, FMeshBoolean::EBooleanOp::Union);
+							&Scratch.UnionMesh, FMeshBoolean::EBooleanOp::Union);
 						if (MeshUnion.Compute())
 						{
-							CombinedToolMesh = MoveTemp(UnionResult);
+							// Swap so the previous combined buffer becomes the next union output.
+							Swap(CombinedToolMesh, Scratch.UnionMesh);
 							UnionCount++;
 						}
 					}
@@ -1449,6 +1644,7 @@ void FRealtimeBooleanProcessor::StartBooleanWorkerAsyncForChunk(FBulletHoleBatch
 			}
 						
 			bool bSubtractSuccess = false;
+			double SubtractDurationMs = 0.0;
 			if (bCombinedValid && CombinedToolMesh.TriangleCount() > 0)
 			{
 				double CurrentSubDuration = FPlatformTime::Seconds();
@@ -1485,6 +1681,7 @@ void FRealtimeBooleanProcessor::StartBooleanWorkerAsyncForChunk(FBulletHoleBatch
 				++Processor->ChunkGenerations[ChunkIndex];
 
 				CurrentSubDuration = FPlatformTime::Seconds() - CurrentSubDuration;
+				SubtractDurationMs = CurrentSubDuration * 1000.0;
 
 				if (bSubtractSuccess)
 				{
@@ -1516,7 +1713,7 @@ void FRealtimeBooleanProcessor::StartBooleanWorkerAsyncForChunk(FBulletHoleBatch
 			}
 
 			AsyncTask(ENamedThreads::GameThread,
-				[OwnerComponent, LifeTimeToken, Gen, ChunkIndex, Result = MoveTemp(WorkMesh), AppliedCount, DecalsToRemove = MoveTemp(DecalsToRemove), CompletionBatchIds = MoveTemp(CompletionBatchIds)]() mutable
+				[OwnerComponent, LifeTimeToken, Gen, ChunkIndex, Result = MoveTemp(WorkMesh), AppliedCount, SubtractDurationMs, DecalsToRemove = MoveTemp(DecalsToRemove), CompletionBatchIds = MoveTemp(CompletionBatchIds)]() mutable
 				{
 					if (!OwnerComponent.IsValid())
 					{
@@ -1557,6 +1754,12 @@ void FRealtimeBooleanProcessor::StartBooleanWorkerAsyncForChunk(FBulletHoleBatch
 
 						Processor->UpdateSimplifyInterval(CurrentSetMeshAvgCost, ChunkIndex);
 
+						// Same timeline event as the multi-worker path (feeds the freeze threshold).
+						if (UDestructionDebugger* Debugger = OwnerComponent->GetWorld() ? OwnerComponent->GetWorld()->GetSubsystem<UDestructionDebugger>() : nullptr)
+						{
+							Debugger->RecordEvent(EDestructionEventSource::Boolean, OwnerComponent.Get(), 0, static_cast<float>(SubtractDurationMs));
+						}
+
 						for (const TWeakObjectPtr<UDecalComponent>& Decal : DecalsToRemove)
 						{
 							if (Decal.IsValid())
@@ -1576,7 +1779,17 @@ void FRealtimeBooleanProcessor::StartBooleanWorkerAsyncForChunk(FBulletHoleBatch
 
 					Processor->KickProcessIfNeededPerChunk();
 				});
-		});
+		};
+
+	// Same dispatch path as the slot workers (dedicated pool, WorkerPriority, worker limit).
+	if (URDMThreadManagerSubsystem* ThreadManager = GetThreadManager())
+	{
+		ThreadManager->RequestWork(MoveTemp(Work), OwnerComponent.Get());
+	}
+	else
+	{
+		UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(Work), UE::Tasks::ETaskPriority::BackgroundNormal);
+	}
 }
 
 void FRealtimeBooleanProcessor::CancelAllOperations()
@@ -1592,6 +1805,13 @@ void FRealtimeBooleanProcessor::CancelAllOperations()
 	DebugHighQueueCount = 0;
 	DebugNormalQueueCount = 0;
 
+	for (FChunkPendingOps& Pending : ChunkPendingOps)
+	{
+		Pending.Reset();
+	}
+	DirtyPendingChunks.Reset();
+	ReportPendingOpsToThreadManager();
+
 	// Reset hole count and caches.
 	ChunkStates.Reset();
 	ChunkHoleCount.Init(OwnerComponent->GetChunkNum(), 0);
@@ -1729,11 +1949,11 @@ bool FRealtimeBooleanProcessor::TrySimplify(UE::Geometry::FDynamicMesh3& WorkMes
 	return bShouldSimplify;
 }
 
-void FRealtimeBooleanProcessor::EnqueueRetryOps(TQueue<FBulletHole, EQueueMode::Mpsc>& Queue, FBulletHoleBatch&& InBatch,
-	UDynamicMeshComponent* TargetMesh, int32 ChunkIndex, int32& DebugCount)
+void FRealtimeBooleanProcessor::EnqueuePendingOps(FBulletHoleBatch&& InBatch, UDynamicMeshComponent* TargetMesh,
+	int32 ChunkIndex, bool bHighPriority)
 {
 	int32 BatchCount = InBatch.Num();
-	if (BatchCount == 0)
+	if (BatchCount == 0 || !ChunkPendingOps.IsValidIndex(ChunkIndex))
 	{
 		return;
 	}
@@ -1745,13 +1965,81 @@ void FRealtimeBooleanProcessor::EnqueueRetryOps(TQueue<FBulletHole, EQueueMode::
 		{
 			Op.ChunkIndex = ChunkIndex;
 			Op.TargetMesh = TargetMesh;
-			Queue.Enqueue(Op);
-			DebugCount++;
+			Op.bIsPenetration = bHighPriority;
+			AddPendingOp(MoveTemp(Op), ChunkIndex);
 		}
 		Op.Reset();
 	}
 }
 
+void FRealtimeBooleanProcessor::AddPendingOp(FBulletHole&& Op, int32 ChunkIndex)
+{
+	FChunkPendingOps& Pending = ChunkPendingOps[ChunkIndex];
+	if (Op.bIsPenetration)
+	{
+		Pending.HighPriority.Add(MoveTemp(Op));
+	}
+	else
+	{
+		Pending.NormalPriority.Add(MoveTemp(Op));
+	}
+
+	if (!Pending.bDirty)
+	{
+		Pending.bDirty = true;
+		DirtyPendingChunks.Add(ChunkIndex);
+	}
+}
+
+void FRealtimeBooleanProcessor::DispatchChunkBatch(FBulletHoleBatch&& Batch, UDynamicMeshComponent* TargetMesh,
+	int32 ChunkIndex, bool bHighPriority)
+{
+	Batch.ChunkIndex = ChunkIndex;
+
+	if (bEnableMultiWorkers)
+	{
+		// Decide slot for this chunk.
+		int32 TargetSlot = FindLeastBusySlot();
+
+		// Enqueue into union queue.
+		SlotUnionQueues[TargetSlot]->Enqueue(MoveTemp(Batch));
+		// Wake union worker.
+		KickUnionWorker(TargetSlot);
+	}
+	else
+	{
+		if (!OwnerComponent->CheckAndSetChunkBusy(ChunkIndex))
+		{
+			const int32 Gen = ChunkGenerations[ChunkIndex];
+			StartBooleanWorkerAsyncForChunk(MoveTemp(Batch), Gen);
+		}
+		else
+		{
+			/*
+			 * Busy chunk: keep the ops pending for a later tick.
+			 */
+			EnqueuePendingOps(MoveTemp(Batch), TargetMesh, ChunkIndex, bHighPriority);
+			ReleaseBatch(MoveTemp(Batch));
+		}
+	}
+}
+
+TSharedPtr<TBooleanScratchPool<FBooleanWorkerScratch>, ESPMode::ThreadSafe> FRealtimeBooleanProcessor::GetScratchPool(int32 SlotIndex) const
+{
+	if (SlotScratchPools.IsValidIndex(SlotIndex))
+	{
+		return SlotScratchPools[SlotIndex];
+	}
+	return SlotScratchPools.Num() > 0 ? SlotScratchPools[0] : nullptr;
+}
+
+void FRealtimeBooleanProcessor::ReleaseBatch(FBulletHoleBatch&& Batch)
+{
+	Batch.Reset();
+	Batch.ChunkIndex = INDEX_NONE;
+	BatchPool.Release(MoveTemp(Batch));
+}
+
 int32& FRealtimeBooleanProcessor::GetChunkInterval(int32 ChunkIndex)
 {
 	/*
@@ -1772,6 +2060,84 @@ int32 FRealtimeBooleanProcessor::GetChunkHoleCount(const UPrimitiveComponent* Ch
 	return GetChunkHoleCount(ChunkIndex);
 }
 
+SIZE_T FRealtimeBooleanProcessor::GetAllocatedSize(const TSet<const UE::Geometry::FDynamicMesh3*>& ExternallyCountedMeshes) const
+{
+	SIZE_T Size = CachedChunkMeshes.GetAllocatedSize();
+	for (const TSharedPtr<UE::Geometry::FDynamicMesh3, ESPMode::ThreadSafe>& Mesh : CachedChunkMeshes)
+	{
+		if (Mesh.IsValid())
+		{
+			Size += sizeof(UE::Geometry::FDynamicMesh3) + Mesh->GetByteCount();
+		}
+	}
+
+	// Tool meshes are shared between ops (one request fans out to several chunks), so count each once
+	// and skip the ones the caller already counts
+	TSet<const UE::Geometry::FDynamicMesh3*> CountedToolMeshes;
+	auto AddToolMesh = [&](const TSharedPtr<UE::Geometry::FDynamicMesh3, ESPMode::ThreadSafe>& Mesh)
+	{
+		const UE::Geometry::FDynamicMesh3* RawMesh = Mesh.Get();
+		if (!RawMesh || ExternallyCountedMeshes.Contains(RawMesh))
+		{
+			return;
+		}
+		bool bAlreadyCounted = false;
+		CountedToolMeshes.Add(RawMesh, &bAlreadyCounted);
+		if (!bAlreadyCounted)
+		{
+			Size += sizeof(UE::Geometry::FDynamicMesh3) + RawMesh->GetByteCount();
+		}
+	};
+
+	// Pending ops
+	Size += ChunkPendingOps.GetAllocatedSize() + DirtyPendingChunks.GetAllocatedSize();
+	for (const FChunkPendingOps& PendingOps : ChunkPendingOps)
+	{
+		Size += PendingOps.HighPriority.GetAllocatedSize() + PendingOps.NormalPriority.GetAllocatedSize();
+		for (const FBulletHole& Op : PendingOps.HighPriority.GetOps())
+		{
+			AddToolMesh(Op.ToolMeshPtr);
+		}
+		for (const FBulletHole& Op : PendingOps.NormalPriority.GetOps())
+		{
+			AddToolMesh(Op.ToolMeshPtr);
+		}
+	}
+
+	Size += BulkChunkBatches.GetAllocatedSize() + BulkDirtyChunks.GetAllocatedSize();
+	for (const FBulletHoleBatch& Batch : BulkChunkBatches)
+	{
+		Size += Batch.GetAllocatedSize();
+		for (const TSharedPtr<UE::Geometry::FDynamicMesh3, ESPMode::ThreadSafe>& Mesh : Batch.ToolMeshPtrs)
+		{
+			AddToolMesh(Mesh);
+		}
+	}
+
+	// Pooled batches and per-slot worker scratch meshes
+	Size += BatchPool.GetAllocatedSize();
+	Size += SlotScratchPools.GetAllocatedSize() + SlotUnionQueues.GetAllocatedSize() + SlotSubtractQueues.GetAllocatedSize();
+	for (const TSharedPtr<TBooleanScratchPool<FBooleanWorkerScratch>, ESPMode::ThreadSafe>& Pool : SlotScratchPools)
+	{
+		if (Pool.IsValid())
+		{
+			Size += sizeof(TBooleanScratchPool<FBooleanWorkerScratch>) + Pool->GetAllocatedSize();
+		}
+	}
+
+	// Per-chunk bookkeeping
+	Size += ChunkStates.States.GetAllocatedSize()
+		+ ChunkGenerations.GetAllocatedSize()
+		+ ChunkUnionResultsQueues.GetAllocatedSize()
+		+ ChunkNextBatchIDs.GetAllocatedSize()
+		+ MaxUnionCount.GetAllocatedSize()
+		+ ChunkHoleCount.GetAllocatedSize()
+		+ MaxInterval.GetAllocatedSize()
+		+ SetMeshAvgCost.GetAllocatedSize();
+
+	return Size;
+}
+
 bool FRealtimeBooleanProcessor::ApplyMeshBooleanAsync(const UE::Geometry::FDynamicMesh3* TargetMesh,
                                                       const UE::Geometry::FDynamicMesh3* ToolMesh,
                                                       UE::Geometry::FDynamicMesh3* OutputMesh,
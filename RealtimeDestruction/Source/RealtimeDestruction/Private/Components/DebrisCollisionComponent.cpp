@@ -0,0 +1,82 @@
+﻿// Copyright (c) 2026 LazyDevelopers <lazydeveloper24@gmail.com>. All rights reserved.
+// This plugin is distributed under the Fab Standard License.
+//
+// This product was independently developed by us while participating in the Epic Project, a developer-support
+// program of the KRAFTON JUNGLE GameTech Lab. All rights, title, and interest in and to the product are exclusively
+// vested in us. Krafton, Inc. was not involved in its development and distribution and disclaims all representations
+// and warranties, express or implied, and assumes no responsibility or liability for any consequences arising from
+// the use of this product.
+
+
+// DebrisCollisionComponent.cpp
+
+#include "Components/DebrisCollisionComponent.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "PhysicsEngine/BoxElem.h"
+
+void UDebrisCollisionComponent::SetCompoundBoxes(const TArray<FKBoxElem>& Boxes)
+{
+	if (Boxes.Num() == 0)
+	{
+		if (CompoundBodySetup)
+		{
+			CompoundBodySetup = nullptr;
+			RecreatePhysicsState();
+		}
+		return;
+	}
+
+	if (!CompoundBodySetup)
+	{
+		CompoundBodySetup = NewObject<UBodySetup>(this, NAME_None, RF_Transient);
+		CompoundBodySetup->CollisionTraceFlag = CTF_UseSimpleAsComplex;
+		CompoundBodySetup->bGenerateMirroredCollision = false;
+		// Box는 Analytic Shape라 쿠킹 불필요
+		CompoundBodySetup->bNeverNeedsCookedCollisionData = true;
+	}
+
+	CompoundBodySetup->AggGeom.BoxElems = Boxes;
+	CompoundBodySetup->InvalidatePhysicsData();
+
+	// BodyInstance 설정(채널, 질량 오버라이드 등)은 그대로 두고 바디만 GetBodySetup() 기준으로 재생성
+	RecreatePhysicsState();
+}
+
+float UDebrisCollisionComponent::GetBodyVolume() const
+{
+	const FVector Scale = GetComponentTransform().GetScale3D().GetAbs();
+	const double ScaleVolume = Scale.X * Scale.Y * Scale.Z;
+
+	if (!CompoundBodySetup)
+	{
+		// 단일 박스 (BoxExtent는 반 크기)
+		return static_cast<float>(8.0 * BoxExtent.X * BoxExtent.Y * BoxExtent.Z * ScaleVolume);
+	}
+
+	// 병합 박스는 서로 겹치지 않으므로 단순 합이 실제 부피
+	double LocalVolume = 0.0;
+	for (const FKBoxElem& Box : CompoundBodySetup->AggGeom.BoxElems)
+	{
+		LocalVolume += static_cast<double>(Box.X) * Box.Y * Box.Z;
+	}
+	return static_cast<float>(LocalVolume * ScaleVolume);
+}
+
+UBodySetup* UDebrisCollisionComponent::GetBodySetup()
+{
+	if (CompoundBodySetup)
+	{
+		return CompoundBodySetup;
+	}
+	return Super::GetBodySetup();
+}
+
+void UDebrisCollisionComponent::UpdateBodySetup()
+{
+	// compound 사용 중에는 SetBoxExtent가 바디 지오메트리를 단일 박스로 덮어쓰지 않도록 막음
+	if (CompoundBodySetup)
+	{
+		return;
+	}
+	Super::UpdateBodySetup();
+}
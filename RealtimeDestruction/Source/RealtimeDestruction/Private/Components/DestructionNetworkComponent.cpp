@@ -11,12 +11,19 @@
 
 #include "Components/DestructionNetworkComponent.h"
 #include "Components/RealtimeDestructibleMeshComponent.h"
+#include "Actors/DebrisActor.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/PlayerState.h"
 #include "NetworkLogMacros.h"
 #include "Debug/DestructionDebugger.h"
 #include "HAL/PlatformTime.h"
 
+namespace
+{
+	/** 클라이언트/서버 간 Debris 위치 차이 허용치 (물리 복제 지연) */
+	constexpr float DebrisHitLocationTolerance = 100.0f;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // UDestructionNetworkComponent 구현
 //////////////////////////////////////////////////////////////////////////
@@ -64,14 +71,18 @@ void UDestructionNetworkComponent::RequestDestruction(
 	// 서버인 경우 서버 배칭에 추가
 	if (NetMode == NM_DedicatedServer || NetMode == NM_ListenServer)
 	{
+		// 셀 누적 데미지 판정 (판정 결과는 Op와 함께 클라이언트로 전파)
+		FRealtimeDestructionRequest ResolvedRequest = Request;
+		DestructComp->ResolveCellDamage(ResolvedRequest);
+
 		// 리슨서버만: 호스트 화면에 파괴 표시
 		if (NetMode == NM_ListenServer)
 		{
-			DestructComp->RequestDestruction(Request);
+			DestructComp->RequestDestruction(ResolvedRequest);
 		}
 
 		FRealtimeDestructionOp Op;
-		Op.Request = Request;
+		Op.Request = ResolvedRequest;
 
 		// 서버 배칭 사용 시 대기열에 추가
 		if (DestructComp->bUseServerBatching)
@@ -108,6 +119,8 @@ void UDestructionNetworkComponent::RequestDestruction(
 		if (UDestructionDebugger* Debugger = World->GetSubsystem<UDestructionDebugger>())
 		{
 			Debugger->RecordServerRPCWithSize(bUseCompactData);
+			Debugger->RecordEvent(EDestructionEventSource::ServerRPC, DestructComp, 0, 0.0f,
+				UDestructionDebugger::EstimateRPCBytes(1, bUseCompactData));
 		}
 
 		if (bUseCompactData)
@@ -132,6 +145,30 @@ void UDestructionNetworkComponent::RequestDestruction(
 	}
 }
 
+bool UDestructionNetworkComponent::RequestDebrisDestruction(ADebrisActor* Debris, const FCellDestructionShape& WorldShape)
+{
+	if (!Debris || Debris->IsActorBeingDestroyed())
+	{
+		return false;
+	}
+
+	// 서버/스탠드얼론: 바로 적용
+	if (Debris->HasAuthority())
+	{
+		return Debris->ApplyDestructionShape(WorldShape);
+	}
+
+	// 클라이언트 로컬 Debris는 서버가 알 수 없음
+	if (!Debris->GetIsReplicated())
+	{
+		return false;
+	}
+
+	// 클라이언트: 서버로 RPC 전송 (결과는 복제로 전파)
+	ServerApplyDebrisDestruction(Debris, WorldShape);
+	return true;
+}
+
 void UDestructionNetworkComponent::ServerApplyDestruction_Implementation(
 	URealtimeDestructibleMeshComponent* DestructComp,
 	const FRealtimeDestructionRequest& Request)
@@ -195,6 +232,9 @@ void UDestructionNetworkComponent::ServerApplyDestruction_Implementation(
 	//{
 	//	DestructComp->RequestDestruction(ModifiedRequest);
 	//} 
+	// 셀 누적 데미지 판정 (판정 결과는 Op와 함께 클라이언트로 전파)
+	DestructComp->ResolveCellDamage(ModifiedRequest);
+
 	if (World && (World->GetNetMode() == NM_ListenServer || World->GetNetMode() == NM_DedicatedServer))
 	{
 		DestructComp->RequestDestruction(ModifiedRequest);
@@ -291,6 +331,9 @@ void UDestructionNetworkComponent::ServerApplyDestructionCompact_Implementation(
 	//}
 
 	 // 서버에서 파괴 처리 (Listen Server + Dedicated Server 모두)
+	// 셀 누적 데미지 판정 (판정 결과는 Op와 함께 클라이언트로 전파)
+	DestructComp->ResolveCellDamage(Request);
+
 	if (World && (World->GetNetMode() == NM_ListenServer || World->GetNetMode() == NM_DedicatedServer))
 	{
 		DestructComp->RequestDestruction(Request);
@@ -330,7 +373,65 @@ void UDestructionNetworkComponent::ServerApplyDestructionCompact_Implementation(
 	}
 }
 
+void UDestructionNetworkComponent::ServerApplyDebrisDestruction_Implementation(
+	ADebrisActor* Debris,
+	const FCellDestructionShape& WorldShape)
+{
+	if (!Debris)
+	{
+		NET_LOG_COMPONENT_WARNING(this, "Debris가 null입니다");
+		return;
+	}
+
+	// 요청 검증
+	if (bEnableValidation && !ValidateDebrisDestructionRequest(Debris, WorldShape))
+	{
+		NET_LOG_COMPONENT_WARNING(this, "Debris 파괴 요청 검증 실패 - 요청 거부됨 (%s)", *Debris->GetName());
+		return;
+	}
+
+	Debris->ApplyDestructionShape(WorldShape);
+}
+
+void UDestructionNetworkComponent::ServerRequestCellResync_Implementation(
+	URealtimeDestructibleMeshComponent* DestructComp,
+	const TArray<int32>& RegionIds)
+{
+	if (!DestructComp || !DestructComp->bEnableCellStateChecksum || RegionIds.Num() == 0)
+	{
+		return;
+	}
+
+	// 연결별 쿨다운 (요청마다 영역 셀 전체를 보내므로 체크섬 간격보다 빠른 요청은 거부)
+	if (!DestructComp->CheckCellResyncCooldown(Cast<APlayerController>(GetOwner())))
+	{
+		return;
+	}
+
+	// 요청 크기 제한 (과도한 요청은 앞부분만 처리)
+	TArray<int32> ClampedRegionIds(RegionIds.GetData(),
+		FMath::Min(RegionIds.Num(), URealtimeDestructibleMeshComponent::MaxCellResyncRegionsPerRequest));
+
+	TArray<FReplicatedDetachedGroup> RegionCells;
+	DestructComp->BuildCellRegionResync(ClampedRegionIds, RegionCells);
+
+	NET_LOG_COMPONENT(this, "셀 재동기화 요청 처리: %d개 영역", ClampedRegionIds.Num());
+	ClientApplyCellResync(DestructComp, ClampedRegionIds, RegionCells);
+}
+
+void UDestructionNetworkComponent::ClientApplyCellResync_Implementation(
+	URealtimeDestructibleMeshComponent* DestructComp,
+	const TArray<int32>& RegionIds,
+	const TArray<FReplicatedDetachedGroup>& RegionCells)
+{
+	if (!DestructComp)
+	{
+		NET_LOG_COMPONENT_WARNING(this, "DestructComp가 null입니다 (CellResync)");
+		return;
+	}
 
+	DestructComp->ApplyCellRegionResync(RegionIds, RegionCells);
+}
 
 bool UDestructionNetworkComponent::ValidateDestructionRequest(
 	URealtimeDestructibleMeshComponent* DestructComp,
@@ -365,4 +466,36 @@ bool UDestructionNetworkComponent::ValidateDestructionRequest(
 	return true;
 }
 
+bool UDestructionNetworkComponent::ValidateDebrisDestructionRequest(
+	ADebrisActor* Debris,
+	const FCellDestructionShape& WorldShape) const
+{
+	if (!Debris || Debris->IsActorBeingDestroyed())
+	{
+		return false;
+	}
 
+	// 반경 검증 (원기둥 툴은 두께 있는 선분)
+	const float ShapeRadius = (WorldShape.Type == ECellDestructionShapeType::Line) ? WorldShape.LineThickness : WorldShape.Radius;
+	if (ShapeRadius <= 0.0f || ShapeRadius > MaxAllowedRadius)
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("DestructionNetworkComponent: Debris 파괴 반경(%.1f)이 허용 범위(0, %.1f]를 벗어남"),
+			ShapeRadius, MaxAllowedRadius);
+		return false;
+	}
+
+	// 형상이 Debris 범위에 닿는지 검증 (복제 지연만큼 여유)
+	const FBox Bounds = Debris->GetComponentsBoundingBox().ExpandBy(ShapeRadius + DebrisHitLocationTolerance);
+	const bool bReachesDebris = (WorldShape.Type == ECellDestructionShapeType::Line)
+		? FMath::LineBoxIntersection(Bounds, WorldShape.Center, WorldShape.EndPoint, WorldShape.EndPoint - WorldShape.Center)
+		: Bounds.IsInside(WorldShape.Center);
+	if (!bReachesDebris)
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("DestructionNetworkComponent: Debris 파괴 위치가 %s 범위를 벗어남"), *Debris->GetName());
+		return false;
+	}
+
+	return true;
+}
@@ -12,6 +12,7 @@
 #include "DebugConsoleVariables.h"
 #include "Components/RealtimeDestructibleMeshComponent.h"
 #include "Components/DestructionNetworkComponent.h"
+#include "Actors/DebrisActor.h"
 #include "Engine/GameInstance.h"
 #include "Components/PrimitiveComponent.h"
 #include "Components/DecalComponent.h"
@@ -174,6 +175,11 @@ void UDestructionProjectileComponent::ProcessProjectileHit(
 			bSuccess = ProcessDestructionRequestForChunk(DestructComp, Hit);
 		}
 	}
+	else if (ProcessDestructionRequestForDebris(OtherActor, MakeDebrisDestructionShape(Hit)))
+	{
+		// Debris에 충돌 - 셀 단위 2차 파괴
+		bSuccess = true;
+	}
 	else
 	{
 		// 파괴 불가능한 오브젝트에 충돌
@@ -208,7 +214,8 @@ bool UDestructionProjectileComponent::ProcessDestructionRequestForChunk(
 	
 	// ===== DataAsset에서 Tool Shape 로드 (메시 생성 전에!) =====
 	// ===== 절~~~~때 아래로 빼지마 
-	FName SurfaceTypeForShape = DestructComp->SurfaceType;
+	// 피격 셀에 구워둔 재질의 SurfaceType 사용 (없으면 컴포넌트 SurfaceType)
+	FName SurfaceTypeForShape = DestructComp->GetSurfaceTypeAt(Hit.ImpactPoint, Hit.ImpactNormal);
 	bool bHasDecalConfig = false;
 	FImpactProfileConfig OverrideDecalConfig;
  
@@ -310,6 +317,9 @@ bool UDestructionProjectileComponent::ProcessDestructionRequestForChunk(
 	APawn* InstigatorPawn = Owner->GetInstigator();
 	APlayerController* PC = InstigatorPawn ? Cast<APlayerController>(InstigatorPawn->GetController()) : nullptr;
 	UDestructionNetworkComponent* NetworkComp = PC ? PC->FindComponentByClass<UDestructionNetworkComponent>() : nullptr;
+
+	// 청크별 요청이 같은 타격임을 표시 (셀 데미지는 타격당 한 번만 누적)
+	const uint32 ShotId = URealtimeDestructibleMeshComponent::GenerateShotId();
 	for (int32 TargetIndex : Targets)
 	{
 		FRealtimeDestructionRequest Request;
@@ -339,9 +349,10 @@ bool UDestructionProjectileComponent::ProcessDestructionRequestForChunk(
 			Request.bSpawnDecal = false;
 		}
 		
-		FName SurfaceType = DestructComp->SurfaceType;
-		Request.SurfaceType = SurfaceType;
+		Request.SurfaceType = SurfaceTypeForShape;
 		Request.DecalConfigID = DecalConfigID;  // 네트워크 전송용
+		Request.Damage = CellDamage;
+		Request.ShotId = ShotId;
  
 		if (bHasDecalConfig)
 		{
@@ -353,6 +364,9 @@ bool UDestructionProjectileComponent::ProcessDestructionRequestForChunk(
 		}  
 
 		SetShapeParameters(Request);		
+
+		// 피격 셀 재질에 따른 툴 크기 보정
+		DestructComp->ApplyCellMaterialAttributes(Request);
 	
 		if (NetworkComp)
 		{
@@ -508,6 +522,7 @@ void UDestructionProjectileComponent::ProcessSphereDestructionRequestForChunk(UR
 
 	// 청크 루프 (Boolean Subtract)
 	bool bFirstChunk = true; 
+	const uint32 ShotId = URealtimeDestructibleMeshComponent::GenerateShotId();
 	
 	DrawDebugSphere(GetWorld(), ExplosionCenter, SphereRadius, 24, FColor::Red, true, -1.0f, 0, 3.0f);
 	DrawDebugPoint(GetWorld(), ExplosionCenter, 20.0f, FColor::Yellow, true, -1.0f); 
@@ -552,8 +567,11 @@ void UDestructionProjectileComponent::ProcessSphereDestructionRequestForChunk(UR
 		Request.bSpawnDecal = bFirstChunk;
 		bFirstChunk = false;
 
-		Request.SurfaceType = DestructComp->SurfaceType;
+		// 데칼은 데칼 위치 셀의 재질 기준 (폭발 반경은 재질로 보정하지 않음)
+		Request.SurfaceType = DestructComp->GetSurfaceTypeAt(DecalImpactPoint, DecalImpactNormal);
 		Request.DecalConfigID = DecalConfigID;
+		Request.Damage = CellDamage;
+		Request.ShotId = ShotId;
 		Request.ShapeParams.Radius = SphereRadius;
 		Request.ShapeParams.StepsPhi = SphereStepsPhi;
 		Request.ShapeParams.StepsTheta = SphereStepsTheta;
@@ -791,6 +809,45 @@ FVector UDestructionProjectileComponent::GetToolDirection(const FHitResult& Hit,
 	return Direction.GetSafeNormal();
 }
 
+bool UDestructionProjectileComponent::ProcessDestructionRequestForDebris(AActor* HitActor, const FCellDestructionShape& WorldShape)
+{
+	ADebrisActor* HitDebris = Cast<ADebrisActor>(HitActor);
+	if (!HitDebris)
+	{
+		return false;
+	}
+
+	AActor* Owner = GetOwner();
+	APawn* InstigatorPawn = Owner ? Owner->GetInstigator() : nullptr;
+	APlayerController* PC = InstigatorPawn ? Cast<APlayerController>(InstigatorPawn->GetController()) : nullptr;
+	UDestructionNetworkComponent* NetworkComp = PC ? PC->FindComponentByClass<UDestructionNetworkComponent>() : nullptr;
+
+	// NetworkComp가 서버/클라이언트 모두 처리 - 결과(새 Debris 스폰/삭제)는 복제로 클라이언트에 전파
+	if (NetworkComp)
+	{
+		return NetworkComp->RequestDebrisDestruction(HitDebris, WorldShape);
+	}
+
+	// NetworkComp가 없으면 서버 권한에서만 직접 적용
+	return HitDebris->ApplyDestructionShape(WorldShape);
+}
+
+FCellDestructionShape UDestructionProjectileComponent::MakeDebrisDestructionShape(const FHitResult& Hit) const
+{
+	// 원본 메시 요청과 같은 형상 (원기둥은 ToolDirection 방향의 두께 있는 선분)
+	FDestructionToolShapeParams Params;
+	if (ToolShape == EDestructionToolShape::Sphere)
+	{
+		Params.Radius = SphereRadius;
+	}
+	else
+	{
+		Params.Radius = CylinderRadius;
+		Params.Height = CylinderHeight;
+	}
+	return FCellDestructionShape::CreateFromToolShape(ToolShape, Params, Hit.ImpactPoint, GetToolDirection(Hit, GetOwner()));
+}
+
 void UDestructionProjectileComponent::RequestDestructionManual(const FHitResult& HitResult)
 {
 	if (!HitResult.GetActor())
@@ -910,7 +967,18 @@ void UDestructionProjectileComponent::RequestDestructionAtLocation(const FVector
 		URealtimeDestructibleMeshComponent* DestructComp =
 			HitActor->FindComponentByClass<URealtimeDestructibleMeshComponent>();
 
-		if (!DestructComp || ProcessedComps.Contains(DestructComp))
+		// 범위 안의 Debris도 2차 파괴
+		if (!DestructComp)
+		{
+			FCellDestructionShape SphereShape;
+			SphereShape.Type = ECellDestructionShapeType::Sphere;
+			SphereShape.Center = Center;
+			SphereShape.Radius = OverlapRadius;
+			ProcessDestructionRequestForDebris(HitActor, SphereShape);
+			continue;
+		}
+
+		if (ProcessedComps.Contains(DestructComp))
 		{
 			continue;
 		}
@@ -1063,7 +1131,8 @@ bool UDestructionProjectileComponent::BooleanSourceMesh(
 		return false;
 	}
 
-	FName SurfaceTypeForShape = DestructComp->SurfaceType;
+	// 피격 셀에 구워둔 재질의 SurfaceType 사용 (없으면 컴포넌트 SurfaceType)
+	FName SurfaceTypeForShape = DestructComp->GetSurfaceTypeAt(Hit.ImpactPoint, Hit.ImpactNormal);
 	bool bHasDecalConfig = false;
 	FImpactProfileConfig OverrideDecalConfig;
 
@@ -1110,9 +1179,10 @@ bool UDestructionProjectileComponent::BooleanSourceMesh(
 
 	Request.bSpawnDecal = false;
 
-	FName SurfaceType = DestructComp->SurfaceType;
-	Request.SurfaceType = SurfaceType;
+	Request.SurfaceType = SurfaceTypeForShape;
 	Request.DecalConfigID = DecalConfigID; // 네트워크 전송용
+	Request.Damage = CellDamage;
+	Request.ShotId = URealtimeDestructibleMeshComponent::GenerateShotId();
 
 	if (bHasDecalConfig)
 	{
@@ -1125,6 +1195,9 @@ bool UDestructionProjectileComponent::BooleanSourceMesh(
 
 	SetShapeParameters(Request);
 
+	// 피격 셀 재질에 따른 툴 크기 보정
+	DestructComp->ApplyCellMaterialAttributes(Request);
+
 	if (NetworkComp)
 	{
 		// NetworkComp가 서버/클라이언트/스탠드얼론 모두 처리
@@ -10,17 +10,20 @@
 #include "Components/RealtimeDestructibleMeshComponent.h"
 #include "TimerManager.h"
 #include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
 #include "DynamicMesh/DynamicMesh3.h"
 #include "DynamicMesh/DynamicMeshAttributeSet.h"
 #include "DynamicMeshEditor.h"
 #include "MeshBoundaryLoops.h"
 #include "Operations/SimpleHoleFiller.h"
 #include "Materials/MaterialInstanceDynamic.h"
+#include "Algo/BinarySearch.h"
 #include "Algo/Sort.h"
 #include <algorithm> // std::lower_bound
 #include "Engine/World.h"
 #include "Actors/DebrisActor.h"
 #include "Components/BoxComponent.h"
+#include "Components/DebrisCollisionComponent.h"
 
 #include "DynamicMesh/MeshNormals.h" 
 #include "DrawDebugHelpers.h"
@@ -65,6 +68,7 @@
 #include "Engine/GameInstance.h"
 #include "Engine/Engine.h"
 #include "Subsystems/DestructionGameInstanceSubsystem.h"
+#include "Subsystems/DebrisManagerSubsystem.h"
 
 //////////////////////////////////////////////////////////////////////////
 // FCompactDestructionOp 구현 (언리얼 내장 NetQuantize 사용)
@@ -99,9 +103,81 @@ FCompactDestructionOp FCompactDestructionOp::Compress(const FRealtimeDestruction
 	Compact.DecalSize = Request.DecalSize;
 	Compact.DecalConfigID = Request.DecalConfigID;
 	Compact.SurfaceType = Request.SurfaceType;
+
+	// 셀 누적 데미지 (정수 단위) 및 서버 판정 결과
+	Compact.Damage = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(Request.Damage), 0, static_cast<int32>(MAX_uint16)));
+	Compact.bDecalOnly = Request.bDecalOnly;
+	Compact.ShotId = static_cast<uint16>(Request.ShotId);
 	return Compact;
 }
 
+FReplicatedDetachedGroup FReplicatedDetachedGroup::Encode(const TArray<int32>& CellIds)
+{
+	FReplicatedDetachedGroup Encoded;
+	if (CellIds.Num() == 0)
+	{
+		return Encoded;
+	}
+
+	TArray<int32> Sorted = CellIds;
+	Sorted.Sort();
+
+	int32 RunStart = Sorted[0];
+	int32 RunLength = 1;
+	for (int32 i = 1; i <= Sorted.Num(); ++i)
+	{
+		// 연속 구간 유지 (중복 ID는 무시, uint16 범위를 넘으면 구간 분리)
+		if (i < Sorted.Num())
+		{
+			const int32 CellId = Sorted[i];
+			if (CellId == RunStart + RunLength - 1)
+			{
+				continue;
+			}
+			if (CellId == RunStart + RunLength && RunLength < MAX_uint16)
+			{
+				++RunLength;
+				continue;
+			}
+		}
+
+		Encoded.RangeStarts.Add(RunStart);
+		Encoded.RangeLengths.Add(static_cast<uint16>(RunLength));
+
+		if (i < Sorted.Num())
+		{
+			RunStart = Sorted[i];
+			RunLength = 1;
+		}
+	}
+
+	return Encoded;
+}
+
+void FReplicatedDetachedGroup::Decode(TArray<int32>& OutCellIds) const
+{
+	OutCellIds.Reset(NumCells());
+
+	const int32 NumRanges = FMath::Min(RangeStarts.Num(), RangeLengths.Num());
+	for (int32 i = 0; i < NumRanges; ++i)
+	{
+		for (int32 Offset = 0; Offset < RangeLengths[i]; ++Offset)
+		{
+			OutCellIds.Add(RangeStarts[i] + Offset);
+		}
+	}
+}
+
+int32 FReplicatedDetachedGroup::NumCells() const
+{
+	int32 Count = 0;
+	for (uint16 Length : RangeLengths)
+	{
+		Count += Length;
+	}
+	return Count;
+}
+
 FRealtimeDestructionRequest FCompactDestructionOp::Decompress() const
 {
 	FRealtimeDestructionRequest Request;
@@ -152,6 +228,10 @@ FRealtimeDestructionRequest FCompactDestructionOp::Decompress() const
 	Request.SurfaceType = SurfaceType;
 	Request.bSpawnDecal = true;  // 네트워크 요청은 기본적으로 데칼 생성
 
+	Request.Damage = static_cast<float>(Damage);
+	Request.bDecalOnly = bDecalOnly;
+	Request.ShotId = ShotId;
+
 	return Request;
 }
 
@@ -166,10 +246,14 @@ FRealtimeDestructionRequest FCompactDestructionOp::Decompress() const
 #include "Engine/StaticMesh.h"
 #include "Materials/MaterialInterface.h"
 #include "Debug/DestructionDebugger.h"
+#include "Components/DestructionNetworkComponent.h"
 #include "HAL/PlatformTime.h"
 #include "BooleanProcessor/RealtimeBooleanProcessor.h"
 #include "Components/DecalComponent.h"
 #include "StructuralIntegrity/GridCellBuilder.h"
+#include "Async/ParallelFor.h"
+#include "Async/Async.h"
+#include "Tasks/Task.h"
 #include <Selection/MeshTopologySelectionMechanic.h>
 
 URealtimeDestructibleMeshComponent::URealtimeDestructibleMeshComponent()
@@ -330,6 +414,86 @@ int32 URealtimeDestructibleMeshComponent::EnqueueBatch(const TArray<FRealtimeDes
 	return AddedCount;
 }
 
+int32 URealtimeDestructibleMeshComponent::EnqueueBulk(const FRealtimeDestructionBulkRequest& InBulk)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE("EnqueueBulk")
+
+	if (!InBulk.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[EnqueueBulk] SoA 배열 길이가 일치하지 않거나 ShapeId가 팔레트 범위를 벗어남"));
+		return 0;
+	}
+
+	// Bulk 경로는 서버 배치(멀티캐스트/연산 기록/Late Join)를 거치지 않으므로 네트워크 게임에서는 거부
+	if (!ensureMsgf(GetNetMode() == NM_Standalone, TEXT("EnqueueBulk is standalone only; use RequestDestruction in networked games")))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[EnqueueBulk] Standalone 전용 - 네트워크 게임에서는 RequestDestruction 사용 (NetMode=%d, Items=%d)"),
+			static_cast<int32>(GetNetMode()), InBulk.Num());
+		return 0;
+	}
+
+	if (InBulk.Num() == 0)
+	{
+		return 0;
+	}
+
+	// 셀 누적 데미지: 임계치를 넘지 못한 항목은 절삭하지 않음 (Bulk 경로는 데칼 없음)
+	const bool bResolveDamage = bEnableCellDamage && InBulk.Damages.Num() > 0
+		&& GridCellLayout.IsValid() && GetOwner() && GetOwner()->HasAuthority();
+	FRealtimeDestructionBulkRequest CutBulk;
+	if (bResolveDamage)
+	{
+		CutBulk.ToolShapes = InBulk.ToolShapes;
+		CutBulk.ShapeParams = InBulk.ShapeParams;
+		CutBulk.bIsPenetration = InBulk.bIsPenetration;
+		CutBulk.Reserve(InBulk.Num());
+	}
+
+	// 요청 구조체 없이 Shape를 직접 만들어 Cell 상태 갱신
+	for (int32 i = 0; i < InBulk.Num(); ++i)
+	{
+		const uint8 ShapeId = InBulk.ShapeIds[i];
+
+		const FCellDestructionShape Shape = FCellDestructionShape::CreateFromToolShape(
+			InBulk.ToolShapes[ShapeId], InBulk.ShapeParams[ShapeId], InBulk.ImpactPoints[i], InBulk.ToolForwardVectors[i]);
+
+		if (bResolveDamage)
+		{
+			if (InBulk.Damages[i] > 0.0f && !ApplyCellDamage(Shape, InBulk.Damages[i]))
+			{
+				continue;
+			}
+			CutBulk.Add(InBulk.ImpactPoints[i], InBulk.ToolForwardVectors[i], ShapeId);
+		}
+
+		PendingDestructionResults.Add(DestructionLogic(Shape));
+	}
+
+	const FRealtimeDestructionBulkRequest& Bulk = bResolveDamage ? CutBulk : InBulk;
+	if (Bulk.Num() == 0)
+	{
+		return 0;
+	}
+
+	CachedToolForwardVector = Bulk.ToolForwardVectors.Last();
+
+	if (!BooleanProcessor.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Boolean Processor is null"));
+		return 0;
+	}
+
+	// 팔레트 항목별 툴 메시는 한 번만 생성하고 이후 호출에서 재사용 (워커는 읽기 전용으로 복사해서 사용)
+	TArray<TSharedPtr<FDynamicMesh3, ESPMode::ThreadSafe>, TInlineAllocator<8>> ShapeToolMeshes;
+	ShapeToolMeshes.Reserve(Bulk.ToolShapes.Num());
+	for (int32 ShapeId = 0; ShapeId < Bulk.ToolShapes.Num(); ++ShapeId)
+	{
+		ShapeToolMeshes.Add(GetCachedToolMesh(Bulk.ToolShapes[ShapeId], Bulk.ShapeParams[ShapeId]));
+	}
+
+	return BooleanProcessor->EnqueueBulk(Bulk, ShapeToolMeshes);
+}
+
 // Projectile에서 호출해줌
 bool URealtimeDestructibleMeshComponent::RequestDestruction(const FRealtimeDestructionRequest& Request)
 {
@@ -339,13 +503,17 @@ bool URealtimeDestructibleMeshComponent::RequestDestruction(const FRealtimeDestr
 		return false;
 	}
 
-	// 서버에서만 Cluetering 등록
-	if (bEnableClustering && BulletClusterComponent && GetOwner()->HasAuthority())
+	// 셀 누적 데미지 판정 (네트워크 경로에서 이미 판정된 요청은 그대로 통과)
+	FRealtimeDestructionRequest ResolvedRequest = Request;
+	ResolveCellDamage(ResolvedRequest);
+
+	// 서버에서만 Cluetering 등록 (데칼만 남는 타격은 클러스터에 합치지 않음)
+	if (bEnableClustering && BulletClusterComponent && GetOwner()->HasAuthority() && !ResolvedRequest.bDecalOnly)
 	{
-		BulletClusterComponent->RegisterRequest(Request); 
+		BulletClusterComponent->RegisterRequest(ResolvedRequest); 
 	}
 	
-	return ExecuteDestructionInternal(Request);
+	return ExecuteDestructionInternal(ResolvedRequest);
 }
 
 bool URealtimeDestructibleMeshComponent::ExecuteDestructionInternal(const FRealtimeDestructionRequest& Request)
@@ -355,6 +523,16 @@ bool URealtimeDestructibleMeshComponent::ExecuteDestructionInternal(const FRealt
 	// 벽 무너지는거 자연스럽게 하기 위해 forward를 캐싱해놓기
 	CachedToolForwardVector = Request.ToolForwardVector;
 
+	// 임계치를 넘은 셀이 없는 타격은 데칼만 남김 (셀 파괴, Boolean 연산 없음)
+	if (Request.bDecalOnly)
+	{
+		if (!IsRunningDedicatedServer())
+		{
+			SpawnTemporaryDecal(Request);
+		}
+		return true;
+	}
+
 	// 데디케이티드 서버에서는 Boolean 연산 스킵 (시각적 처리 불필요)
 	// Cell 상태만 업데이트하고 콜리전 갱신은 별도 처리
 	if (IsRunningDedicatedServer())
@@ -380,6 +558,98 @@ bool URealtimeDestructibleMeshComponent::ExecuteDestructionInternal(const FRealt
 	return true;
 }
 
+void URealtimeDestructibleMeshComponent::ResolveCellDamage(FRealtimeDestructionRequest& InOutRequest)
+{
+	// 누적 데미지 비활성화, 이미 판정된 요청, 데미지 미지정(즉시 절삭) 요청은 그대로 통과
+	if (!bEnableCellDamage || InOutRequest.bDecalOnly || InOutRequest.Damage <= 0.0f || !GridCellLayout.IsValid())
+	{
+		return;
+	}
+
+	// 판정은 서버만 (클라이언트는 서버가 판정한 Op를 받아 적용하므로 로컬 누적 데미지를 만들지 않음)
+	const AActor* Owner = GetOwner();
+	if (!Owner || !Owner->HasAuthority())
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE("CellDamage_Resolve");
+
+	// 한 타격이 청크별 요청으로 나뉘어 들어오므로 같은 ShotId의 타격은 한 번만 누적하고 판정 공유
+	// (ShotId는 압축 전송 시 16비트로 잘리므로 충돌 방지를 위해 피격 지점도 비교)
+	if (InOutRequest.ShotId != 0)
+	{
+		for (const FResolvedCellDamageShot& Shot : RecentCellDamageShots)
+		{
+			if (Shot.ShotId == InOutRequest.ShotId && InOutRequest.ImpactPoint.Equals(Shot.ImpactPoint, 1.0))
+			{
+				InOutRequest.bDecalOnly = Shot.bDecalOnly;
+				InOutRequest.Damage = 0.0f;
+				return;
+			}
+		}
+	}
+
+	InOutRequest.bDecalOnly = !ApplyCellDamage(FCellDestructionShape::CreateFromRequest(InOutRequest), InOutRequest.Damage);
+
+	if (InOutRequest.ShotId != 0)
+	{
+		if (RecentCellDamageShots.Num() >= 16)
+		{
+			RecentCellDamageShots.RemoveAt(0, 1, EAllowShrinking::No);
+		}
+		RecentCellDamageShots.Add({ InOutRequest.ShotId, InOutRequest.ImpactPoint, InOutRequest.bDecalOnly });
+	}
+
+	// 데미지는 한 번만 누적 (재판정 방지)
+	InOutRequest.Damage = 0.0f;
+}
+
+bool URealtimeDestructibleMeshComponent::ApplyCellDamage(const FCellDestructionShape& Shape, float Damage)
+{
+	const FQuantizedDestructionInput QuantizedInput = FQuantizedDestructionInput::FromDestructionShape(Shape);
+	const FTransform& MeshTransform = GetComponentTransform();
+	const int32 TotalCells = GridCellLayout.GetTotalCellCount();
+
+	// 툴 형상과 겹치는 살아있는 셀에 데미지 누적 (RegisterDecalToCells와 동일한 후보 탐색)
+	int32 DamagedCellCount = 0;
+	bool bAnyCellBroken = false;
+	for (int32 CellId : GridCellLayout.GetCellsInAABB(Shape.GetBounds(), MeshTransform))
+	{
+		if (!GridCellLayout.GetCellExists(CellId) || CellState.DestroyedCells.Contains(CellId))
+		{
+			continue;
+		}
+
+		if (!QuantizedInput.IntersectsOBB(GridCellLayout.GetCellWorldOBB(CellId, MeshTransform)))
+		{
+			continue;
+		}
+
+		// 셀 재질 강도만큼 체력 보정
+		++DamagedCellCount;
+		if (CellState.AddCellDamage(CellId, Damage, TotalCells) >= CellHealth * GetCellStrength(CellId))
+		{
+			bAnyCellBroken = true;
+		}
+	}
+
+	// 셀에 닿지 않은 타격(그리드 밖 표면 등)은 기존처럼 절삭
+	return DamagedCellCount == 0 || bAnyCellBroken;
+}
+
+uint32 URealtimeDestructibleMeshComponent::GenerateShotId()
+{
+	// 머신마다 다른 시작값에서 증가 (0은 'ShotId 없음'이므로 건너뜀)
+	static std::atomic<uint32> NextShotId{ FPlatformTime::Cycles() };
+	uint32 ShotId = NextShotId.fetch_add(1, std::memory_order_relaxed);
+	if (ShotId == 0)
+	{
+		ShotId = NextShotId.fetch_add(1, std::memory_order_relaxed);
+	}
+	return ShotId;
+}
+
 //=============================================================================
 // Cell 상태 업데이트
 //=============================================================================
@@ -407,14 +677,17 @@ void URealtimeDestructibleMeshComponent::UpdateCellStateFromDestruction(const FR
 }
 
 FDestructionResult URealtimeDestructibleMeshComponent::DestructionLogic(const FRealtimeDestructionRequest& Request)
+{
+	// Request를 FDestructionShape로 변환
+	return DestructionLogic(FCellDestructionShape::CreateFromRequest(Request));
+}
+
+FDestructionResult URealtimeDestructibleMeshComponent::DestructionLogic(const FCellDestructionShape& Shape)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_DestructionLogic);
 
 	FDestructionResult DestructionResult;
 
-	// Request를 FDestructionShape로 변환
-	FCellDestructionShape Shape = FCellDestructionShape::CreateFromRequest(Request);
-
 	// 양자화된 입력 생성
 	FQuantizedDestructionInput QuantizedInput = FQuantizedDestructionInput::FromDestructionShape(Shape);
 
@@ -445,6 +718,11 @@ FDestructionResult URealtimeDestructibleMeshComponent::DestructionLogic(const FR
 		return DestructionResult; // 파괴 없음
 		}
 
+	if (UDestructionDebugger* Debugger = GetWorld() ? GetWorld()->GetSubsystem<UDestructionDebugger>() : nullptr)
+	{
+		Debugger->RecordEvent(EDestructionEventSource::Request, this, DestructionResult.NewlyDestroyedCells.Num());
+	}
+
 	// 가장 최근 파괴된 셀 디버그 시각화를 위한 정보 갱신
 	if (DestructionResult.NewlyDestroyedCells.Num() > 0)
 	{
@@ -702,103 +980,7 @@ void URealtimeDestructibleMeshComponent::DisconnectedCellStateLogic(const TArray
 
 	if (DisconnectedCells.Num() > 0)
 	{
-		//=====================================================================
-		// Phase 3: 분리된 셀 그룹화
-		//=====================================================================
-		TArray<TArray<int32>> NewDetachedGroups;
-		{
-			TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_Phase3); 
-			NewDetachedGroups = FCellDestructionSystem::GroupDetachedCells(
-				GridCellLayout,
-				DisconnectedCells,
-				CellState.DestroyedCells);
-		}
-		for (const TArray<int32>& Group : NewDetachedGroups)
-		{
-			CellState.AddDetachedGroup(Group);
-		}
-
-		//=====================================================================
-		// Phase 4: 서버 → 클라이언트 신호 전송 (서버에서만)
-		//=====================================================================
-		// 클라이언트에게 Detach 발생 신호만 전송 (클라이언트가 자체 BFS 실행)
-
-		// 분리된 셀의 삼각형 삭제 (데디서버: 렌더링 불필요, Cell Box만 업데이트)
- 		{  
-			const ENetMode NetMode = GetWorld() ? GetWorld()->GetNetMode() : NM_Standalone;
-			const bool bIsDedicatedServerClient = bServerIsDedicatedServer && !GetOwner()->HasAuthority();
-
-			TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_Phase4);
-
-			// dedicated server는 메시 연산없이 메타 데이터만으로 actor 스폰
-			if (NetMode == NM_DedicatedServer)
-			{
-				for (const TArray<int32>& Group : NewDetachedGroups)
-				{
-					SpawnDebrisActorForDedicatedServer(Group);
-				}
-			} 
-			else if (bIsDedicatedServerClient)
-			{
-				// 크기가 작은 debris만 클라이언트가 자체 생성
-				for (const TArray<int32>& Group : NewDetachedGroups)
-				{
-					float DebrisSize = CalculateDebrisBoundsExtent(Group);  // 헬퍼 함수 필요
-					if (DebrisSize < MinDebrisSyncSize)
-					{
-						RemoveTrianglesForDetachedCells(Group);
-					}
-					// else: 큰 것은 서버에서 복제된 DebrisActor가 처리
-
-				}
-			}
-			else
-			{
-				for (const TArray<int32>& Group : NewDetachedGroups)
-				{
-					RemoveTrianglesForDetachedCells(Group);
-				}
-			}
-
-			// Cleanup은 IslandRemoval 완료 콜백에서 처리 (비동기)
-			// FIslandRemovalContext::DisconnectedCellsForCleanup 사용
-		}
-		CellState.MoveAllDetachedToDestroyed();
-
-		// 서버 Cell Collision: 분리된 셀들의 청크도 dirty 마킹
-		if (bServerCellCollisionInitialized)
-		{
-			TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_MarkCollisionChunkDirty);
-
-			TSet<int32> DetachedDirtyChunks;
-			for (int32 CellId : DisconnectedCells)
-			{
-				int32 ChunkIdx = GetCollisionChunkIndexForCell(CellId);
-				if (ChunkIdx != INDEX_NONE)
-				{
-					DetachedDirtyChunks.Add(ChunkIdx);
-				}
-				// 이웃 셀 청크도 dirty (새 표면 될 수 있음)
-				const FIntArray& Neighbors = GridCellLayout.GetCellNeighbors(CellId);
-				for (int32 NeighborId : Neighbors.Values)
-				{
-					int32 NeighborChunkIdx = GetCollisionChunkIndexForCell(NeighborId);
-					if (NeighborChunkIdx != INDEX_NONE)
-					{
-						DetachedDirtyChunks.Add(NeighborChunkIdx);
-					}
-				}
-			}
-			for (int32 ChunkIdx : DetachedDirtyChunks)
-			{
-				MarkCollisionChunkDirty(ChunkIdx);
-			}
-			UE_LOG(LogTemp, Log, TEXT("[ServerCellCollision] Marked %d chunks dirty from %d detached cells"),
-				DetachedDirtyChunks.Num(), DisconnectedCells.Num());
-		}
-
-		UE_LOG(LogTemp, Log, TEXT("UpdateCellStateFromDestruction [Server]: %d cells disconnected (%d groups)"),
-		       DisconnectedCells.Num(), NewDetachedGroups.Num());
+		HandleDisconnectedCells(DisconnectedCells);
 	}
 	else
 	{
@@ -831,6 +1013,24 @@ void URealtimeDestructibleMeshComponent::DisconnectedCellStateLogic(const TArray
 	UE_LOG(LogTemp, Log, TEXT("UpdateCellStateFromDestruction Complete: Destroyed=%d, DetachedGroups=%d"),
 		CellState.DestroyedCells.Num(), CellState.DetachedGroups.Num());
 
+	// 직접 파괴된 셀 중 다른 메시를 받치던 셀 전달 (분리 셀은 HandleDisconnectedCells에서 전달)
+	if (SupportWatchedCells.Num() > 0)
+	{
+		TArray<int32> NewlyDestroyedCells;
+		for (const FDestructionResult& Result : AllResults)
+		{
+			NewlyDestroyedCells.Append(Result.NewlyDestroyedCells);
+		}
+		NotifySupportedComponents(NewlyDestroyedCells);
+	}
+
+	// 바뀐 셀의 슈퍼셀만 하중 재계산 (분리 셀은 HandleDisconnectedCells에서 전달)
+	for (const FDestructionResult& Result : AllResults)
+	{
+		LoadSolver.MarkCellsDirty(GridCellLayout, SupercellState, Result.NewlyDestroyedCells);
+		LoadSolver.MarkCellsDirty(GridCellLayout, SupercellState, Result.AffectedCells);
+	}
+
 	// Late Join용: 현재 파괴 셀 상태 스냅샷 갱신 (서버에서만)
 	if (GetOwner() && GetOwner()->HasAuthority())
 	{
@@ -843,301 +1043,1109 @@ void URealtimeDestructibleMeshComponent::DisconnectedCellStateLogic(const TArray
 #endif
 }
 
-float URealtimeDestructibleMeshComponent::CalculateDebrisBoundsExtent(const TArray<int32>& CellIds) const
+void URealtimeDestructibleMeshComponent::HandleDisconnectedCells(const TSet<int32>& DisconnectedCells)
 {
-	if (CellIds.Num() == 0)
+	//=====================================================================
+	// Phase 3: 분리된 셀 그룹화
+	//=====================================================================
+	TArray<TArray<int32>> NewDetachedGroups;
 	{
-		return 0.0f;
+		TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_Phase3); 
+		NewDetachedGroups = FCellDestructionSystem::GroupDetachedCells(
+			GridCellLayout,
+			DisconnectedCells,
+			CellState.DestroyedCells);
 	}
-
-	FBox CellBounds(ForceInit);
-	for (int32 CellId : CellIds)
+	for (const TArray<int32>& Group : NewDetachedGroups)
 	{
-		FVector CellMin = GridCellLayout.IdToLocalMin(CellId);
-		FVector CellMax = CellMin + GridCellLayout.CellSize;
-		CellBounds += CellMin;
-		CellBounds += CellMax;
+		CellState.AddDetachedGroup(Group);
 	}
 
-	FVector BoxExtent = CellBounds.GetExtent();
-	BoxExtent *= GetComponentTransform().GetScale3D(); 
-
-	return BoxExtent.GetMax();
-}
-void URealtimeDestructibleMeshComponent::ForceRemoveSupercell(int32 SuperCellId)
-{
-	TRACE_CPUPROFILER_EVENT_SCOPE(Debris_ForceRemoveSupercell);
-	// alive cell 수집
-	TArray<int32> AllCellsInSupercell;
-	SupercellState.GetCellsInSupercell(SuperCellId, GridCellLayout, AllCellsInSupercell);
-
-	TArray<int32> AliveCells;
-	for (int32 CellId : AllCellsInSupercell)
+	//=====================================================================
+	// Phase 4: 서버 → 클라이언트 신호 전송 (서버에서만)
+	//=====================================================================
+	// 서버가 계산한 그룹을 그대로 복제 (다음 FlushServerBatch의 MulticastDetachSignal로 전송)
+	// 클라이언트는 BFS 없이 적용하므로 서버와 항상 같은 결과
+	if (GetOwner() && GetOwner()->HasAuthority() && GetWorld() && GetWorld()->GetNetMode() != NM_Standalone)
 	{
-		if (!CellState.DestroyedCells.Contains(CellId))
+		for (const TArray<int32>& Group : NewDetachedGroups)
 		{
-			AliveCells.Add(CellId);
+			PendingReplicatedDetachGroups.Add(FReplicatedDetachedGroup::Encode(Group));
 		}
 	}
 
-	if (AliveCells.Num() == 0) return;
-	
+	// 분리된 셀의 삼각형 삭제 (데디서버: 렌더링 불필요, Cell Box만 업데이트)
+ 		{  
+		const ENetMode NetMode = GetWorld() ? GetWorld()->GetNetMode() : NM_Standalone;
+		const bool bIsDedicatedServerClient = bServerIsDedicatedServer && !GetOwner()->HasAuthority();
 
-	// 렌더링 처리 (Dedicated Server는 패스) 
-	// ToolMesh(smoothed + DebrisExpandRatio) 형상과 겹치는 cell도 함께 수집
-	const bool bIsDedicatedServer = GetWorld() && GetWorld()->GetNetMode() == NM_DedicatedServer;
-	const bool bIsDedicatedServerClient = bServerIsDedicatedServer && !GetOwner()->HasAuthority();
-	
-	TArray<int32> ToolMeshOverlappingCells;
-	 
-	if (bIsDedicatedServer)
-	{
-		SpawnDebrisActorForDedicatedServer(AllCellsInSupercell);
-		CollectToolMeshOverlappingCells(AllCellsInSupercell, ToolMeshOverlappingCells);
-	}
-	else if (bIsDedicatedServerClient)
-	{
-		float DebrisSize = CalculateDebrisBoundsExtent(AllCellsInSupercell);
-		if (DebrisSize < MinDebrisSyncSize)
+		TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_Phase4);
+
+		// dedicated server는 메시 연산없이 메타 데이터만으로 actor 스폰
+		if (NetMode == NM_DedicatedServer)
 		{
-			// 작은 debris: 클라이언트가 자체 boolean + cell 수집
-			RemoveTrianglesForDetachedCells(AllCellsInSupercell, nullptr, &ToolMeshOverlappingCells);
+			// 한 번의 분리로 생긴 모든 Debris를 하나의 이벤트로 묶음 (클라이언트 배치 추출용)
+			TArray<ADebrisActor*> EventActors;
+			for (const TArray<int32>& Group : NewDetachedGroups)
+			{
+				SpawnDebrisActorForDedicatedServer(Group, &EventActors);
+			}
+			AssignDetachEvent(EventActors);
+		} 
+		else if (bIsDedicatedServerClient)
+		{
+			// 크기가 작은 debris만 클라이언트가 자체 생성
+			for (const TArray<int32>& Group : NewDetachedGroups)
+			{
+				float DebrisSize = CalculateDebrisBoundsExtent(Group);  // 헬퍼 함수 필요
+				if (DebrisSize < MinDebrisSyncSize)
+				{
+					RemoveTrianglesForDetachedCells(Group);
+				}
+				// else: 큰 것은 서버에서 복제된 DebrisActor가 처리
+
+			}
 		}
 		else
 		{
-			// 큰 debris: 서버 DebrisActor가 boolean 처리, cell 수집만 수행
-			CollectToolMeshOverlappingCells(AllCellsInSupercell, ToolMeshOverlappingCells);
+			for (const TArray<int32>& Group : NewDetachedGroups)
+			{
+				RemoveTrianglesForDetachedCells(Group);
+			}
 		}
-	}
-	else
-	{
-		RemoveTrianglesForDetachedCells(AllCellsInSupercell, nullptr, &ToolMeshOverlappingCells);
+
 		// Cleanup은 IslandRemoval 완료 콜백에서 처리 (비동기)
+		// FIslandRemovalContext::DisconnectedCellsForCleanup 사용
 	}
+	CellState.MoveAllDetachedToDestroyed();
+	LoadSolver.MarkCellsDirty(GridCellLayout, SupercellState, DisconnectedCells.Array());
 
-	// Supercell 삭제하면서 이웃 Supercell의 cell에 영향을 끼칠 수 있음, 
-	// 이웃 supercell에 삭제된게 있으면 업데이트를 해준다. 
-	if (ToolMeshOverlappingCells.Num() > 0)
+	// 서버 Cell Collision: 분리된 셀들의 청크도 dirty 마킹
+	if (bServerCellCollisionInitialized)
 	{
-		// 원본 supercell cell과 합치기 (AddUnique로 수집했으므로 중복 없음)
-		TSet<int32> OriginalCellSet(AllCellsInSupercell);
-		for (int32 CellId : ToolMeshOverlappingCells)
+		TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_MarkCollisionChunkDirty);
+
+		TSet<int32> DetachedDirtyChunks;
+		for (int32 CellId : DisconnectedCells)
 		{
-			if (!OriginalCellSet.Contains(CellId))
+			int32 ChunkIdx = GetCollisionChunkIndexForCell(CellId);
+			if (ChunkIdx != INDEX_NONE)
 			{
-				AllCellsInSupercell.Add(CellId);
-
-				// 인접 supercell의 DestroyedCellCount 업데이트
-				if (bEnableSupercell && SupercellState.IsValid())
+				DetachedDirtyChunks.Add(ChunkIdx);
+			}
+			// 이웃 셀 청크도 dirty (새 표면 될 수 있음)
+			const FIntArray& Neighbors = GridCellLayout.GetCellNeighbors(CellId);
+			for (int32 NeighborId : Neighbors.Values)
+			{
+				int32 NeighborChunkIdx = GetCollisionChunkIndexForCell(NeighborId);
+				if (NeighborChunkIdx != INDEX_NONE)
 				{
-					const int32 NeighborSCId = SupercellState.GetSupercellForCell(CellId);
-					if (NeighborSCId != INDEX_NONE && NeighborSCId != SuperCellId &&
-						SupercellState.DestroyedCellCounts.IsValidIndex(NeighborSCId))
-					{
-						SupercellState.DestroyedCellCounts[NeighborSCId]++;
-					}
+					DetachedDirtyChunks.Add(NeighborChunkIdx);
 				}
 			}
 		}
+		for (int32 ChunkIdx : DetachedDirtyChunks)
+		{
+			MarkCollisionChunkDirty(ChunkIdx);
+		}
+		UE_LOG(LogTemp, Log, TEXT("[ServerCellCollision] Marked %d chunks dirty from %d detached cells"),
+			DetachedDirtyChunks.Num(), DisconnectedCells.Num());
 	}
-	CellState.DestroyCells(AllCellsInSupercell);
 
-	// hit count 리셋
-	SupercellState.MarkSupercellBroken(SuperCellId);
+	UE_LOG(LogTemp, Log, TEXT("UpdateCellStateFromDestruction [Server]: %d cells disconnected (%d groups)"),
+	       DisconnectedCells.Num(), NewDetachedGroups.Num());
 
-	if (SupercellState.DestroyedCellCounts.IsValidIndex(SuperCellId))
+	if (UDestructionDebugger* Debugger = GetWorld() ? GetWorld()->GetSubsystem<UDestructionDebugger>() : nullptr)
 	{
-		SupercellState.DestroyedCellCounts[SuperCellId] = 0;
-		SupercellState.InitialValidCellCounts[SuperCellId] = 0;
+		Debugger->RecordEvent(EDestructionEventSource::Detach, this, DisconnectedCells.Num());
 	}
 
-	// 파편 정리 예약
-	bPendingCleanup = true;
+	// 이 메시에 올려진 메시의 접촉 셀 재검사
+	if (SupportWatchedCells.Num() > 0)
+	{
+		NotifySupportedComponents(DisconnectedCells.Array());
+	}
 }
 
-void URealtimeDestructibleMeshComponent::MulticastForceRemoveSupercell_Implementation(int32 SuperCellId)
+void URealtimeDestructibleMeshComponent::TickLoadCollapse()
 {
-	// DedicatedServer는 Pass 
-	if (GetWorld() && GetWorld()->GetNetMode() == NM_DedicatedServer)
+	TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_TickLoadCollapse);
+
+	if (!LoadSolver.IsBusy())
 	{
 		return;
 	}
-	
-	// 서버는 로컬에서 처리함
-	if (GetOwner() && GetOwner()->HasAuthority())
+
+	// 셀 질량 = 셀 부피(cm^3 -> m^3) * 밀도
+	const FTransform& MeshTransform = GetComponentTransform();
+	const FVector CellSize = GridCellLayout.CellSize * MeshTransform.GetScale3D().GetAbs();
+	FStructuralLoadSettings Settings;
+	Settings.CellMass = static_cast<float>(CellSize.X * CellSize.Y * CellSize.Z * 1.0e-6) * LoadCellDensity;
+	Settings.VerticalLinkCapacity = LoadVerticalLinkCapacity;
+	Settings.LateralLinkCapacity = LoadLateralLinkCapacity;
+
+	// 중력 방향은 컴포넌트 회전 기준 (기울거나 눕힌 메시도 월드 아래 방향 링크가 수직 하중을 받음)
+	Settings.AxisGravityAlignment = FVector(
+		MeshTransform.TransformVector(FVector::XAxisVector).GetSafeNormal() | FVector::DownVector,
+		MeshTransform.TransformVector(FVector::YAxisVector).GetSafeNormal() | FVector::DownVector,
+		MeshTransform.TransformVector(FVector::ZAxisVector).GetSafeNormal() | FVector::DownVector);
+
+	FStructuralLoadFailure Failure;
+	if (!LoadSolver.Step(GridCellLayout, CellState, SupercellState, Settings, LoadSolverBudgetMs * 0.001, Failure))
 	{
 		return;
 	}
 
-	ForceRemoveSupercell(SuperCellId);
-}
-
-int32 URealtimeDestructibleMeshComponent::GridCellIdToChunkId(int32 GridCellId) const
-{
-	if (!GridCellLayout.IsValidCellId(GridCellId))
+	// 과부하 슈퍼셀이 하중을 넘기던 면의 셀을 끊어 균열 생성 (균열 셀은 파편으로 분리)
+	TSet<int32> CrackCells;
+	TArray<int32> FaceCells;
+	for (int32 Direction = 0; Direction < 6; ++Direction)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("GridCellIdToChunkId: Invalid CellId=%d"), GridCellId);
-		return INDEX_NONE;
+		if ((Failure.SupportDirectionMask & (1 << Direction)) == 0)
+		{
+			continue;
+		}
+
+		SupercellState.GetBoundaryCellsInDirection(Failure.SupercellId, Direction, GridCellLayout, FaceCells);
+		for (int32 CellId : FaceCells)
+		{
+			if (!CellState.DestroyedCells.Contains(CellId))
+			{
+				CrackCells.Add(CellId);
+			}
+		}
 	}
-	if (GridToChunkMap.Num() == 0)
+
+	if (CrackCells.Num() == 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("GridCellIdToChunkId: GridToChunkMap is empty!"));
-		return INDEX_NONE;
+		return;
 	}
 
-	// GridCellLayout에서 로컬 중심점 획득
-	const FVector LocalCenter = GridCellLayout.IdToLocalCenter(GridCellId);
-
-	// SliceCount 기반 그리드 인덱스 계산
-	int32 GridX = FMath::FloorToInt((LocalCenter.X - CachedMeshBounds.Min.X) / CachedChunkSize.X);
-	int32 GridY = FMath::FloorToInt((LocalCenter.Y - CachedMeshBounds.Min.Y) / CachedChunkSize.Y);
-	int32 GridZ = FMath::FloorToInt((LocalCenter.Z - CachedMeshBounds.Min.Z) / CachedChunkSize.Z);
-
-	GridX = FMath::Clamp(GridX, 0, SliceCount.X - 1);
-	GridY = FMath::Clamp(GridY, 0, SliceCount.Y - 1);
-	GridZ = FMath::Clamp(GridZ, 0, SliceCount.Z - 1);
-
-	const int32 GridIndex = GridX + GridY * SliceCount.X + GridZ * SliceCount.X * SliceCount.Y;
-	return GridToChunkMap.IsValidIndex(GridIndex) ? GridToChunkMap[GridIndex] : INDEX_NONE;
-}
-
-//=============================================================================
-// 서버 Cell Box Collision (Chunked BodySetup + Surface Voxel)
-//=============================================================================
+	if (bEnableSupercell && SupercellState.IsValid())
+	{
+		for (int32 CellId : CrackCells)
+		{
+			SupercellState.OnCellDestroyed(CellId);
+		}
+	}
 
-void URealtimeDestructibleMeshComponent::BuildServerCellCollision()
-{
-	TRACE_CPUPROFILER_EVENT_SCOPE(BuildServerCellCollision);
+	HandleDisconnectedCells(CrackCells);
 
-	// Cell Box Collision 비활성화 시 원본 메시 콜리전 사용
-	if (!bEnableServerCellCollision)
+	const ENetMode NetMode = GetWorld() ? GetWorld()->GetNetMode() : NM_Standalone;
+	if (NetMode != NM_DedicatedServer)
 	{
-		UE_LOG(LogTemp, Log, TEXT("[ServerCellCollision] Disabled, using original mesh collision"));
-		return;
+		FDestructionResult CrackResult;
+		CrackResult.NewlyDestroyedCells = CrackCells.Array();
+		ProcessDecalRemoval(CrackResult);
 	}
 
-	// 데디케이티드 서버 및 클라이언트에서 실행 (Standalone/ListenServer는 원본 메시 콜리전 사용)
-	if (!GetWorld())
+	// 균열에 닿아 있던 살아있는 셀에서만 앵커 경로 재탐색 (전체 그리드 BFS 없음)
+	TSet<int32> CrackNeighbors;
+	for (int32 CellId : CrackCells)
 	{
-		return;
+		for (int32 NeighborId : GridCellLayout.GetCellNeighbors(CellId).Values)
+		{
+			if (GridCellLayout.GetCellExists(NeighborId) && !CellState.DestroyedCells.Contains(NeighborId))
+			{
+				CrackNeighbors.Add(NeighborId);
+			}
+		}
 	}
-	const ENetMode NetMode = GetWorld()->GetNetMode();
-	if (NetMode != NM_DedicatedServer && NetMode != NM_Client)
+	const int32 CollapsedCount = DetachCellsFromReleasedAnchors(CrackNeighbors.Array());
+
+	UE_LOG(LogTemp, Log, TEXT("[LoadCollapse] Supercell %d overloaded (ratio %.2f): %d crack cells, %d cells collapse"),
+		Failure.SupercellId, Failure.StressRatio, CrackCells.Num(), CollapsedCount);
+
+	// 붕괴는 파괴 요청 없이 발생하므로 FlushServerBatch를 기다리지 않고 바로 전송 (균열 그룹)
+	if (PendingReplicatedDetachGroups.Num() > 0 && NetMode != NM_Standalone)
 	{
-		return;
+		MulticastDetachSignal(PendingReplicatedDetachGroups);
+		PendingReplicatedDetachGroups.Reset();
 	}
 
-	if (!GridCellLayout.IsValid())
+	LateJoinDestroyedCells = CellState.DestroyedCells.Array();
+
+#if !UE_BUILD_SHIPPING
+	bShouldDebugUpdate = true;
+#endif
+}
+
+void URealtimeDestructibleMeshComponent::RebuildSupportContacts()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_RebuildSupportContacts);
+
+	if (!GetOwner() || !GetOwner()->HasAuthority() || !GridCellLayout.IsValid())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[ServerCellCollision] GridCellLayout is not valid, skipping"));
 		return;
 	}
 
-	// 동적 청크 분할 수 계산
-	const int32 TotalCells = GridCellLayout.GetValidCellCount();
-	if (TotalCells == 0)
+	ClearSupportContacts();
+
+	for (AActor* SupportingActor : SupportingActors)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[ServerCellCollision] No valid cells, skipping"));
-		return;
+		if (!IsValid(SupportingActor) || SupportingActor == GetOwner())
+		{
+			continue;
+		}
+
+		TInlineComponentArray<URealtimeDestructibleMeshComponent*> Supporters(SupportingActor);
+		for (URealtimeDestructibleMeshComponent* Supporter : Supporters)
+		{
+			if (Supporter && Supporter->GridCellLayout.IsValid())
+			{
+				AddSupportContacts(Supporter);
+			}
+		}
 	}
 
-	// 목표 청크 수 계산
-	const int32 TargetChunkCount = FMath::Max(1, TotalCells / FMath::Max(1, TargetCellsPerCollisionChunk));
+	// 앵커가 바뀌었으므로 하중 전체 재계산
+	LoadSolver.MarkAllDirty();
+}
 
-	// 3차원이므로 세제곱근으로 각 축 분할 수 계산
-	CollisionChunkDivisions = FMath::Max(1, FMath::RoundToInt(FMath::Pow((float)TargetChunkCount, 1.0f / 3.0f)));
+void URealtimeDestructibleMeshComponent::AddSupportContacts(URealtimeDestructibleMeshComponent* Supporter)
+{
+	const FGridCellLayout& SupporterLayout = Supporter->GridCellLayout;
+	const FTransform& MeshTransform = GetComponentTransform();
+	const FTransform& SupporterTransform = Supporter->GetComponentTransform();
+	const FBox SupporterBounds = Supporter->Bounds.GetBox().ExpandBy(SupportContactTolerance);
 
-	// 최소 1, 최대 10으로 제한
-	CollisionChunkDivisions = FMath::Clamp(CollisionChunkDivisions, 1, 10);
+	FStructuralSupportLink Link;
+	Link.Supporter = Supporter;
 
-	const int32 TotalChunks = CollisionChunkDivisions * CollisionChunkDivisions * CollisionChunkDivisions;
+	for (int32 CellId : GridCellLayout.SparseIndexToCellId)
+	{
+		// 이웃 6개가 모두 있는 내부 셀은 다른 메시와 닿을 수 없음
+		if (CellState.DestroyedCells.Contains(CellId) || GridCellLayout.GetCellNeighbors(CellId).Num() >= 6)
+		{
+			continue;
+		}
 
-	CollisionChunks.SetNum(TotalChunks);
+		const FVector LocalMin = GridCellLayout.IdToLocalMin(CellId);
+		const FBox WorldBox = FBox(LocalMin, LocalMin + GridCellLayout.CellSize).TransformBy(MeshTransform).ExpandBy(SupportContactTolerance);
+		if (!WorldBox.Intersect(SupporterBounds))
+		{
+			continue;
+		}
 
-	UE_LOG(LogTemp, Log, TEXT("[ServerCellCollision] Dynamic chunking: %d cells / %d target = %d divisions (%d chunks, ~%d cells/chunk)"),
-		TotalCells, TargetCellsPerCollisionChunk, CollisionChunkDivisions, TotalChunks,
-		TotalChunks > 0 ? TotalCells / TotalChunks : 0);
+		// 지지 메시 그리드 좌표 범위로 변환 (회전 시 보수적인 AABB)
+		const FBox SupporterLocalBox = WorldBox.InverseTransformBy(SupporterTransform);
+		const FVector MinGrid = (SupporterLocalBox.Min - SupporterLayout.GridOrigin) / SupporterLayout.CellSize;
+		const FVector MaxGrid = (SupporterLocalBox.Max - SupporterLayout.GridOrigin) / SupporterLayout.CellSize;
+		const FIntVector MinCoord(
+			FMath::Max(0, FMath::FloorToInt(MinGrid.X)),
+			FMath::Max(0, FMath::FloorToInt(MinGrid.Y)),
+			FMath::Max(0, FMath::FloorToInt(MinGrid.Z)));
+		const FIntVector MaxCoord(
+			FMath::Min(SupporterLayout.GridSize.X - 1, FMath::FloorToInt(MaxGrid.X)),
+			FMath::Min(SupporterLayout.GridSize.Y - 1, FMath::FloorToInt(MaxGrid.Y)),
+			FMath::Min(SupporterLayout.GridSize.Z - 1, FMath::FloorToInt(MaxGrid.Z)));
 
-	// 메시 바운드 기반으로 청크 크기 계산
-	const FBox MeshBounds = CachedMeshBounds;
-	const FVector BoundsSize = MeshBounds.GetSize();
+		for (int32 Z = MinCoord.Z; Z <= MaxCoord.Z; ++Z)
+		{
+			for (int32 Y = MinCoord.Y; Y <= MaxCoord.Y; ++Y)
+			{
+				for (int32 X = MinCoord.X; X <= MaxCoord.X; ++X)
+				{
+					const int32 SupporterCellId = SupporterLayout.CoordToId(X, Y, Z);
+					if (!SupporterLayout.GetCellExists(SupporterCellId)
+						|| Supporter->CellState.DestroyedCells.Contains(SupporterCellId)
+						|| SupporterLayout.GetCellNeighbors(SupporterCellId).Num() >= 6)
+					{
+						continue;
+					}
 
-	// Division by Zero 보호: 바운드가 너무 작으면 단일 청크로 처리
-	if (BoundsSize.X < KINDA_SMALL_NUMBER || BoundsSize.Y < KINDA_SMALL_NUMBER || BoundsSize.Z < KINDA_SMALL_NUMBER)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("[ServerCellCollision] Degenerate bounds detected: %s, using single chunk"), *BoundsSize.ToString());
-		CollisionChunkDivisions = 1;
+					Link.SupporterToContactCells.FindOrAdd(SupporterCellId).Add(CellId);
+					++Link.ContactSupportCount.FindOrAdd(CellId);
+				}
+			}
+		}
 	}
 
-	const FVector ChunkSize = BoundsSize / FMath::Max(1.0f, (float)CollisionChunkDivisions);
-
-	// 각 유효 셀을 청크에 할당
-	CellToCollisionChunkMap.Empty();
+	if (Link.ContactSupportCount.Num() == 0)
+	{
+		return;
+	}
 
-	for (int32 SparseIdx = 0; SparseIdx < GridCellLayout.GetValidCellCount(); ++SparseIdx)
+	// 원래 앵커가 아닌 접촉 셀만 지지 앵커로 등록 (링크 수 참조 카운트)
+	for (const TPair<int32, int32>& Contact : Link.ContactSupportCount)
 	{
-		const int32 CellId = GridCellLayout.SparseIndexToCellId[SparseIdx];
-		const FVector LocalCenter = GridCellLayout.IdToLocalCenter(CellId);
+		if (int32* Refs = SupportAnchorRefs.Find(Contact.Key))
+		{
+			++(*Refs);
+		}
+		else if (!GridCellLayout.GetCellIsAnchor(Contact.Key))
+		{
+			GridCellLayout.SetCellIsAnchor(Contact.Key, true);
+			SupportAnchorRefs.Add(Contact.Key, 1);
+		}
+	}
 
-		// 청크 인덱스 계산 (Division by Zero 보호 포함)
-		int32 ChunkX = (ChunkSize.X > KINDA_SMALL_NUMBER) ? FMath::FloorToInt((LocalCenter.X - MeshBounds.Min.X) / ChunkSize.X) : 0;
-		int32 ChunkY = (ChunkSize.Y > KINDA_SMALL_NUMBER) ? FMath::FloorToInt((LocalCenter.Y - MeshBounds.Min.Y) / ChunkSize.Y) : 0;
-		int32 ChunkZ = (ChunkSize.Z > KINDA_SMALL_NUMBER) ? FMath::FloorToInt((LocalCenter.Z - MeshBounds.Min.Z) / ChunkSize.Z) : 0;
+	Supporter->SupportedComponents.AddUnique(this);
+	for (const TPair<int32, TArray<int32>>& Pair : Link.SupporterToContactCells)
+	{
+		Supporter->SupportWatchedCells.Add(Pair.Key);
+	}
 
-		ChunkX = FMath::Clamp(ChunkX, 0, CollisionChunkDivisions - 1);
-		ChunkY = FMath::Clamp(ChunkY, 0, CollisionChunkDivisions - 1);
-		ChunkZ = FMath::Clamp(ChunkZ, 0, CollisionChunkDivisions - 1);
+	UE_LOG(LogTemp, Log, TEXT("[Support] %s rests on %s: %d contact cells, %d supporter cells"),
+		*GetNameSafe(GetOwner()), *GetNameSafe(Supporter->GetOwner()),
+		Link.ContactSupportCount.Num(), Link.SupporterToContactCells.Num());
 
-		const int32 ChunkIndex = ChunkX + ChunkY * CollisionChunkDivisions + ChunkZ * CollisionChunkDivisions * CollisionChunkDivisions;
+	SupportLinks.Add(MoveTemp(Link));
+}
 
-		CollisionChunks[ChunkIndex].CellIds.Add(CellId);
-		CellToCollisionChunkMap.Add(CellId, ChunkIndex);
+void URealtimeDestructibleMeshComponent::ClearSupportContacts()
+{
+	for (const TPair<int32, int32>& Pair : SupportAnchorRefs)
+	{
+		GridCellLayout.SetCellIsAnchor(Pair.Key, false);
 	}
+	SupportAnchorRefs.Empty();
 
-	if (NetMode == NM_DedicatedServer)
+	for (const FStructuralSupportLink& Link : SupportLinks)
 	{
-		// 서버: 전체 충돌 비활성화 (Cell Box가 모든 충돌 담당)
-		SetCollisionEnabled(ECollisionEnabled::NoCollision);
-		for (UDynamicMeshComponent* ChunkMesh : ChunkMeshComponents)
+		if (URealtimeDestructibleMeshComponent* Supporter = Link.Supporter.Get())
 		{
-			if (ChunkMesh)
-			{
-				ChunkMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-			}
+			Supporter->SupportedComponents.Remove(this);
 		}
 	}
-	else // NM_Client
+	SupportLinks.Empty();
+}
+
+void URealtimeDestructibleMeshComponent::NotifySupportedComponents(const TArray<int32>& LostCellIds)
+{
+	if (SupportWatchedCells.Num() == 0 || !GetOwner() || !GetOwner()->HasAuthority())
 	{
-		// 클라이언트: Pawn 응답만 제거 (레이캐스트 충돌은 유지)
-		SetCollisionResponseToChannel(ECC_Pawn, ECR_Ignore);
-		for (UDynamicMeshComponent* ChunkMesh : ChunkMeshComponents)
-		{
-			if (ChunkMesh)
-			{
-				ChunkMesh->SetCollisionResponseToChannel(ECC_Pawn, ECR_Ignore);
-			}
-		}
+		return;
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("[ServerCellCollision] After NoCollision: Main CollisionEnabled=%d, HasPhysics=%d"),
-		(int32)GetCollisionEnabled(), IsPhysicsStateCreated() ? 1 : 0);
-	for (int32 i = 0; i < ChunkMeshComponents.Num(); ++i)
+	// 무언가 올려진 셀만 전달
+	TArray<int32> LostContactCells;
+	for (int32 CellId : LostCellIds)
 	{
-		if (ChunkMeshComponents[i])
+		if (SupportWatchedCells.Remove(CellId) > 0)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("[ServerCellCollision] ChunkMesh[%d] CollisionEnabled=%d, HasPhysics=%d"),
-				i, (int32)ChunkMeshComponents[i]->GetCollisionEnabled(),
-				ChunkMeshComponents[i]->IsPhysicsStateCreated() ? 1 : 0);
+			LostContactCells.Add(CellId);
 		}
 	}
 
-	// 각 청크의 콜리전 컴포넌트 및 BodySetup 생성
-	for (int32 i = 0; i < TotalChunks; ++i)
+	if (LostContactCells.Num() == 0)
 	{
-		BuildCollisionChunkBodySetup(i);
+		return;
 	}
 
-	bServerCellCollisionInitialized = true;
+	// 연쇄 붕괴 중 배열이 바뀔 수 있으므로 복사본 순회
+	const TArray<TWeakObjectPtr<URealtimeDestructibleMeshComponent>> Supported = SupportedComponents;
+	for (const TWeakObjectPtr<URealtimeDestructibleMeshComponent>& SupportedComponent : Supported)
+	{
+		if (URealtimeDestructibleMeshComponent* Component = SupportedComponent.Get())
+		{
+			Component->OnSupporterCellsLost(this, LostContactCells);
+		}
+	}
+}
+
+void URealtimeDestructibleMeshComponent::OnSupporterCellsLost(const URealtimeDestructibleMeshComponent* Supporter, const TArray<int32>& LostCellIds)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_OnSupporterCellsLost);
+
+	const int32 LinkIndex = SupportLinks.IndexOfByPredicate([Supporter](const FStructuralSupportLink& Link)
+	{
+		return Link.Supporter.Get() == Supporter;
+	});
+	if (LinkIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	// 접촉 셀만 확인: 아래 지지 셀이 모두 사라진 접촉 셀의 앵커 해제
+	TArray<int32> ReleasedCells;
+	{
+		FStructuralSupportLink& Link = SupportLinks[LinkIndex];
+		for (int32 LostCellId : LostCellIds)
+		{
+			TArray<int32> ContactCells;
+			if (!Link.SupporterToContactCells.RemoveAndCopyValue(LostCellId, ContactCells))
+			{
+				continue;
+			}
+
+			for (int32 ContactCellId : ContactCells)
+			{
+				int32* SupportCount = Link.ContactSupportCount.Find(ContactCellId);
+				if (!SupportCount || --(*SupportCount) > 0)
+				{
+					continue;
+				}
+				Link.ContactSupportCount.Remove(ContactCellId);
+
+				// 다른 지지 메시에도 닿아 있거나 원래 앵커였던 셀은 유지
+				int32* Refs = SupportAnchorRefs.Find(ContactCellId);
+				if (!Refs || --(*Refs) > 0)
+				{
+					continue;
+				}
+				SupportAnchorRefs.Remove(ContactCellId);
+				GridCellLayout.SetCellIsAnchor(ContactCellId, false);
+
+				if (!CellState.DestroyedCells.Contains(ContactCellId))
+				{
+					ReleasedCells.Add(ContactCellId);
+				}
+			}
+		}
+
+		if (Link.ContactSupportCount.Num() == 0)
+		{
+			SupportLinks.RemoveAtSwap(LinkIndex);
+		}
+	}
+
+	if (ReleasedCells.Num() == 0)
+	{
+		return;
+	}
+
+	LoadSolver.MarkCellsDirty(GridCellLayout, SupercellState, ReleasedCells);
+
+	const int32 DetachedCount = DetachCellsFromReleasedAnchors(ReleasedCells);
+
+	UE_LOG(LogTemp, Log, TEXT("[Support] %s lost support from %s: %d contact cells released, %d cells detach"),
+		*GetNameSafe(GetOwner()), *GetNameSafe(Supporter ? Supporter->GetOwner() : nullptr),
+		ReleasedCells.Num(), DetachedCount);
+}
+
+int32 URealtimeDestructibleMeshComponent::DetachCellsFromReleasedAnchors(const TArray<int32>& ReleasedCells)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_DetachCellsFromReleasedAnchors);
+
+	if (!bEnableStructuralIntegrity || ReleasedCells.Num() == 0 || !GetWorld())
+	{
+		return 0;
+	}
+
+	// 앵커를 잃은 셀에서만 앵커 탐색 (전체 재검사 없음)
+	const ENetMode NetMode = GetWorld()->GetNetMode();
+	const TSet<int32> DisconnectedCells = FCellDestructionSystem::FindDisconnectedCellsFromAffected(
+		GridCellLayout,
+		SupercellState,
+		CellState,
+		ReleasedCells,
+		CellContext,
+		bEnableSupercell && SupercellState.IsValid(),
+		bEnableSubcell && (NetMode == NM_Standalone));
+
+	if (DisconnectedCells.Num() == 0)
+	{
+		return 0;
+	}
+
+	HandleDisconnectedCells(DisconnectedCells);
+
+	if (NetMode != NM_DedicatedServer)
+	{
+		FDestructionResult DetachResult;
+		DetachResult.NewlyDestroyedCells = DisconnectedCells.Array();
+		ProcessDecalRemoval(DetachResult);
+	}
+
+	// 앵커 변경은 파괴 요청 없이 발생하므로 FlushServerBatch를 기다리지 않고 바로 전송
+	if (PendingReplicatedDetachGroups.Num() > 0 && NetMode != NM_Standalone)
+	{
+		MulticastDetachSignal(PendingReplicatedDetachGroups);
+		PendingReplicatedDetachGroups.Reset();
+	}
+
+	LateJoinDestroyedCells = CellState.DestroyedCells.Array();
+
+#if !UE_BUILD_SHIPPING
+	bShouldDebugUpdate = true;
+#endif
+
+	return DisconnectedCells.Num();
+}
+
+int32 URealtimeDestructibleMeshComponent::SetCellsAnchored(const TArray<int32>& CellIds, bool bAnchored)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_SetCellsAnchored);
+
+	if (!GetOwner() || !GetOwner()->HasAuthority() || !GridCellLayout.IsValid())
+	{
+		return 0;
+	}
+
+	TArray<int32> ChangedCells;
+	for (int32 CellId : CellIds)
+	{
+		if (!GridCellLayout.IsValidCellId(CellId) || !GridCellLayout.GetCellExists(CellId)
+			|| CellState.DestroyedCells.Contains(CellId))
+		{
+			continue;
+		}
+
+		// 직접 지정한 앵커는 지지 접촉 참조에서 빼서 지지 상실과 무관하게 유지
+		SupportAnchorRefs.Remove(CellId);
+
+		if (GridCellLayout.GetCellIsAnchor(CellId) != bAnchored)
+		{
+			GridCellLayout.SetCellIsAnchor(CellId, bAnchored);
+			ChangedCells.Add(CellId);
+		}
+	}
+
+	if (ChangedCells.Num() == 0)
+	{
+		return 0;
+	}
+
+	// 하중 경로가 바뀌므로 해당 슈퍼셀 재계산
+	LoadSolver.MarkCellsDirty(GridCellLayout, SupercellState, ChangedCells);
+
+	// 앵커 추가는 연결을 늘리기만 하므로 분리 검사 불필요 (이미 분리된 셀은 파편이 되었음)
+	int32 DetachedCount = 0;
+	if (!bAnchored)
+	{
+		DetachedCount = DetachCellsFromReleasedAnchors(ChangedCells);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[Anchor] %s: %d anchors %s, %d cells detach"),
+		*GetNameSafe(GetOwner()), ChangedCells.Num(), bAnchored ? TEXT("added") : TEXT("removed"), DetachedCount);
+
+	return ChangedCells.Num();
+}
+
+int32 URealtimeDestructibleMeshComponent::AddAnchorsInBox(const FTransform& BoxTransform, FVector BoxExtent)
+{
+	TArray<int32> CellIds;
+	CollectCellsInWorldBox(BoxTransform, BoxExtent, CellIds);
+	return SetCellsAnchored(CellIds, true);
+}
+
+int32 URealtimeDestructibleMeshComponent::RemoveAnchorsInBox(const FTransform& BoxTransform, FVector BoxExtent)
+{
+	TArray<int32> CellIds;
+	CollectCellsInWorldBox(BoxTransform, BoxExtent, CellIds);
+	return SetCellsAnchored(CellIds, false);
+}
+
+int32 URealtimeDestructibleMeshComponent::AddAnchorsInSphere(FVector Center, float Radius)
+{
+	TArray<int32> CellIds;
+	CollectCellsInWorldSphere(Center, Radius, CellIds);
+	return SetCellsAnchored(CellIds, true);
+}
+
+int32 URealtimeDestructibleMeshComponent::RemoveAnchorsInSphere(FVector Center, float Radius)
+{
+	TArray<int32> CellIds;
+	CollectCellsInWorldSphere(Center, Radius, CellIds);
+	return SetCellsAnchored(CellIds, false);
+}
+
+void URealtimeDestructibleMeshComponent::CollectCellsInWorldBox(const FTransform& BoxTransform, const FVector& BoxExtent, TArray<int32>& OutCellIds) const
+{
+	// FGridCellBuilder::SetAnchorsByFiniteBox와 같은 판정 (셀 중심이 박스 안)
+	const FBox WorldBounds = FBox(-BoxExtent, BoxExtent).TransformBy(BoxTransform);
+	CollectCellsInWorldBounds(WorldBounds, [&BoxTransform, &BoxExtent](const FVector& WorldCenter)
+	{
+		const FVector BoxSpacePos = BoxTransform.InverseTransformPosition(WorldCenter);
+		return FMath::Abs(BoxSpacePos.X) <= BoxExtent.X
+			&& FMath::Abs(BoxSpacePos.Y) <= BoxExtent.Y
+			&& FMath::Abs(BoxSpacePos.Z) <= BoxExtent.Z;
+	}, OutCellIds);
+}
+
+void URealtimeDestructibleMeshComponent::CollectCellsInWorldSphere(const FVector& Center, float Radius, TArray<int32>& OutCellIds) const
+{
+	const FBox WorldBounds = FBox(Center - FVector(Radius), Center + FVector(Radius));
+	const double RadiusSq = FMath::Square(static_cast<double>(Radius));
+	CollectCellsInWorldBounds(WorldBounds, [&Center, RadiusSq](const FVector& WorldCenter)
+	{
+		return FVector::DistSquared(WorldCenter, Center) <= RadiusSq;
+	}, OutCellIds);
+}
+
+void URealtimeDestructibleMeshComponent::CollectCellsInWorldBounds(const FBox& WorldBounds, TFunctionRef<bool(const FVector&)> ContainsWorldPoint, TArray<int32>& OutCellIds) const
+{
+	if (!WorldBounds.IsValid)
+	{
+		return;
+	}
+
+	// 영역을 덮는 셀 좌표 범위만 순회 (그리드 전체 순회 없음)
+	const FTransform& MeshTransform = GetComponentTransform();
+	for (int32 CellId : GridCellLayout.GetCellsInAABB(WorldBounds, MeshTransform))
+	{
+		if (ContainsWorldPoint(MeshTransform.TransformPosition(GridCellLayout.IdToLocalCenter(CellId))))
+		{
+			OutCellIds.Add(CellId);
+		}
+	}
+}
+
+float URealtimeDestructibleMeshComponent::CalculateDebrisBoundsExtent(const TArray<int32>& CellIds) const
+{
+	if (CellIds.Num() == 0)
+	{
+		return 0.0f;
+	}
+
+	FBox CellBounds(ForceInit);
+	for (int32 CellId : CellIds)
+	{
+		FVector CellMin = GridCellLayout.IdToLocalMin(CellId);
+		FVector CellMax = CellMin + GridCellLayout.CellSize;
+		CellBounds += CellMin;
+		CellBounds += CellMax;
+	}
+
+	FVector BoxExtent = CellBounds.GetExtent();
+	BoxExtent *= GetComponentTransform().GetScale3D(); 
+
+	return BoxExtent.GetMax();
+}
+void URealtimeDestructibleMeshComponent::ForceRemoveSupercell(int32 SuperCellId)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(Debris_ForceRemoveSupercell);
+	TArray<int32> AllCellsInSupercell;
+	SupercellState.GetCellsInSupercell(SuperCellId, GridCellLayout, AllCellsInSupercell);
+
+	// alive cell이 하나라도 있는지만 확인 (첫 alive에서 종료)
+	const bool bHasAliveCell = AllCellsInSupercell.ContainsByPredicate([this](int32 CellId)
+	{
+		return !CellState.DestroyedCells.Contains(CellId);
+	});
+	if (!bHasAliveCell) return;
+
+	// 같은 형태(셀 존재 마스크)의 supercell은 제거 메시를 공유 → GreedyMesh/Smoothing 생략
+	const FSupercellRemovalTemplate* RemovalTemplate = FindOrBuildSupercellRemovalTemplate(SuperCellId, AllCellsInSupercell);
+
+
+	// 렌더링 처리 (Dedicated Server는 패스) 
+	// ToolMesh(smoothed + DebrisExpandRatio) 형상과 겹치는 cell도 함께 수집
+	const bool bIsDedicatedServer = GetWorld() && GetWorld()->GetNetMode() == NM_DedicatedServer;
+	const bool bIsDedicatedServerClient = bServerIsDedicatedServer && !GetOwner()->HasAuthority();
+	
+	TArray<int32> ToolMeshOverlappingCells;
+	 
+	auto RemoveMesh = [&]()
+	{
+		if (RemovalTemplate)
+		{
+			ApplySupercellRemovalTemplate(*RemovalTemplate, SuperCellId, AllCellsInSupercell, true, &ToolMeshOverlappingCells);
+		}
+		else
+		{
+			RemoveTrianglesForDetachedCells(AllCellsInSupercell, nullptr, &ToolMeshOverlappingCells);
+		}
+	};
+	auto CollectOverlapOnly = [&]()
+	{
+		if (RemovalTemplate)
+		{
+			ApplySupercellRemovalTemplate(*RemovalTemplate, SuperCellId, AllCellsInSupercell, false, &ToolMeshOverlappingCells);
+		}
+		else
+		{
+			CollectToolMeshOverlappingCells(AllCellsInSupercell, ToolMeshOverlappingCells);
+		}
+	};
+
+	if (bIsDedicatedServer)
+	{
+		SpawnDebrisActorForDedicatedServer(AllCellsInSupercell);
+		CollectOverlapOnly();
+	}
+	else if (bIsDedicatedServerClient)
+	{
+		float DebrisSize = CalculateDebrisBoundsExtent(AllCellsInSupercell);
+		if (DebrisSize < MinDebrisSyncSize)
+		{
+			// 작은 debris: 클라이언트가 자체 boolean + cell 수집
+			RemoveMesh();
+		}
+		else
+		{
+			// 큰 debris: 서버 DebrisActor가 boolean 처리, cell 수집만 수행
+			CollectOverlapOnly();
+		}
+	}
+	else
+	{
+		RemoveMesh();
+		// Cleanup은 IslandRemoval 완료 콜백에서 처리 (비동기)
+	}
+
+	// Supercell 삭제하면서 이웃 Supercell의 cell에 영향을 끼칠 수 있음, 
+	// 이웃 supercell에 삭제된게 있으면 업데이트를 해준다. 
+	if (ToolMeshOverlappingCells.Num() > 0)
+	{
+		// 원본 supercell cell과 합치기 (bitset으로 수집했으므로 중복 없음)
+		const int32 NumOriginalCells = AllCellsInSupercell.Num();
+		for (int32 CellId : ToolMeshOverlappingCells)
+		{
+			const bool bInThisSupercell = SupercellState.IsValid()
+				? SupercellState.GetSupercellForCell(CellId) == SuperCellId
+				: MakeArrayView(AllCellsInSupercell.GetData(), NumOriginalCells).Contains(CellId);
+			if (!bInThisSupercell)
+			{
+				AllCellsInSupercell.Add(CellId);
+
+				// 인접 supercell의 DestroyedCellCount 업데이트
+				if (bEnableSupercell && SupercellState.IsValid())
+				{
+					const int32 NeighborSCId = SupercellState.GetSupercellForCell(CellId);
+					if (NeighborSCId != INDEX_NONE && NeighborSCId != SuperCellId &&
+						SupercellState.DestroyedCellCounts.IsValidIndex(NeighborSCId))
+					{
+						SupercellState.DestroyedCellCounts[NeighborSCId]++;
+					}
+				}
+			}
+		}
+	}
+	CellState.DestroyCells(AllCellsInSupercell);
+
+	// hit count 리셋
+	SupercellState.MarkSupercellBroken(SuperCellId);
+
+	if (SupercellState.DestroyedCellCounts.IsValidIndex(SuperCellId))
+	{
+		SupercellState.DestroyedCellCounts[SuperCellId] = 0;
+		SupercellState.InitialValidCellCounts[SuperCellId] = 0;
+	}
+
+	// 파편 정리 예약
+	bPendingCleanup = true;
+}
+
+const URealtimeDestructibleMeshComponent::FSupercellRemovalTemplate* URealtimeDestructibleMeshComponent::FindOrBuildSupercellRemovalTemplate(int32 SuperCellId, const TArray<int32>& CellsInSupercell)
+{
+	using namespace UE::Geometry;
+
+	if (!SupercellState.IsValid() || CellsInSupercell.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	const FIntVector Size = SupercellState.SupercellSize;
+	if (Size.X * Size.Y * Size.Z > 64)
+	{
+		return nullptr;
+	}
+
+	// 셀 존재 마스크 (supercell 로컬 인덱스 기준) - 내부 supercell은 모두 같은 키
+	const FIntVector SupercellCoord = SupercellState.SupercellIdToCoord(SuperCellId);
+	const FIntVector MinCoord(SupercellCoord.X * Size.X, SupercellCoord.Y * Size.Y, SupercellCoord.Z * Size.Z);
+
+	uint64 ShapeMask = 0;
+	for (int32 CellId : CellsInSupercell)
+	{
+		const FIntVector Local = GridCellLayout.IdToCoord(CellId) - MinCoord;
+		ShapeMask |= 1ull << (Local.X + Local.Y * Size.X + Local.Z * Size.X * Size.Y);
+	}
+
+	if (FSupercellRemovalTemplate* Existing = SupercellRemovalTemplates.Find(ShapeMask))
+	{
+		// 빌드 파라미터가 바뀌지 않았으면 재사용
+		if (Existing->CellSize.Equals(GridCellLayout.CellSize) &&
+			Existing->ExpandRatio == DebrisExpandRatio &&
+			Existing->ScaleRatio == DebrisScaleRatio &&
+			Existing->SplitCount == DebrisSplitCount)
+		{
+			return Existing;
+		}
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(Debris_BuildSupercellRemovalTemplate);
+
+	FSupercellRemovalTemplate& Template = SupercellRemovalTemplates.Add(ShapeMask);
+	Template.CellSize = GridCellLayout.CellSize;
+	Template.ExpandRatio = DebrisExpandRatio;
+	Template.ScaleRatio = DebrisScaleRatio;
+	Template.SplitCount = DebrisSplitCount;
+
+	// supercell 최소 코너 기준 로컬 공간으로 저장
+	const FVector3d ToLocal(-MinCoord.X * GridCellLayout.CellSize.X, -MinCoord.Y * GridCellLayout.CellSize.Y, -MinCoord.Z * GridCellLayout.CellSize.Z);
+
+	TArray<TArray<FIntVector>> Pieces;
+	BuildDetachedPieces(CellsInSupercell, false, Pieces);
+	for (TArray<FIntVector>& Piece : Pieces)
+	{
+		if (Piece.Num() == 0)
+		{
+			continue;
+		}
+
+		FDynamicMesh3 ToolMesh;
+		FDynamicMesh3 DebrisToolMesh;
+		if (!BuildPieceToolMeshes(Piece, ToolMesh, DebrisToolMesh))
+		{
+			continue;
+		}
+
+		MeshTransforms::Translate(ToolMesh, ToLocal);
+		MeshTransforms::Translate(DebrisToolMesh, ToLocal);
+
+		Template.ToolMeshes.Add(MakeShared<FDynamicMesh3>(MoveTemp(ToolMesh)));
+		Template.DebrisToolMeshes.Add(MakeShared<FDynamicMesh3>(MoveTemp(DebrisToolMesh)));
+
+		// 조각 셀도 supercell 로컬 좌표로 보관 (적용 시 셀 ID로 변환)
+		TArray<FIntVector>& LocalCoords = Template.PieceCellCoords.AddDefaulted_GetRef();
+		LocalCoords.Reserve(Piece.Num());
+		for (const FIntVector& GridPos : Piece)
+		{
+			LocalCoords.Add(GridPos - MinCoord);
+		}
+	}
+
+	return &Template;
+}
+
+void URealtimeDestructibleMeshComponent::ApplySupercellRemovalTemplate(const FSupercellRemovalTemplate& Template, int32 SuperCellId, const TArray<int32>& CellsInSupercell,
+	bool bEnqueueRemoval, TArray<int32>* OutToolMeshOverlappingCellIds)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(Debris_ApplySupercellRemovalTemplate);
+	using namespace UE::Geometry;
+
+	const FIntVector Size = SupercellState.SupercellSize;
+	const FIntVector SupercellCoord = SupercellState.SupercellIdToCoord(SuperCellId);
+	const FIntVector MinCoord(SupercellCoord.X * Size.X, SupercellCoord.Y * Size.Y, SupercellCoord.Z * Size.Z);
+	const FVector3d ToSupercell(
+		SupercellCoord.X * Size.X * GridCellLayout.CellSize.X,
+		SupercellCoord.Y * Size.Y * GridCellLayout.CellSize.Y,
+		SupercellCoord.Z * Size.Z * GridCellLayout.CellSize.Z);
+
+	if (bEnqueueRemoval)
+	{
+		// 파편 정리용 초기화 (RemoveTrianglesForDetachedCells와 동일)
+		LastOccupiedCells.Empty();
+		LastCellSizeVec = GridCellLayout.CellSize;
+	}
+
+	for (int32 PieceIndex = 0; PieceIndex < Template.ToolMeshes.Num(); ++PieceIndex)
+	{
+		// 템플릿은 읽기 전용으로 공유되므로 이동한 사본을 만들어 사용
+		TSharedPtr<FDynamicMesh3> ToolMesh = MakeShared<FDynamicMesh3>(*Template.ToolMeshes[PieceIndex]);
+		MeshTransforms::Translate(*ToolMesh, ToSupercell);
+
+		if (OutToolMeshOverlappingCellIds)
+		{
+			CollectCellsOverlappingMesh(*ToolMesh, *OutToolMeshOverlappingCellIds);
+		}
+
+		if (!bEnqueueRemoval || ChunkMeshComponents.Num() == 0)
+		{
+			continue;
+		}
+
+		TSharedPtr<FDynamicMesh3> DebrisToolMesh = MakeShared<FDynamicMesh3>(*Template.DebrisToolMeshes[PieceIndex]);
+		MeshTransforms::Translate(*DebrisToolMesh, ToSupercell);
+
+		// 서버 스폰 Debris는 조각 셀을 보관 (2차 파괴용, RemoveTrianglesForDetachedCells와 동일)
+		const TArray<FIntVector>& LocalCoords = Template.PieceCellCoords[PieceIndex];
+		TArray<int32> PieceCellIds;
+		PieceCellIds.Reserve(LocalCoords.Num());
+		for (const FIntVector& LocalCoord : LocalCoords)
+		{
+			PieceCellIds.Add(GridCellLayout.CoordToId(MinCoord + LocalCoord));
+		}
+
+		EnqueuePieceRemoval(ToolMesh, DebrisToolMesh, CellsInSupercell, nullptr,
+			PieceIndex, Template.ToolMeshes.Num(), LocalCoords.Num(), MoveTemp(PieceCellIds));
+	}
+}
+
+void URealtimeDestructibleMeshComponent::MulticastForceRemoveSupercell_Implementation(int32 SuperCellId)
+{
+	// DedicatedServer는 Pass 
+	if (GetWorld() && GetWorld()->GetNetMode() == NM_DedicatedServer)
+	{
+		return;
+	}
+	
+	// 서버는 로컬에서 처리함
+	if (GetOwner() && GetOwner()->HasAuthority())
+	{
+		return;
+	}
+
+	ForceRemoveSupercell(SuperCellId);
+}
+
+int32 URealtimeDestructibleMeshComponent::GridCellIdToChunkId(int32 GridCellId) const
+{
+	if (!GridCellLayout.IsValidCellId(GridCellId))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("GridCellIdToChunkId: Invalid CellId=%d"), GridCellId);
+		return INDEX_NONE;
+	}
+	if (GridToChunkMap.Num() == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("GridCellIdToChunkId: GridToChunkMap is empty!"));
+		return INDEX_NONE;
+	}
+
+	// GridCellLayout에서 로컬 중심점 획득
+	return LocalPositionToChunkId(GridCellLayout.IdToLocalCenter(GridCellId));
+}
+
+int32 URealtimeDestructibleMeshComponent::LocalPositionToChunkId(const FVector& LocalPosition) const
+{
+	if (GridToChunkMap.Num() == 0 || SliceCount.X <= 0 || SliceCount.Y <= 0 || SliceCount.Z <= 0)
+	{
+		return INDEX_NONE;
+	}
+
+	// SliceCount 기반 그리드 인덱스 계산
+	int32 GridX = FMath::FloorToInt((LocalPosition.X - CachedMeshBounds.Min.X) / CachedChunkSize.X);
+	int32 GridY = FMath::FloorToInt((LocalPosition.Y - CachedMeshBounds.Min.Y) / CachedChunkSize.Y);
+	int32 GridZ = FMath::FloorToInt((LocalPosition.Z - CachedMeshBounds.Min.Z) / CachedChunkSize.Z);
+
+	GridX = FMath::Clamp(GridX, 0, SliceCount.X - 1);
+	GridY = FMath::Clamp(GridY, 0, SliceCount.Y - 1);
+	GridZ = FMath::Clamp(GridZ, 0, SliceCount.Z - 1);
+
+	const int32 GridIndex = GridX + GridY * SliceCount.X + GridZ * SliceCount.X * SliceCount.Y;
+	return GridToChunkMap.IsValidIndex(GridIndex) ? GridToChunkMap[GridIndex] : INDEX_NONE;
+}
+
+//=============================================================================
+// 서버 Cell Box Collision (Chunked BodySetup + Surface Voxel)
+//=============================================================================
+
+void URealtimeDestructibleMeshComponent::BuildServerCellCollision()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(BuildServerCellCollision);
+
+	// Cell Box Collision 비활성화 시 원본 메시 콜리전 사용
+	if (!bEnableServerCellCollision)
+	{
+		UE_LOG(LogTemp, Log, TEXT("[ServerCellCollision] Disabled, using original mesh collision"));
+		return;
+	}
+
+	// 데디케이티드 서버 및 클라이언트에서 실행 (Standalone/ListenServer는 원본 메시 콜리전 사용)
+	if (!GetWorld())
+	{
+		return;
+	}
+	const ENetMode NetMode = GetWorld()->GetNetMode();
+	if (NetMode != NM_DedicatedServer && NetMode != NM_Client)
+	{
+		return;
+	}
+
+	if (!GridCellLayout.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[ServerCellCollision] GridCellLayout is not valid, skipping"));
+		return;
+	}
+
+	// 동적 청크 분할 수 계산
+	const int32 TotalCells = GridCellLayout.GetValidCellCount();
+	if (TotalCells == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[ServerCellCollision] No valid cells, skipping"));
+		return;
+	}
+
+	// 목표 청크 수 계산
+	const int32 TargetChunkCount = FMath::Max(1, TotalCells / FMath::Max(1, TargetCellsPerCollisionChunk));
+
+	// 3차원이므로 세제곱근으로 각 축 분할 수 계산
+	CollisionChunkDivisions = FMath::Max(1, FMath::RoundToInt(FMath::Pow((float)TargetChunkCount, 1.0f / 3.0f)));
+
+	// 최소 1, 최대 10으로 제한
+	CollisionChunkDivisions = FMath::Clamp(CollisionChunkDivisions, 1, 10);
+
+	const int32 TotalChunks = CollisionChunkDivisions * CollisionChunkDivisions * CollisionChunkDivisions;
+
+	CollisionChunks.SetNum(TotalChunks);
+
+	UE_LOG(LogTemp, Log, TEXT("[ServerCellCollision] Dynamic chunking: %d cells / %d target = %d divisions (%d chunks, ~%d cells/chunk)"),
+		TotalCells, TargetCellsPerCollisionChunk, CollisionChunkDivisions, TotalChunks,
+		TotalChunks > 0 ? TotalCells / TotalChunks : 0);
+
+	// 메시 바운드 기반으로 청크 크기 계산
+	const FBox MeshBounds = CachedMeshBounds;
+	const FVector BoundsSize = MeshBounds.GetSize();
+
+	// Division by Zero 보호: 바운드가 너무 작으면 단일 청크로 처리
+	if (BoundsSize.X < KINDA_SMALL_NUMBER || BoundsSize.Y < KINDA_SMALL_NUMBER || BoundsSize.Z < KINDA_SMALL_NUMBER)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[ServerCellCollision] Degenerate bounds detected: %s, using single chunk"), *BoundsSize.ToString());
+		CollisionChunkDivisions = 1;
+	}
+
+	const FVector ChunkSize = BoundsSize / FMath::Max(1.0f, (float)CollisionChunkDivisions);
+
+	// 각 유효 셀을 청크에 할당
+	CellToCollisionChunkMap.Empty();
+
+	for (int32 SparseIdx = 0; SparseIdx < GridCellLayout.GetValidCellCount(); ++SparseIdx)
+	{
+		const int32 CellId = GridCellLayout.SparseIndexToCellId[SparseIdx];
+		const FVector LocalCenter = GridCellLayout.IdToLocalCenter(CellId);
+
+		// 청크 인덱스 계산 (Division by Zero 보호 포함)
+		int32 ChunkX = (ChunkSize.X > KINDA_SMALL_NUMBER) ? FMath::FloorToInt((LocalCenter.X - MeshBounds.Min.X) / ChunkSize.X) : 0;
+		int32 ChunkY = (ChunkSize.Y > KINDA_SMALL_NUMBER) ? FMath::FloorToInt((LocalCenter.Y - MeshBounds.Min.Y) / ChunkSize.Y) : 0;
+		int32 ChunkZ = (ChunkSize.Z > KINDA_SMALL_NUMBER) ? FMath::FloorToInt((LocalCenter.Z - MeshBounds.Min.Z) / ChunkSize.Z) : 0;
+
+		ChunkX = FMath::Clamp(ChunkX, 0, CollisionChunkDivisions - 1);
+		ChunkY = FMath::Clamp(ChunkY, 0, CollisionChunkDivisions - 1);
+		ChunkZ = FMath::Clamp(ChunkZ, 0, CollisionChunkDivisions - 1);
+
+		const int32 ChunkIndex = ChunkX + ChunkY * CollisionChunkDivisions + ChunkZ * CollisionChunkDivisions * CollisionChunkDivisions;
+
+		CollisionChunks[ChunkIndex].CellIds.Add(CellId);
+		CellToCollisionChunkMap.Add(CellId, ChunkIndex);
+	}
+
+	if (NetMode == NM_DedicatedServer)
+	{
+		// 서버: 전체 충돌 비활성화 (Cell Box가 모든 충돌 담당)
+		SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		for (UDynamicMeshComponent* ChunkMesh : ChunkMeshComponents)
+		{
+			if (ChunkMesh)
+			{
+				ChunkMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+			}
+		}
+	}
+	else // NM_Client
+	{
+		// 클라이언트: Pawn 응답만 제거 (레이캐스트 충돌은 유지)
+		SetCollisionResponseToChannel(ECC_Pawn, ECR_Ignore);
+		for (UDynamicMeshComponent* ChunkMesh : ChunkMeshComponents)
+		{
+			if (ChunkMesh)
+			{
+				ChunkMesh->SetCollisionResponseToChannel(ECC_Pawn, ECR_Ignore);
+			}
+		}
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("[ServerCellCollision] After NoCollision: Main CollisionEnabled=%d, HasPhysics=%d"),
+		(int32)GetCollisionEnabled(), IsPhysicsStateCreated() ? 1 : 0);
+	for (int32 i = 0; i < ChunkMeshComponents.Num(); ++i)
+	{
+		if (ChunkMeshComponents[i])
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[ServerCellCollision] ChunkMesh[%d] CollisionEnabled=%d, HasPhysics=%d"),
+				i, (int32)ChunkMeshComponents[i]->GetCollisionEnabled(),
+				ChunkMeshComponents[i]->IsPhysicsStateCreated() ? 1 : 0);
+		}
+	}
+
+	// 각 청크의 콜리전 컴포넌트 및 BodySetup 생성
+	for (int32 i = 0; i < TotalChunks; ++i)
+	{
+		BuildCollisionChunkBodySetup(i);
+	}
+
+	bServerCellCollisionInitialized = true;
 
 	int32 TotalSurfaceCells = 0;
 	int32 NonEmptyChunks = 0;
@@ -1494,27 +2502,81 @@ bool URealtimeDestructibleMeshComponent::RemoveTrianglesForDetachedCells(const T
 	UE_LOG(LogTemp, Warning, TEXT("DetachedCellIds.Num()=%d, ChunkMeshComponents.Num()=%d"),
 		DetachedCellIds.Num(), ChunkMeshComponents.Num());
 
-	const FVector CellSizeVec = GridCellLayout.CellSize;
-
 	// 파편 정리용 초기화
 	LastOccupiedCells.Empty();
-	LastCellSizeVec = CellSizeVec;
+	LastCellSizeVec = GridCellLayout.CellSize;
 
-	// 1. 모든 분리된 셀들의 3D 점유 맵 생성
-	TSet<FIntVector> BaseCells;
-	for (int32 CellId : DetachedCellIds)
+	TArray<TArray<FIntVector>> FinalPieces;
+	BuildDetachedPieces(DetachedCellIds, TargetDebrisActor != nullptr, FinalPieces);
+
+	// 3. 각 조각별로 ToolMesh 생성 + Enqueue
+	UE_LOG(LogTemp, Warning, TEXT("Final Piceses : %d"), FinalPieces.Num());
+
+	for (int32 PieceIndex = 0; PieceIndex < FinalPieces.Num(); ++PieceIndex)
 	{
-		FIntVector GridPos = GridCellLayout.IdToCoord(CellId);   
-		BaseCells.Add(GridPos);
+		TRACE_CPUPROFILER_EVENT_SCOPE(Debris_FinalPieces);
+
+		TArray<FIntVector>& Piece = FinalPieces[PieceIndex];
+		if (Piece.Num() == 0)
+		{
+			continue;
+		}
+
+		UE_LOG(LogTemp, Warning, TEXT("Piece Size: %d"), Piece.Num());
+
+		// 서버 스폰 Debris는 조각 셀을 보관 (2차 파괴용)
+		TArray<int32> PieceCellIds;
+		if (!TargetDebrisActor)
+		{
+			PieceCellIds.Reserve(Piece.Num());
+			for (const FIntVector& GridPos : Piece)
+			{
+				PieceCellIds.Add(GridCellLayout.CoordToId(GridPos));
+			}
+		}
+
+		FDynamicMesh3 ToolMesh;
+		FDynamicMesh3 DebrisToolMesh;
+		if (!BuildPieceToolMeshes(Piece, ToolMesh, DebrisToolMesh))
+		{
+			continue;
+		}
+
+		// ToolMesh(smoothed + DebrisExpandRatio) 삼각형과 겹치는 grid cell 수집
+		if (OutToolMeshOverlappingCellIds)
+		{
+			CollectCellsOverlappingMesh(ToolMesh, *OutToolMeshOverlappingCellIds);
+		}
+
+		EnqueuePieceRemoval(
+			MakeShared<FDynamicMesh3>(MoveTemp(ToolMesh)),
+			MakeShared<FDynamicMesh3>(MoveTemp(DebrisToolMesh)),
+			DetachedCellIds, TargetDebrisActor, PieceIndex, FinalPieces.Num(), Piece.Num(), MoveTemp(PieceCellIds));
 	}
-	
 
-	TArray<TArray<FIntVector>> FinalPieces;
+	return true;
+}
+
+void URealtimeDestructibleMeshComponent::BuildDetachedPieces(const TArray<int32>& DetachedCellIds, bool bSinglePiece, TArray<TArray<FIntVector>>& FinalPieces) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(Debris_BuildDetachedPieces);
+
+	// 1. 모든 분리된 셀들의 3D 좌표 (정렬 + 중복 제거, 해시 없음)
+	TArray<int32> UniqueCellIds = DetachedCellIds;
+	UniqueCellIds.Sort();
+	UniqueCellIds.SetNum(Algo::Unique(UniqueCellIds), EAllowShrinking::No);
+
+	TArray<FIntVector> BaseCells;
+	BaseCells.Reserve(UniqueCellIds.Num());
+	for (int32 CellId : UniqueCellIds)
+	{
+		BaseCells.Add(GridCellLayout.IdToCoord(CellId));
+	}
 
 	// TargetDebrisActor가 있으면 분할 없이 단일 조각으로 처리 (서버에서 이미 분할 결정됨)
-	if (TargetDebrisActor || DebrisSplitCount <= 1 || BaseCells.Num() <= 1)
+	if (bSinglePiece || DebrisSplitCount <= 1 || BaseCells.Num() <= 1)
 	{
-		FinalPieces.Add(BaseCells.Array());
+		FinalPieces.Add(MoveTemp(BaseCells));
 	}
 	else
 	{
@@ -1525,8 +2587,7 @@ bool URealtimeDestructibleMeshComponent::RemoveTrianglesForDetachedCells(const T
 			int32 End;
 			int32 Num() const { return End - Start; }
 		};
-		// TSet -> TArray 변환 (분할 작업용)
-		TArray<FIntVector> AllCells = BaseCells.Array();
+		TArray<FIntVector>& AllCells = BaseCells;
 
 		// 각 조각의 [Start, End) 범위를 저장
 
@@ -1606,10 +2667,11 @@ bool URealtimeDestructibleMeshComponent::RemoveTrianglesForDetachedCells(const T
 			FinalPieces.Add(MoveTemp(PieceArr));
 		}
 	}
+}
 
-
-	// 3. 각 조각별로 ToolMesh 생성 + Enqueue
-	UE_LOG(LogTemp, Warning, TEXT("Final Piceses : %d"), FinalPieces.Num());
+bool URealtimeDestructibleMeshComponent::BuildPieceToolMeshes(TArray<FIntVector>& Piece, FDynamicMesh3& OutToolMesh, FDynamicMesh3& OutDebrisToolMesh)
+{
+	using namespace UE::Geometry;
 
 	// 이진탐색용 비교 함수
 	auto VoxelLess = [](const FIntVector& A, const FIntVector& B)
@@ -1619,171 +2681,143 @@ bool URealtimeDestructibleMeshComponent::RemoveTrianglesForDetachedCells(const T
 			return A.X < B.X;
 		};
 
-	for (TArray<FIntVector>& Piece : FinalPieces)
-	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(Debris_FinalPieces);
+	// Piece를 정렬 (이진탐색용)
+	Piece.Sort(VoxelLess);
 
-		if (Piece.Num() == 0)
-		{
-			continue;
-		}
+	// ToolMesh 빌드 (GreedyMesh + FillHoles + Smoothing)
+	OutToolMesh = BuildSmoothedToolMesh(Piece);
 
-		UE_LOG(LogTemp, Warning, TEXT("Piece Size: %d"), Piece.Num());
+	if (OutToolMesh.TriangleCount() == 0)
+	{
+		return false;
+	}
 
-		// Piece를 정렬 (이진탐색용)
-		Piece.Sort(VoxelLess);
+	OutDebrisToolMesh.EnableAttributes();
+	OutDebrisToolMesh.EnableTriangleGroups();
+	OutDebrisToolMesh = OutToolMesh;
 
-		// ToolMesh 빌드 (GreedyMesh + FillHoles + Smoothing)
-		FDynamicMesh3 ToolMesh = BuildSmoothedToolMesh(Piece);
+	// Subtract용만 Scaling 
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(Debris_Scaling);
 
-		if (ToolMesh.TriangleCount() == 0)
+		// 피벗은 조각 셀 중심 - SpawnDebrisActor의 셀 프레임(CellOffset)과 같은 기준
+		FVector3d Centroid = FVector3d::Zero();
+		for (const FIntVector& GridPos : Piece)
 		{
-			continue;
+			Centroid += FVector3d(GridCellLayout.IdToLocalCenter(GridCellLayout.CoordToId(GridPos)));
 		}
-
-		FDynamicMesh3 DebrisToolMesh;
-		DebrisToolMesh.EnableAttributes();
-		DebrisToolMesh.EnableTriangleGroups();
-		DebrisToolMesh = ToolMesh;
-
-
-		// Subtract용만 Scaling 
+		Centroid /= (double)Piece.Num();
+		for (int32 Vid : OutToolMesh.VertexIndicesItr())
 		{
-			TRACE_CPUPROFILER_EVENT_SCOPE(Debris_Scaling);
-
-			FVector3d Centroid = FVector3d::Zero();
-			int32 VertexCount = 0;
-			for (int32 Vid : ToolMesh.VertexIndicesItr())
-			{
-				Centroid += ToolMesh.GetVertex(Vid);
-				VertexCount++;
-			}
-			if (VertexCount > 0)
-			{
-				Centroid /= (double)VertexCount;
-			}
-			for (int32 Vid : ToolMesh.VertexIndicesItr())
-			{
-				FVector3d Pos = ToolMesh.GetVertex(Vid);
+			FVector3d Pos = OutToolMesh.GetVertex(Vid);
 
-				ToolMesh.SetVertex(Vid, Centroid + (Pos - Centroid) * DebrisExpandRatio);
-				DebrisToolMesh.SetVertex(Vid, Centroid + (Pos - Centroid) * DebrisScaleRatio);
-			}
+			OutToolMesh.SetVertex(Vid, Centroid + (Pos - Centroid) * DebrisExpandRatio);
+			OutDebrisToolMesh.SetVertex(Vid, Centroid + (Pos - Centroid) * DebrisScaleRatio);
 		}
+	}
 
-		// ToolMesh(smoothed + DebrisExpandRatio) 삼각형과 겹치는 grid cell 수집
-		if (OutToolMeshOverlappingCellIds)
-		{
-			CollectCellsOverlappingMesh(ToolMesh, *OutToolMeshOverlappingCellIds);
-		}
+	// Smoothing 
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(Debris_Smooth);
+		ApplyHCLaplacianSmoothing(OutDebrisToolMesh);
+	}
 
-		// Smoothing 
-		{
-			TRACE_CPUPROFILER_EVENT_SCOPE(Debris_Smooth);
-			ApplyHCLaplacianSmoothing(DebrisToolMesh);
-		}
+	// Subtract/Intersection용 방향 반전 (겹침 셀 수집은 방향과 무관)
+	OutToolMesh.ReverseOrientation();
+	OutDebrisToolMesh.ReverseOrientation();
+	return true;
+}
 
-		ToolMesh.ReverseOrientation();
-		DebrisToolMesh.ReverseOrientation();
+void URealtimeDestructibleMeshComponent::EnqueuePieceRemoval(const TSharedPtr<FDynamicMesh3>& SharedToolMesh, const TSharedPtr<FDynamicMesh3>& SharedDebrisToolMesh,
+	const TArray<int32>& DetachedCellIds, ADebrisActor* TargetDebrisActor, int32 PieceIndex, int32 NumPieces, int32 PieceCellCount,
+	TArray<int32>&& PieceCellIds)
+{
+	using namespace UE::Geometry;
 
-		// Debug 그리기
-		if (bDebugMeshIslandRemoval)
+	// Debug 그리기
+	if (bDebugMeshIslandRemoval)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(Debris_DebugMeshIslandRemoval);
+		if (UWorld* DebugWorld = GetWorld())
 		{
-			TRACE_CPUPROFILER_EVENT_SCOPE(Debris_DebugMeshIslandRemoval);
-			if (UWorld* DebugWorld = GetWorld())
-			{
-				FTransform ComponentTransform = GetComponentTransform();
-				FDynamicMesh3 DebugMesh = ToolMesh;
-				DebugMesh.ReverseOrientation(); // 시각화용 원래 방향
-
-				for (int32 TriId : DebugMesh.TriangleIndicesItr())
-				{
-					FIndex3i Tri = DebugMesh.GetTriangle(TriId);
-					FVector V0 = ComponentTransform.TransformPosition(FVector(DebugMesh.GetVertex(Tri.A)));
-					FVector V1 = ComponentTransform.TransformPosition(FVector(DebugMesh.GetVertex(Tri.B)));
-					FVector V2 = ComponentTransform.TransformPosition(FVector(DebugMesh.GetVertex(Tri.C)));
-					DrawDebugLine(DebugWorld, V0, V1, FColor::Yellow, false, 4.5f, 0, 1.0f);
-					DrawDebugLine(DebugWorld, V1, V2, FColor::Yellow, false, 4.5f, 0, 1.0f);
-					DrawDebugLine(DebugWorld, V2, V0, FColor::Yellow, false, 4.5f, 0, 1.0f);
-				}
-			}
-		} 
+			FTransform ComponentTransform = GetComponentTransform();
+			const FDynamicMesh3& DebugMesh = *SharedToolMesh;
 
-		// Detect chunks to be subtracted
-		TSharedPtr<FDynamicMesh3> SharedToolMesh = MakeShared<FDynamicMesh3>(MoveTemp(ToolMesh));
-		TSharedPtr<FDynamicMesh3> SharedDebrisToolMesh = MakeShared<FDynamicMesh3>(MoveTemp(DebrisToolMesh));
-
-		FAxisAlignedBox3d ToolBounds = SharedToolMesh->GetBounds();
-		 
-		TArray<int32> OverlappingChunks;
-
-		for (int32 i = 0; i < GetChunkNum(); i++)
-		{
-			if (ChunkMeshComponents[i] && ChunkMeshComponents[i]->GetMesh())
-			{ 
-				if (ChunkMeshComponents[i]->GetMesh()->GetBounds().Intersects(ToolBounds))
-	  			{
-					OverlappingChunks.Add(i);
-				} 
+			for (int32 TriId : DebugMesh.TriangleIndicesItr())
+			{
+				FIndex3i Tri = DebugMesh.GetTriangle(TriId);
+				FVector V0 = ComponentTransform.TransformPosition(FVector(DebugMesh.GetVertex(Tri.A)));
+				FVector V1 = ComponentTransform.TransformPosition(FVector(DebugMesh.GetVertex(Tri.B)));
+				FVector V2 = ComponentTransform.TransformPosition(FVector(DebugMesh.GetVertex(Tri.C)));
+				DrawDebugLine(DebugWorld, V0, V1, FColor::Yellow, false, 4.5f, 0, 1.0f);
+				DrawDebugLine(DebugWorld, V1, V2, FColor::Yellow, false, 4.5f, 0, 1.0f);
+				DrawDebugLine(DebugWorld, V2, V0, FColor::Yellow, false, 4.5f, 0, 1.0f);
 			}
 		}
-		 
-		UE_LOG(LogTemp, Warning, TEXT("Piece %d/%d: CellCount=%d, OverlappingChunks=%d, ChunkIndices=[%s]"),
-			FinalPieces.IndexOfByKey(Piece),
-			FinalPieces.Num(),
-			Piece.Num(),
-			OverlappingChunks.Num(),
-			*FString::JoinBy(OverlappingChunks, TEXT(","), [](int32 x) { return FString::FromInt(x); }));
+	} 
 
-		if (OverlappingChunks.Num() == 0)
-		{
-			continue;
+	// Detect chunks to be subtracted
+	FAxisAlignedBox3d ToolBounds = SharedToolMesh->GetBounds();
+	 
+	TArray<int32> OverlappingChunks;
+
+	for (int32 i = 0; i < GetChunkNum(); i++)
+	{
+		if (ChunkMeshComponents[i] && ChunkMeshComponents[i]->GetMesh())
+		{ 
+			if (ChunkMeshComponents[i]->GetMesh()->GetBounds().Intersects(ToolBounds))
+  			{
+				OverlappingChunks.Add(i);
+			} 
 		}
+	}
+	 
+	UE_LOG(LogTemp, Warning, TEXT("Piece %d/%d: CellCount=%d, OverlappingChunks=%d, ChunkIndices=[%s]"),
+		PieceIndex,
+		NumPieces,
+		PieceCellCount,
+		OverlappingChunks.Num(),
+		*FString::JoinBy(OverlappingChunks, TEXT(","), [](int32 x) { return FString::FromInt(x); }));
 
-		TSharedPtr<FIslandRemovalContext> Context = nullptr;
+	if (OverlappingChunks.Num() == 0)
+	{
+		return;
+	}
 
-		//if (Piece.Num() >= MinCellsForDebris)
-		{
-			Context = MakeShared<FIslandRemovalContext>();
-			Context->Owner = this;
-			Context->RemainingTaskCount = OverlappingChunks.Num();
+	TSharedPtr<FIslandRemovalContext> Context = MakeShared<FIslandRemovalContext>();
+	Context->Owner = this;
+	Context->RemainingTaskCount = OverlappingChunks.Num();
 
-			// TargetDebrisActor가 있으면 설정 (클라이언트에서 기존 DebrisActor에 메시 적용)
-			if (TargetDebrisActor)
-			{
-				Context->TargetDebrisActor = TargetDebrisActor;
-			}
+	// TargetDebrisActor가 있으면 설정 (클라이언트에서 기존 DebrisActor에 메시 적용)
+	if (TargetDebrisActor)
+	{
+		Context->TargetDebrisActor = TargetDebrisActor;
+	}
 
-			// Cleanup용 분리된 셀 저장 (모든 작업 완료 시 사용)
-			Context->DisconnectedCellsForCleanup.Append(DetachedCellIds);
+	// Cleanup용 분리된 셀 저장 (모든 작업 완료 시 사용)
+	Context->DisconnectedCellsForCleanup.Append(DetachedCellIds);
+	Context->PieceCellIds = MoveTemp(PieceCellIds);
 
-			// 활성 IslandRemoval 카운터 증가 (Boolean 배치 완료 시 Cleanup 스킵 판단용)
-			IncrementIslandRemovalCount();
-		}
+	// 활성 IslandRemoval 카운터 증가 (Boolean 배치 완료 시 Cleanup 스킵 판단용)
+	IncrementIslandRemovalCount();
 
-		if (BooleanProcessor.IsValid())
+	if (BooleanProcessor.IsValid())
+	{
+		for (int32 ChunkIndex : OverlappingChunks)
 		{
-			for (int32 ChunkIndex : OverlappingChunks)
-			{
-				TRACE_CPUPROFILER_EVENT_SCOPE(Debris_EnqueueIslandRemoval);
-				//BooleanProcessor->EnqueueIslandRemoval(ChunkIndex, SharedToolMesh, Context);
-
-				UE_LOG(LogTemp, Warning, TEXT("EnqueueIslandRemoval: Piece=%d, ChunkIndex=%d, ToolMesh Tris=%d, Context=%p"),
-					FinalPieces.IndexOfByKey(Piece),
-					ChunkIndex,
-					SharedToolMesh->TriangleCount(),
-					Context.Get());
-
-
-				BooleanProcessor->EnqueueIslandRemoval(ChunkIndex, SharedToolMesh, SharedDebrisToolMesh, Context);
-			}
-		} 
-	}
+			TRACE_CPUPROFILER_EVENT_SCOPE(Debris_EnqueueIslandRemoval);
 
-	return true;
+			UE_LOG(LogTemp, Warning, TEXT("EnqueueIslandRemoval: Piece=%d, ChunkIndex=%d, ToolMesh Tris=%d, Context=%p"),
+				PieceIndex,
+				ChunkIndex,
+				SharedToolMesh->TriangleCount(),
+				Context.Get());
 
-	
+			BooleanProcessor->EnqueueIslandRemoval(ChunkIndex, SharedToolMesh, SharedDebrisToolMesh, Context);
+		}
+	} 
 }
+
 FDynamicMesh3 URealtimeDestructibleMeshComponent::BuildSmoothedToolMesh(TArray<FIntVector>& SortedPiece)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(Debris_BuildSmoothedToolMesh);
@@ -1824,52 +2858,103 @@ void URealtimeDestructibleMeshComponent::CollectCellsOverlappingMesh(const FDyna
 	TRACE_CPUPROFILER_EVENT_SCOPE(Debris_CollectCellsOverlappingMesh);
 	using namespace UE::Geometry;
 
-	const FVector& Origin = GridCellLayout.GridOrigin;
-	const FVector& CS = GridCellLayout.CellSize;
-	const FVector InvCS(1.0 / CS.X, 1.0 / CS.Y, 1.0 / CS.Z);
+	const int32 TotalCells = GridCellLayout.GetTotalCellCount();
+	if (TotalCells <= 0 || Mesh.TriangleCount() == 0)
+	{
+		return;
+	}
+
+	// 재사용 bitset으로 중복 제거 (AddUnique O(n²) 제거), 기존 OutCellIds도 중복으로 취급
+	if (OverlapCellBits.Num() != TotalCells)
+	{
+		OverlapCellBits.Init(false, TotalCells);
+	}
+	for (int32 CellId : OutCellIds)
+	{
+		if (CellId >= 0 && CellId < TotalCells)
+		{
+			OverlapCellBits[CellId] = true;
+		}
+	}
+	const int32 NumExisting = OutCellIds.Num();
+
+	auto AddCell = [this, &OutCellIds](int32 CellId)
+	{
+		if (!OverlapCellBits[CellId])
+		{
+			OverlapCellBits[CellId] = true;
+			OutCellIds.Add(CellId);
+		}
+	};
 
-	for (int32 TriId : Mesh.TriangleIndicesItr())
+	auto RasterizeTriangle = [&Mesh, this](int32 TriId, TFunctionRef<void(int32)> Visit)
 	{
-		FIndex3i Tri = Mesh.GetTriangle(TriId);
-		FVector3d V0 = Mesh.GetVertex(Tri.A);
-		FVector3d V1 = Mesh.GetVertex(Tri.B);
-		FVector3d V2 = Mesh.GetVertex(Tri.C);
+		const FIndex3i Tri = Mesh.GetTriangle(TriId);
+		FGridCellBuilder::RasterizeTriangleConservative(
+			FVector(Mesh.GetVertex(Tri.A)), FVector(Mesh.GetVertex(Tri.B)), FVector(Mesh.GetVertex(Tri.C)),
+			GridCellLayout, Visit);
+	};
 
-		// 삼각형 AABB
-		FVector3d TriMin = FVector3d::Min(FVector3d::Min(V0, V1), V2);
-		FVector3d TriMax = FVector3d::Max(FVector3d::Max(V0, V1), V2);
+	// 삼각형이 많으면 구간 단위 병렬 래스터화 → 구간별 결과를 bitset으로 병합
+	constexpr int32 TrianglesPerTask = 64;
+	const int32 MaxTriangleId = Mesh.MaxTriangleID();
+	const int32 NumTasks = FMath::DivideAndRoundUp(MaxTriangleId, TrianglesPerTask);
 
-		// grid 좌표 범위로 변환
-		const int32 CMinX = FMath::Max(0, FMath::FloorToInt32((TriMin.X - Origin.X) * InvCS.X));
-		const int32 CMinY = FMath::Max(0, FMath::FloorToInt32((TriMin.Y - Origin.Y) * InvCS.Y));
-		const int32 CMinZ = FMath::Max(0, FMath::FloorToInt32((TriMin.Z - Origin.Z) * InvCS.Z));
-		const int32 CMaxX = FMath::Min(GridCellLayout.GridSize.X - 1, FMath::FloorToInt32((TriMax.X - Origin.X) * InvCS.X));
-		const int32 CMaxY = FMath::Min(GridCellLayout.GridSize.Y - 1, FMath::FloorToInt32((TriMax.Y - Origin.Y) * InvCS.Y));
-		const int32 CMaxZ = FMath::Min(GridCellLayout.GridSize.Z - 1, FMath::FloorToInt32((TriMax.Z - Origin.Z) * InvCS.Z));
+	if (NumTasks > 4)
+	{
+		TArray<TArray<int32>> TaskHits;
+		TaskHits.SetNum(NumTasks);
 
-		for (int32 Z = CMinZ; Z <= CMaxZ; ++Z)
+		ParallelFor(NumTasks, [&](int32 TaskIndex)
 		{
-			for (int32 Y = CMinY; Y <= CMaxY; ++Y)
+			TArray<int32>& Hits = TaskHits[TaskIndex];
+			const int32 Begin = TaskIndex * TrianglesPerTask;
+			const int32 End = FMath::Min(Begin + TrianglesPerTask, MaxTriangleId);
+			for (int32 TriId = Begin; TriId < End; ++TriId)
 			{
-				for (int32 X = CMinX; X <= CMaxX; ++X)
+				if (Mesh.IsTriangle(TriId))
 				{
-					const int32 CellId = GridCellLayout.CoordToId(X, Y, Z);
-					if (GridCellLayout.GetCellExists(CellId) &&
-						!CellState.DestroyedCells.Contains(CellId))
-					{
-						FVector CellMin(Origin.X + X * CS.X, Origin.Y + Y * CS.Y, Origin.Z + Z * CS.Z);
-						FVector CellMax = CellMin + FVector(CS);
-
-						if (FGridCellBuilder::TriangleIntersectsAABB(
-							FVector(V0), FVector(V1), FVector(V2), CellMin, CellMax))
-						{
-							OutCellIds.AddUnique(CellId);
-						}
-					}
+					RasterizeTriangle(TriId, [&Hits](int32 CellId) { Hits.Add(CellId); });
 				}
 			}
+		});
+
+		for (const TArray<int32>& Hits : TaskHits)
+		{
+			for (int32 CellId : Hits)
+			{
+				AddCell(CellId);
+			}
+		}
+	}
+	else
+	{
+		for (int32 TriId : Mesh.TriangleIndicesItr())
+		{
+			RasterizeTriangle(TriId, AddCell);
+		}
+	}
+
+	// 파괴 셀 검사는 고유 셀당 1회, 다음 호출을 위해 사용한 비트만 초기화
+	for (int32 i = 0; i < OutCellIds.Num(); ++i)
+	{
+		const int32 CellId = OutCellIds[i];
+		if (CellId >= 0 && CellId < TotalCells)
+		{
+			OverlapCellBits[CellId] = false;
+		}
+	}
+
+	int32 WriteIndex = NumExisting;
+	for (int32 ReadIndex = NumExisting; ReadIndex < OutCellIds.Num(); ++ReadIndex)
+	{
+		const int32 CellId = OutCellIds[ReadIndex];
+		if (!CellState.DestroyedCells.Contains(CellId))
+		{
+			OutCellIds[WriteIndex++] = CellId;
 		}
 	}
+	OutCellIds.SetNum(WriteIndex, EAllowShrinking::No);
 }
 
 void URealtimeDestructibleMeshComponent::CollectToolMeshOverlappingCells(const TArray<int32>& CellIds, TArray<int32>& OutOverlappingCellIds)
@@ -2236,7 +3321,8 @@ FDynamicMesh3 URealtimeDestructibleMeshComponent::GenerateGreedyMeshFromVoxels(c
 	return ResultMesh; 
 }
 
-void URealtimeDestructibleMeshComponent::SpawnDebrisActor(FDynamicMesh3&& Source, const TArray<UMaterialInterface*>& Materials, ADebrisActor* TargetActor)
+void URealtimeDestructibleMeshComponent::SpawnDebrisActor(FDynamicMesh3&& Source, const TArray<UMaterialInterface*>& Materials, ADebrisActor* TargetActor,
+	const TArray<int32>* PieceCellIds)
 {
 	using namespace UE::Geometry;
 
@@ -2513,8 +3599,23 @@ void URealtimeDestructibleMeshComponent::SpawnDebrisActor(FDynamicMesh3&& Source
 		// Material;
 		UMaterialInterface* DebrisMaterial = Materials.Num() > 0 ? Materials[0] : nullptr;
 
-		// Init Debris Actor
-		DebrisActor->InitializeDebris(DebrisId, TArray<int32>() , INDEX_NONE, this, DebrisMaterial);
+		// Init Debris Actor
+		DebrisActor->InitializeDebris(DebrisId, TArray<int32>() , INDEX_NONE, this, DebrisMaterial);
+
+		// 2차 파괴용 셀 프레임 (복제 안 함 - 리슨 클라이언트는 로컬 메시 매칭 유지)
+		// 메시는 조각 셀 중심 기준 DebrisScaleRatio로 축소 후 (BuildPieceToolMeshes) MeshCenter 기준으로 배치됨
+		if (PieceCellIds && PieceCellIds->Num() > 0)
+		{
+			FVector CellCentroid = FVector::ZeroVector;
+			for (int32 CellId : *PieceCellIds)
+			{
+				CellCentroid += GridCellLayout.IdToLocalCenter(CellId);
+			}
+			CellCentroid /= PieceCellIds->Num();
+
+			const FVector CellOffset = CellCentroid * (1.0f - DebrisScaleRatio) - FVector(MeshCenter);
+			DebrisActor->SetCellFrame(*PieceCellIds, DebrisScaleRatio, CellOffset);
+		}
 
 
 		if (!bIsDedicatedServer)
@@ -2640,318 +3741,828 @@ void URealtimeDestructibleMeshComponent::SpawnDebrisActor(FDynamicMesh3&& Source
 			}
 		}
 	}
-	
-	// -------------------------------------------------------------------------
-	// 11. 수명 설정 및 로그
-	// -------------------------------------------------------------------------
-	
-	// 10초 후 자동 삭제 (메모리 관리)
-	//DebrisActor->SetLifeSpan(10.0f); 
+	
+	// -------------------------------------------------------------------------
+	// 11. 수명 설정 및 로그
+	// -------------------------------------------------------------------------
+	
+	// 10초 후 자동 삭제 (메모리 관리)
+	//DebrisActor->SetLifeSpan(10.0f); 
+}
+
+void URealtimeDestructibleMeshComponent::SpawnDebrisActorForDedicatedServer(const TArray<int32>& DetachedCellIds, TArray<ADebrisActor*>* OutEventActors)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(Debris_SpawnDebrisActorForDedicatedServer);
+
+	if (DetachedCellIds.Num() == 0)
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	// 서버 권한 체크
+	if (!GetOwner() || !GetOwner()->HasAuthority())
+	{
+		return;
+	}
+
+	FTransform ComponentTransform = GetComponentTransform();
+
+	// =========================================================================
+	// 1~2. CellIds → Grid 좌표 + Split (DebrisSplitCount 기반, 클라이언트와 동일 로직)
+	// =========================================================================
+	TArray<TArray<FIntVector>> FinalPieces;
+	BuildDetachedPieces(DetachedCellIds, false, FinalPieces);
+
+	// =========================================================================
+	// 3. 각 조각별로 메시 없는 Debris 프록시 스폰 (병합 박스 compound 콜리전)
+	// =========================================================================
+	UMaterialInterface* DebrisMaterial = GetMaterial(0);
+
+	TArray<ADebrisActor*> SpawnedActors;
+
+	for (const TArray<FIntVector>& Piece : FinalPieces)
+	{
+		if (Piece.Num() == 0)
+		{
+			continue;
+		}
+
+		// Grid 좌표를 CellId로 변환
+		TArray<int32> PieceCellIds;
+		PieceCellIds.Reserve(Piece.Num());
+		for (const FIntVector& GridPos : Piece)
+		{
+			if (GridCellLayout.IsValidCoord(GridPos))
+			{
+				PieceCellIds.Add(GridCellLayout.CoordToId(GridPos));
+			}
+		}
+
+		if (PieceCellIds.Num() == 0)
+		{
+			continue;
+		}
+
+		// 셀 박스 병합 (로컬 스페이스) + 바운딩박스
+		TArray<FBox> MergedBoxes;
+		BuildMergedCellBoxes(Piece, MergedBoxes);
+
+		FBox CellBounds(ForceInit);
+		for (const FBox& Box : MergedBoxes)
+		{
+			CellBounds += Box;
+		}
+
+		FVector LocalCenter = CellBounds.GetCenter();
+		FVector SpawnLocation = ComponentTransform.TransformPosition(LocalCenter);
+		FVector BoxExtent = CellBounds.GetExtent();
+		BoxExtent *= DebrisScaleRatio;
+		BoxExtent = BoxExtent.ComponentMax(FVector(1.0f, 1.0f, 1.0f));
+
+		// 동기화 여부 판정 (작은 조각은 스킵)
+		if (BoxExtent.GetMax() < MinDebrisSyncSize)
+		{
+			UE_LOG(LogTemp, Log, TEXT("[DediServer] Debris piece too small, skipping - Size=%f"), BoxExtent.GetMax());
+			continue;
+		}
+
+		// Debris ID 생성
+		const int32 DebrisId = NextDebrisId++;
+
+		// Debris Actor 스폰
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		ADebrisActor* DebrisActor = World->SpawnActor<ADebrisActor>(
+			ADebrisActor::StaticClass(),
+			SpawnLocation,
+			ComponentTransform.GetRotation().Rotator(),
+			SpawnParams
+		);
+
+		if (!DebrisActor)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[DediServer] Failed to spawn ADebrisActor"));
+			continue;
+		}
+
+		DebrisActor->SetActorScale3D(ComponentTransform.GetScale3D());
+
+		// CellIds 전달 - 클라이언트가 이걸로 메시 생성
+		DebrisActor->InitializeDebris(DebrisId, PieceCellIds, INDEX_NONE, this, DebrisMaterial);
+		DebrisActor->SetCellFrame(PieceCellIds, DebrisScaleRatio, -LocalCenter * DebrisScaleRatio);
+
+		// 콜리전: 바운딩 박스(쿼리/클라이언트 기본값) → 서버 물리는 병합 박스 compound로 교체
+		DebrisActor->SetCollisionBoxExtent(BoxExtent);
+		DebrisActor->EnablePhysics();
+
+		TArray<FKBoxElem> ProxyBoxes;
+		ProxyBoxes.Reserve(MergedBoxes.Num());
+		for (const FBox& Box : MergedBoxes)
+		{
+			// 조각 중심 기준, 시각 메시와 같은 DebrisScaleRatio 적용
+			const FVector Size = Box.GetSize() * DebrisScaleRatio;
+			FKBoxElem BoxElem(Size.X, Size.Y, Size.Z);
+			BoxElem.Center = (Box.GetCenter() - LocalCenter) * DebrisScaleRatio;
+			ProxyBoxes.Add(BoxElem);
+		}
+		DebrisActor->SetCompoundCollision(ProxyBoxes);
+
+		// 질량은 실제 물리 지오메트리(compound 박스) 부피 기준 (바운딩 박스 부피 아님)
+		ApplyDebrisPhysics(DebrisActor->CollisionBox, SpawnLocation, BoxExtent, DebrisActor->CollisionBox->GetBodyVolume());
+
+		// 추적 맵에 추가
+		ActiveDebrisActors.Add(DebrisId, DebrisActor);
+		SpawnedActors.Add(DebrisActor);
+
+		UE_LOG(LogTemp, Log, TEXT("[DediServer] SpawnDebrisActorForDedicatedServer: DebrisId=%d, CellCount=%d, Boxes=%d, Location=%s, Material=%s"),
+			DebrisId, PieceCellIds.Num(), ProxyBoxes.Num(), *SpawnLocation.ToString(), DebrisMaterial ? *DebrisMaterial->GetName() : TEXT("NULL"));
+	}
+
+	// 분리 이벤트 태깅 (호출자가 여러 그룹을 묶는 경우 호출자가 처리)
+	if (OutEventActors)
+	{
+		OutEventActors->Append(SpawnedActors);
+	}
+	else
+	{
+		AssignDetachEvent(SpawnedActors);
+	}
+}
+
+void URealtimeDestructibleMeshComponent::AssignDetachEvent(const TArray<ADebrisActor*>& EventActors)
+{
+	if (EventActors.Num() == 0)
+	{
+		return;
+	}
+
+	// 스폰과 같은 프레임에 설정되므로 초기 복제 번들에 함께 실림
+	const int32 EventId = NextDetachEventId++;
+	for (ADebrisActor* DebrisActor : EventActors)
+	{
+		if (IsValid(DebrisActor))
+		{
+			DebrisActor->SetDetachEvent(EventId, EventActors.Num());
+		}
+	}
+}
+
+void URealtimeDestructibleMeshComponent::SpawnSecondaryDebris(const TArray<int32>& PieceCellIds, const FTransform& CellToWorld,
+	const FVector& LinearVelocity, const FVector& AngularVelocity)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(Debris_SpawnSecondaryDebris);
+
+	UWorld* World = GetWorld();
+	if (!World || PieceCellIds.Num() == 0 || !GetOwner() || !GetOwner()->HasAuthority())
+	{
+		return;
+	}
+
+	// 셀 → Grid 좌표 → 병합 박스 (로컬 스페이스)
+	TArray<FIntVector> Piece;
+	Piece.Reserve(PieceCellIds.Num());
+	for (int32 CellId : PieceCellIds)
+	{
+		Piece.Add(GridCellLayout.IdToCoord(CellId));
+	}
+
+	TArray<FBox> MergedBoxes;
+	BuildMergedCellBoxes(Piece, MergedBoxes);
+
+	FBox CellBounds(ForceInit);
+	for (const FBox& Box : MergedBoxes)
+	{
+		CellBounds += Box;
+	}
+
+	if (!CellBounds.IsValid)
+	{
+		return;
+	}
+
+	const FVector LocalCenter = CellBounds.GetCenter();
+	const FVector SpawnLocation = CellToWorld.TransformPosition(LocalCenter);
+	const FVector BoxExtent = CellBounds.GetExtent().ComponentMax(FVector(1.0f, 1.0f, 1.0f));
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	ADebrisActor* DebrisActor = World->SpawnActor<ADebrisActor>(
+		ADebrisActor::StaticClass(),
+		SpawnLocation,
+		CellToWorld.GetRotation().Rotator(),
+		SpawnParams
+	);
+
+	if (!DebrisActor)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[Debris Actor] Failed to spawn secondary ADebrisActor"));
+		return;
+	}
+
+	// 부모 Debris의 축소 비율이 스케일에 포함됨
+	DebrisActor->SetActorScale3D(CellToWorld.GetScale3D());
+
+	// 2차 파편은 별도 ID 범위 사용 - 리슨 클라이언트의 결정적 NextDebrisId 매칭을 깨지 않도록
+	const int32 DebrisId = NextSecondaryDebrisId++;
+	DebrisActor->InitializeDebris(DebrisId, PieceCellIds, INDEX_NONE, this, GetMaterial(0));
+	DebrisActor->SetCellFrame(PieceCellIds, 1.0f, -LocalCenter);
+
+	// 메시는 셀에서 바로 생성 (클라이언트도 비트맵으로 동일하게 생성, Boolean 없음)
+	DebrisActor->BuildCellMesh();
+
+	DebrisActor->SetCollisionBoxExtent(BoxExtent);
+	DebrisActor->EnablePhysics();
+
+	TArray<FKBoxElem> ProxyBoxes;
+	ProxyBoxes.Reserve(MergedBoxes.Num());
+	for (const FBox& Box : MergedBoxes)
+	{
+		const FVector Size = Box.GetSize();
+		FKBoxElem BoxElem(Size.X, Size.Y, Size.Z);
+		BoxElem.Center = Box.GetCenter() - LocalCenter;
+		ProxyBoxes.Add(BoxElem);
+	}
+	DebrisActor->SetCompoundCollision(ProxyBoxes);
+
+	// 질량은 compound 박스 부피 기준 - 관성과 같은 지오메트리
+	ApplyDebrisPhysics(DebrisActor->CollisionBox, SpawnLocation, BoxExtent, DebrisActor->CollisionBox->GetBodyVolume());
+
+	// 부모 속도 이어받기 (ApplyDebrisPhysics의 분리 임펄스 위에 더함)
+	DebrisActor->CollisionBox->SetPhysicsLinearVelocity(LinearVelocity, true);
+	DebrisActor->CollisionBox->SetPhysicsAngularVelocityInDegrees(AngularVelocity, true);
+
+	ActiveDebrisActors.Add(DebrisId, DebrisActor);
+
+	UE_LOG(LogTemp, Log, TEXT("[Debris Actor] SpawnSecondaryDebris: DebrisId=%d, CellCount=%d, Boxes=%d"),
+		DebrisId, PieceCellIds.Num(), ProxyBoxes.Num());
+}
+
+void URealtimeDestructibleMeshComponent::BuildMergedCellBoxes(const TArray<FIntVector>& Piece, TArray<FBox>& OutLocalBoxes) const
+{
+	OutLocalBoxes.Reset();
+	if (Piece.Num() == 0)
+	{
+		return;
+	}
+
+	// 조각 바운딩 범위 안의 dense 점유 비트맵 (해시 없음)
+	FIntVector Min(TNumericLimits<int32>::Max());
+	FIntVector Max(TNumericLimits<int32>::Lowest());
+	for (const FIntVector& C : Piece)
+	{
+		Min = FIntVector(FMath::Min(Min.X, C.X), FMath::Min(Min.Y, C.Y), FMath::Min(Min.Z, C.Z));
+		Max = FIntVector(FMath::Max(Max.X, C.X), FMath::Max(Max.Y, C.Y), FMath::Max(Max.Z, C.Z));
+	}
+
+	const FIntVector Dim = Max - Min + FIntVector(1);
+	auto Index = [&Dim](int32 X, int32 Y, int32 Z) { return X + Y * Dim.X + Z * Dim.X * Dim.Y; };
+
+	TBitArray<> Occupied(false, Dim.X * Dim.Y * Dim.Z);
+	for (const FIntVector& C : Piece)
+	{
+		const FIntVector L = C - Min;
+		Occupied[Index(L.X, L.Y, L.Z)] = true;
+	}
+
+	// Greedy 병합: X → Y → Z 순으로 최대한 확장하고 사용한 셀은 비움
+	const FVector& CellSize = GridCellLayout.CellSize;
+	const FVector& Origin = GridCellLayout.GridOrigin;
+
+	for (int32 Z = 0; Z < Dim.Z; ++Z)
+	{
+		for (int32 Y = 0; Y < Dim.Y; ++Y)
+		{
+			for (int32 X = 0; X < Dim.X; ++X)
+			{
+				if (!Occupied[Index(X, Y, Z)])
+				{
+					continue;
+				}
+
+				int32 EndX = X + 1;
+				while (EndX < Dim.X && Occupied[Index(EndX, Y, Z)])
+				{
+					++EndX;
+				}
+
+				auto RowFilled = [&](int32 RY, int32 RZ)
+				{
+					for (int32 RX = X; RX < EndX; ++RX)
+					{
+						if (!Occupied[Index(RX, RY, RZ)])
+						{
+							return false;
+						}
+					}
+					return true;
+				};
+
+				int32 EndY = Y + 1;
+				while (EndY < Dim.Y && RowFilled(EndY, Z))
+				{
+					++EndY;
+				}
+
+				int32 EndZ = Z + 1;
+				while (EndZ < Dim.Z)
+				{
+					bool bSlabFilled = true;
+					for (int32 SY = Y; SY < EndY && bSlabFilled; ++SY)
+					{
+						bSlabFilled = RowFilled(SY, EndZ);
+					}
+					if (!bSlabFilled)
+					{
+						break;
+					}
+					++EndZ;
+				}
+
+				for (int32 CZ = Z; CZ < EndZ; ++CZ)
+				{
+					for (int32 CY = Y; CY < EndY; ++CY)
+					{
+						for (int32 CX = X; CX < EndX; ++CX)
+						{
+							Occupied[Index(CX, CY, CZ)] = false;
+						}
+					}
+				}
+
+				const FVector BoxMin = Origin + FVector(Min.X + X, Min.Y + Y, Min.Z + Z) * CellSize;
+				const FVector BoxMax = Origin + FVector(Min.X + EndX, Min.Y + EndY, Min.Z + EndZ) * CellSize;
+				OutLocalBoxes.Add(FBox(BoxMin, BoxMax));
+			}
+		}
+	}
+}
+
+bool URealtimeDestructibleMeshComponent::CanExtractDebrisForClient() const
+{
+	// BooleanProcessor가 유효한지 확인
+	if (!BooleanProcessor.IsValid())
+	{
+		return false;
+	}
+
+	// ChunkMeshComponents에 유효한 메시가 있는지 확인
+	for (int32 i = 0; i < ChunkMeshComponents.Num(); i++)
+	{
+		if (ChunkMeshComponents[i] && ChunkMeshComponents[i]->GetMesh() &&
+			ChunkMeshComponents[i]->GetMesh()->TriangleCount() > 0)
+		{
+			return true;
+		}
+	}
+
+	return false;
 }
 
-void URealtimeDestructibleMeshComponent::SpawnDebrisActorForDedicatedServer(const TArray<int32>& DetachedCellIds)
+void URealtimeDestructibleMeshComponent::RegisterLocalDebris(int32 InDebrisId, UProceduralMeshComponent* Mesh)
 {
-	if (DetachedCellIds.Num() == 0)
+	if (!Mesh || InDebrisId == INDEX_NONE)
 	{
 		return;
 	}
 
-	UWorld* World = GetWorld();
-	if (!World)
+	// 이미 대기 중인 Actor가 있는 지 확인
+	if (TObjectPtr<ADebrisActor>* FoundActor = PendingDebrisActors.Find(InDebrisId))
 	{
-		return;
+		// Actor가 먼저 도착해서 대기 중이였으면, 바로 매칭
+		UE_LOG(LogTemp, Warning, TEXT("[Debris Actor] Found pending actor for DebrisId=%d, applying mesh now"), InDebrisId);
+
+		ADebrisActor* DebrisActor = *FoundActor;
+		PendingDebrisActors.Remove(InDebrisId);
+
+		if (DebrisActor)
+		{
+			DebrisActor->ApplyLocalMesh(Mesh); 
+		}
+
+		// TempActor 정리
+		AActor* TempActor = Mesh->GetOwner();
+		if (TempActor)
+		{
+			TempActor->Destroy();
+		}
 	}
+	else
+	{
+		// 로컬 메쉬 먼저 등록 
+		LocalDebrisMeshMap.Add(InDebrisId, Mesh);
+		UE_LOG(LogTemp, Warning, TEXT("[Debris Actor] RegisterLocalDebris - DebrisId=%d"), InDebrisId);
+	} 
+}
 
-	// 서버 권한 체크
-	if (!GetOwner() || !GetOwner()->HasAuthority())
+void URealtimeDestructibleMeshComponent::RegisterPendingDebrisActor(int32 InDebrisId, ADebrisActor* Actor)
+{
+	if (Actor && InDebrisId != INDEX_NONE)
 	{
-		return;
+		PendingDebrisActors.Add(InDebrisId, Actor);
+		UE_LOG(LogTemp, Warning, TEXT("[Debris Actor] Actor registered as pending - DebrisId=%d"), InDebrisId);
 	}
+}
 
-	FTransform ComponentTransform = GetComponentTransform();
-	const FVector CellSizeVec = GridCellLayout.CellSize;
+UProceduralMeshComponent* URealtimeDestructibleMeshComponent::FindAndRemoveLocalDebris(int32 InDebrisId)
+{
+	TObjectPtr<UProceduralMeshComponent> Found = nullptr;
 
-	// =========================================================================
-	// 1. CellIds를 Grid 좌표로 변환
-	// =========================================================================
-	TSet<FIntVector> BaseCells;
-	for (int32 CellId : DetachedCellIds)
+	if (LocalDebrisMeshMap.RemoveAndCopyValue(InDebrisId, Found))
 	{
-		//const FVector LocalMin = GridCellLayout.IdToLocalMin(CellId);
-		//const FVector Origin = GridCellLayout.GridOrigin;
-		//
-		//FIntVector GridPos(
-		//	FMath::FloorToInt((LocalMin.X - Origin.X) / CellSizeVec.X),
-		//	FMath::FloorToInt((LocalMin.Y - Origin.Y) / CellSizeVec.Y),
-		//	FMath::FloorToInt((LocalMin.Z - Origin.Z) / CellSizeVec.Z)
-		//);
-		//BaseCells.Add(GridPos);
-		//
-
-		FIntVector GridPos = GridCellLayout.IdToCoord(CellId);
-		BaseCells.Add(GridPos);
+		UE_LOG(LogTemp, Warning, TEXT("[Debris Actor] Found DebridId=%d") , InDebrisId);
+		return Found;
 	}
 
-	// =========================================================================
-	// 2. Split 로직 (DebrisSplitCount 기반)
-	// =========================================================================
-	TArray<TArray<FIntVector>> FinalPieces;
+	UE_LOG(LogTemp, Error, TEXT("[Debris Actor] Not Found DebridId=%d") , InDebrisId);
+	return nullptr;
+}
 
-	if (DebrisSplitCount <= 1 || BaseCells.Num() <= 1)
+void URealtimeDestructibleMeshComponent::QueueClientDebrisExtraction(ADebrisActor* Actor)
+{
+	if (!IsValid(Actor) || Actor->CellIds.Num() == 0)
 	{
-		FinalPieces.Add(BaseCells.Array());
+		return;
 	}
-	else
+
+	// 이벤트 정보가 없거나 단독 Debris면 바로 추출
+	const int32 EventId = Actor->DetachEventId;
+	if (EventId == INDEX_NONE || Actor->DetachEventSize <= 1)
 	{
-		struct FPieceRange
-		{
-			int32 Start;
-			int32 End;
-			int32 Num() const { return End - Start; }
-		};
+		ExtractClientDebrisBatch({ Actor });
+		return;
+	}
 
-		TArray<FIntVector> AllCells = BaseCells.Array();
-		TArray<FPieceRange> Ranges;
-		Ranges.Add({ 0, AllCells.Num() });
+	FPendingDebrisExtraction& Pending = PendingDebrisExtractions.FindOrAdd(EventId);
+	if (Pending.Actors.Num() == 0)
+	{
+		Pending.FirstArrivalTime = FPlatformTime::Seconds();
+	}
+	Pending.ExpectedCount = Actor->DetachEventSize;
+	Pending.Actors.Add(Actor);
 
-		while (Ranges.Num() < DebrisSplitCount)
+	// 이벤트의 Debris가 모두 도착하면 즉시 추출
+	if (Pending.Actors.Num() >= Pending.ExpectedCount)
+	{
+		TArray<ADebrisActor*> Actors;
+		for (const TWeakObjectPtr<ADebrisActor>& PendingActor : Pending.Actors)
 		{
-			// 가장 큰 조각 찾기
-			int32 LargestIdx = 0;
-			for (int32 i = 1; i < Ranges.Num(); i++)
-			{
-				if (Ranges[i].Num() > Ranges[LargestIdx].Num())
-				{
-					LargestIdx = i;
-				}
-			}
-
-			if (Ranges[LargestIdx].Num() <= 1)
+			if (PendingActor.IsValid())
 			{
-				break;
+				Actors.Add(PendingActor.Get());
 			}
+		}
+		PendingDebrisExtractions.Remove(EventId);
+		ExtractClientDebrisBatch(Actors);
+		return;
+	}
 
-			FPieceRange& Range = Ranges[LargestIdx];
-
-			// 바운딩박스 계산 + 가장 긴 축 찾기
-			FIntVector MinBB(TNumericLimits<int32>::Max());
-			FIntVector MaxBB(TNumericLimits<int32>::Lowest());
-			for (int32 i = Range.Start; i < Range.End; i++)
-			{
-				MinBB.X = FMath::Min(MinBB.X, AllCells[i].X);
-				MinBB.Y = FMath::Min(MinBB.Y, AllCells[i].Y);
-				MinBB.Z = FMath::Min(MinBB.Z, AllCells[i].Z);
-				MaxBB.X = FMath::Max(MaxBB.X, AllCells[i].X);
-				MaxBB.Y = FMath::Max(MaxBB.Y, AllCells[i].Y);
-				MaxBB.Z = FMath::Max(MaxBB.Z, AllCells[i].Z);
-			}
+	// Relevancy 등으로 일부가 오지 않을 수 있으므로 대기 시간 후에는 도착한 것만 추출
+	if (UWorld* World = GetWorld())
+	{
+		if (!World->GetTimerManager().IsTimerActive(DebrisExtractionTimerHandle))
+		{
+			World->GetTimerManager().SetTimer(DebrisExtractionTimerHandle, this,
+				&URealtimeDestructibleMeshComponent::FlushPendingDebrisExtractions, DebrisExtractionGroupWindow, false);
+		}
+	}
+}
 
-			int32 ExtX = MaxBB.X - MinBB.X;
-			int32 ExtY = MaxBB.Y - MinBB.Y;
-			int32 ExtZ = MaxBB.Z - MinBB.Z;
-			int32 SplitAxis = (ExtX >= ExtY && ExtX >= ExtZ) ? 0 : (ExtY >= ExtZ ? 1 : 2);
+void URealtimeDestructibleMeshComponent::FlushPendingDebrisExtractions()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(Debris_FlushPendingExtractions);
 
-			int32 MidIdx = Range.Start + Range.Num() / 2;
-			auto GetAxisValue = [SplitAxis](const FIntVector& V) -> int32
-			{
-				return SplitAxis == 0 ? V.X : (SplitAxis == 1 ? V.Y : V.Z);
-			};
+	const double Now = FPlatformTime::Seconds();
+	double OldestRemaining = TNumericLimits<double>::Max();
 
-			// 가장 긴 축 기준 정렬
-			TArrayView<FIntVector> SortView(&AllCells[Range.Start], Range.Num());
-			SortView.Sort([&](const FIntVector& A, const FIntVector& B)
-			{
-				return GetAxisValue(A) < GetAxisValue(B);
-			});
+	TArray<TArray<ADebrisActor*>> ReadyBatches;
+	for (auto It = PendingDebrisExtractions.CreateIterator(); It; ++It)
+	{
+		FPendingDebrisExtraction& Pending = It.Value();
+		if (Now - Pending.FirstArrivalTime < DebrisExtractionGroupWindow)
+		{
+			OldestRemaining = FMath::Min(OldestRemaining, Pending.FirstArrivalTime);
+			continue;
+		}
 
-			if (MidIdx == Range.Start || MidIdx == Range.End)
+		TArray<ADebrisActor*>& Actors = ReadyBatches.AddDefaulted_GetRef();
+		for (const TWeakObjectPtr<ADebrisActor>& PendingActor : Pending.Actors)
+		{
+			if (PendingActor.IsValid())
 			{
-				break;
+				Actors.Add(PendingActor.Get());
 			}
-
-			// Range를 둘로 분할
-			int32 OldEnd = Range.End;
-			Range.End = MidIdx;
-			Ranges.Add({ MidIdx, OldEnd });
 		}
+		It.RemoveCurrent();
+	}
 
-		// 각 범위를 TArray로 복사
-		for (const FPieceRange& Range : Ranges)
+	for (const TArray<ADebrisActor*>& Actors : ReadyBatches)
+	{
+		ExtractClientDebrisBatch(Actors);
+	}
+
+	// 아직 대기 중인 이벤트가 있으면 가장 오래된 이벤트 기준으로 다시 예약
+	if (PendingDebrisExtractions.Num() > 0)
+	{
+		if (UWorld* World = GetWorld())
 		{
-			TArray<FIntVector> PieceArr(&AllCells[Range.Start], Range.Num());
-			FinalPieces.Add(MoveTemp(PieceArr));
+			const float Delay = FMath::Max(0.01f, static_cast<float>(OldestRemaining + DebrisExtractionGroupWindow - Now));
+			World->GetTimerManager().SetTimer(DebrisExtractionTimerHandle, this,
+				&URealtimeDestructibleMeshComponent::FlushPendingDebrisExtractions, Delay, false);
 		}
 	}
+}
 
-	// =========================================================================
-	// 3. 각 조각별로 Debris Actor 스폰
-	// =========================================================================
-	UMaterialInterface* DebrisMaterial = GetMaterial(0);
+void URealtimeDestructibleMeshComponent::ExtractClientDebrisBatch(const TArray<ADebrisActor*>& Actors)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(Debris_ExtractClientDebrisBatch);
+	using namespace UE::Geometry;
 
-	for (const TArray<FIntVector>& Piece : FinalPieces)
+	if (!CanExtractDebrisForClient())
 	{
-		if (Piece.Num() == 0)
+		return;
+	}
+
+	// 파편 정리용 초기화 (RemoveTrianglesForDetachedCells와 동일)
+	LastOccupiedCells.Empty();
+	LastCellSizeVec = GridCellLayout.CellSize;
+
+	TSharedPtr<FIslandRemovalContext> Context = MakeShared<FIslandRemovalContext>();
+	Context->Owner = this;
+
+	// 1. 조각(Actor)별 ToolMesh 생성 - 서버에서 이미 분할되었으므로 Actor 하나가 조각 하나
+	TArray<FDynamicMesh3> ToolMeshes;
+	TArray<FDynamicMesh3> DebrisToolMeshes;
+	for (ADebrisActor* Actor : Actors)
+	{
+		if (!IsValid(Actor) || Actor->CellIds.Num() == 0)
 		{
 			continue;
 		}
 
-		// Grid 좌표를 CellId로 변환
-		TArray<int32> PieceCellIds;
-		PieceCellIds.Reserve(Piece.Num());
-		for (const FIntVector& GridPos : Piece)
+		TArray<FIntVector> Piece;
+		Piece.Reserve(Actor->CellIds.Num());
+		for (int32 CellId : Actor->CellIds)
 		{
-			if (GridCellLayout.IsValidCoord(GridPos))
-			{
-				PieceCellIds.Add(GridCellLayout.CoordToId(GridPos));
-			}
+			Piece.Add(GridCellLayout.IdToCoord(CellId));
 		}
 
-		if (PieceCellIds.Num() == 0)
+		FDynamicMesh3 ToolMesh;
+		FDynamicMesh3 DebrisToolMesh;
+		if (!BuildPieceToolMeshes(Piece, ToolMesh, DebrisToolMesh))
 		{
 			continue;
 		}
 
-		// 바운딩박스 계산
-		FBox CellBounds(ForceInit);
-		for (int32 CellId : PieceCellIds)
-		{
-			FVector CellMin = GridCellLayout.IdToLocalMin(CellId);
-			FVector CellMax = CellMin + GridCellLayout.CellSize;
-			CellBounds += CellMin;
-			CellBounds += CellMax;
-		}
+		ToolMeshes.Add(MoveTemp(ToolMesh));
+		DebrisToolMeshes.Add(MoveTemp(DebrisToolMesh));
+		Context->BatchDebrisActors.Add(Actor);
+		Context->BatchPieceCellIds.Add(Actor->CellIds);
+		Context->DisconnectedCellsForCleanup.Append(Actor->CellIds);
+	}
 
-		FVector LocalCenter = CellBounds.GetCenter();
-		FVector SpawnLocation = ComponentTransform.TransformPosition(LocalCenter);
-		FVector BoxExtent = CellBounds.GetExtent();
-		BoxExtent *= DebrisScaleRatio;
-		//BoxExtent *= ComponentTransform.GetScale3D();
-		BoxExtent = BoxExtent.ComponentMax(FVector(1.0f, 1.0f, 1.0f));
-		//BoxExtent = BoxExtent.ComponentMax(FVector(1.0f, 1.0f, 1.0f));
+	if (ToolMeshes.Num() == 0)
+	{
+		return;
+	}
 
-		// 동기화 여부 판정 (작은 조각은 스킵)
-		if (BoxExtent.GetMax() < MinDebrisSyncSize)
+	UE_LOG(LogTemp, Log, TEXT("[Client] ExtractClientDebrisBatch: %d debris in one extraction"), ToolMeshes.Num());
+
+	// 2. 조각 ToolMesh 합집합은 작은 메시끼리의 연산이므로 백그라운드에서 처리 후 Game Thread에서 Enqueue
+	IncrementIslandRemovalCount();
+
+	TWeakObjectPtr<URealtimeDestructibleMeshComponent> WeakThis(this);
+	UE::Tasks::Launch(UE_SOURCE_LOCATION,
+		[WeakThis, ToolMeshes = MoveTemp(ToolMeshes), DebrisToolMeshes = MoveTemp(DebrisToolMeshes), Context]() mutable
 		{
-			UE_LOG(LogTemp, Log, TEXT("[DediServer] Debris piece too small, skipping - Size=%f"), BoxExtent.GetMax());
-			continue;
-		}
+			TRACE_CPUPROFILER_EVENT_SCOPE(Debris_UnionBatchToolMeshes);
 
-		// Debris ID 생성
-		const int32 DebrisId = NextDebrisId++;
+			TSharedPtr<FDynamicMesh3> SharedToolMesh = MakeShared<FDynamicMesh3>(UnionToolMeshes(MoveTemp(ToolMeshes)));
+			TSharedPtr<FDynamicMesh3> SharedDebrisToolMesh = MakeShared<FDynamicMesh3>(UnionToolMeshes(MoveTemp(DebrisToolMeshes)));
 
-		// Debris Actor 스폰
-		FActorSpawnParameters SpawnParams;
-		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, SharedToolMesh, SharedDebrisToolMesh, Context]()
+			{
+				if (URealtimeDestructibleMeshComponent* Owner = WeakThis.Get())
+				{
+					Owner->EnqueueBatchedRemoval(SharedToolMesh, SharedDebrisToolMesh, Context);
+				}
+			});
+		},
+		UE::Tasks::ETaskPriority::BackgroundNormal);
+}
 
-		ADebrisActor* DebrisActor = World->SpawnActor<ADebrisActor>(
-			ADebrisActor::StaticClass(),
-			SpawnLocation,
-			ComponentTransform.GetRotation().Rotator(),
-			SpawnParams
-		);
+FDynamicMesh3 URealtimeDestructibleMeshComponent::UnionToolMeshes(TArray<FDynamicMesh3>&& ToolMeshes)
+{
+	using namespace UE::Geometry;
 
-		if (!DebrisActor)
+	if (ToolMeshes.Num() == 0)
+	{
+		return FDynamicMesh3();
+	}
+
+	// ToolMesh는 Subtract/Intersection용으로 뒤집혀 있으므로 원래 방향으로 합친 뒤 다시 뒤집음
+	for (FDynamicMesh3& ToolMesh : ToolMeshes)
+	{
+		ToolMesh.ReverseOrientation();
+	}
+
+	FGeometryScriptMeshBooleanOptions Options;
+	Options.bFillHoles = true;
+	Options.bSimplifyOutput = false;
+
+	// 짝지어 합치기 (누적 메시가 커지는 순차 합집합보다 연산량이 적음)
+	while (ToolMeshes.Num() > 1)
+	{
+		TArray<FDynamicMesh3> Merged;
+		Merged.Reserve((ToolMeshes.Num() + 1) / 2);
+		for (int32 i = 0; i + 1 < ToolMeshes.Num(); i += 2)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("[DediServer] Failed to spawn ADebrisActor"));
-			continue;
+			FDynamicMesh3 Result;
+			if (FRealtimeBooleanProcessor::ApplyMeshBooleanAsync(&ToolMeshes[i], &ToolMeshes[i + 1], &Result,
+				EGeometryScriptBooleanOperation::Union, Options))
+			{
+				Merged.Add(MoveTemp(Result));
+			}
+			else
+			{
+				// 실패 시 단순 병합 (겹치지 않는 조각이면 합집합과 동일)
+				FDynamicMeshEditor Editor(&ToolMeshes[i]);
+				FMeshIndexMappings Mappings;
+				Editor.AppendMesh(&ToolMeshes[i + 1], Mappings);
+				Merged.Add(MoveTemp(ToolMeshes[i]));
+			}
+		}
+		if (ToolMeshes.Num() % 2 == 1)
+		{
+			Merged.Add(MoveTemp(ToolMeshes.Last()));
 		}
+		ToolMeshes = MoveTemp(Merged);
+	}
 
-		DebrisActor->SetActorScale3D(ComponentTransform.GetScale3D());
+	FDynamicMesh3 Combined = MoveTemp(ToolMeshes[0]);
+	Combined.ReverseOrientation();
+	return Combined;
+}
 
-		// CellIds 전달 - 클라이언트가 이걸로 메시 생성
-		DebrisActor->InitializeDebris(DebrisId, PieceCellIds, INDEX_NONE, this, DebrisMaterial);
+void URealtimeDestructibleMeshComponent::EnqueueBatchedRemoval(const TSharedPtr<FDynamicMesh3>& SharedToolMesh,
+	const TSharedPtr<FDynamicMesh3>& SharedDebrisToolMesh, const TSharedPtr<FIslandRemovalContext>& Context)
+{
+	using namespace UE::Geometry;
 
-		// 콜리전 및 물리 설정
-		DebrisActor->SetCollisionBoxExtent(BoxExtent);
-		DebrisActor->EnablePhysics();
-		ApplyDebrisPhysics(DebrisActor->CollisionBox, SpawnLocation, BoxExtent);
+	if (!BooleanProcessor.IsValid() || SharedToolMesh->TriangleCount() == 0)
+	{
+		DecrementIslandRemovalCount();
+		return;
+	}
 
-		// 추적 맵에 추가
-		ActiveDebrisActors.Add(DebrisId, DebrisActor);
+	// 합쳐진 ToolMesh와 겹치는 청크만 한 번씩 처리
+	const FAxisAlignedBox3d ToolBounds = SharedToolMesh->GetBounds();
+	TArray<int32> OverlappingChunks;
+	for (int32 i = 0; i < GetChunkNum(); i++)
+	{
+		if (ChunkMeshComponents[i] && ChunkMeshComponents[i]->GetMesh()
+			&& ChunkMeshComponents[i]->GetMesh()->GetBounds().Intersects(ToolBounds))
+		{
+			OverlappingChunks.Add(i);
+		}
+	}
+
+	if (OverlappingChunks.Num() == 0)
+	{
+		DecrementIslandRemovalCount();
+		return;
+	}
 
-		UE_LOG(LogTemp, Warning, TEXT("[DediServer] SpawnDebrisActorForDedicatedServer: DebrisId=%d, CellCount=%d, Location=%s, Material=%s"),
-			DebrisId, PieceCellIds.Num(), *SpawnLocation.ToString(), DebrisMaterial ? *DebrisMaterial->GetName() : TEXT("NULL"));
+	UE_LOG(LogTemp, Log, TEXT("[Client] EnqueueBatchedRemoval: Debris=%d, OverlappingChunks=%d"),
+		Context->BatchDebrisActors.Num(), OverlappingChunks.Num());
+
+	Context->RemainingTaskCount = OverlappingChunks.Num();
+	for (int32 ChunkIndex : OverlappingChunks)
+	{
+		BooleanProcessor->EnqueueIslandRemoval(ChunkIndex, SharedToolMesh, SharedDebrisToolMesh, Context);
 	}
 }
 
-bool URealtimeDestructibleMeshComponent::CanExtractDebrisForClient() const
+void URealtimeDestructibleMeshComponent::DistributeBatchedDebris(FDynamicMesh3&& Source, const TArray<UMaterialInterface*>& Materials,
+	const FIslandRemovalContext& Context)
 {
-	// BooleanProcessor가 유효한지 확인
-	if (!BooleanProcessor.IsValid())
+	TRACE_CPUPROFILER_EVENT_SCOPE(Debris_DistributeBatchedDebris);
+	using namespace UE::Geometry;
+
+	const int32 NumActors = Context.BatchDebrisActors.Num();
+	if (NumActors == 0 || Source.TriangleCount() == 0)
 	{
-		return false;
+		return;
 	}
 
-	// ChunkMeshComponents에 유효한 메시가 있는지 확인
-	for (int32 i = 0; i < ChunkMeshComponents.Num(); i++)
+	// 단일 Debris면 분배 없이 적용
+	if (NumActors == 1)
 	{
-		if (ChunkMeshComponents[i] && ChunkMeshComponents[i]->GetMesh() &&
-			ChunkMeshComponents[i]->GetMesh()->TriangleCount() > 0)
+		if (ADebrisActor* Actor = Context.BatchDebrisActors[0].Get())
 		{
-			return true;
+			SpawnDebrisActor(MoveTemp(Source), Materials, Actor);
 		}
+		return;
 	}
 
-	return false;
-}
-
-void URealtimeDestructibleMeshComponent::RegisterLocalDebris(int32 InDebrisId, UProceduralMeshComponent* Mesh)
-{
-	if (!Mesh || InDebrisId == INDEX_NONE)
+	// 셀 → 조각 인덱스, 조각 중심 (로컬)
+	TMap<int32, int32> CellToPiece;
+	TArray<FVector3d> PieceCenters;
+	PieceCenters.SetNumZeroed(NumActors);
+	for (int32 PieceIndex = 0; PieceIndex < NumActors; ++PieceIndex)
 	{
-		return;
+		const TArray<int32>& PieceCells = Context.BatchPieceCellIds[PieceIndex];
+		for (int32 CellId : PieceCells)
+		{
+			CellToPiece.Add(CellId, PieceIndex);
+			PieceCenters[PieceIndex] += FVector3d(GridCellLayout.IdToLocalCenter(CellId));
+		}
+		if (PieceCells.Num() > 0)
+		{
+			PieceCenters[PieceIndex] /= PieceCells.Num();
+		}
 	}
 
-	// 이미 대기 중인 Actor가 있는 지 확인
-	if (TObjectPtr<ADebrisActor>* FoundActor = PendingDebrisActors.Find(InDebrisId))
+	// 교집합 결과의 연결 요소를 중심이 속한 셀의 조각에 배정 (없으면 가장 가까운 조각)
+	FMeshConnectedComponents ConnectedComponents(&Source);
+	ConnectedComponents.FindConnectedTriangles();
+
+	TArray<TArray<int32>> TrianglesByPiece;
+	TrianglesByPiece.SetNum(NumActors);
+	for (int32 i = 0; i < ConnectedComponents.Num(); ++i)
 	{
-		// Actor가 먼저 도착해서 대기 중이였으면, 바로 매칭
-		UE_LOG(LogTemp, Warning, TEXT("[Debris Actor] Found pending actor for DebrisId=%d, applying mesh now"), InDebrisId);
+		const TArray<int32>& Triangles = ConnectedComponents.GetComponent(i).Indices;
+		if (Triangles.Num() == 0)
+		{
+			continue;
+		}
 
-		ADebrisActor* DebrisActor = *FoundActor;
-		PendingDebrisActors.Remove(InDebrisId);
+		FVector3d Centroid = FVector3d::Zero();
+		for (int32 Tid : Triangles)
+		{
+			Centroid += Source.GetTriCentroid(Tid);
+		}
+		Centroid /= Triangles.Num();
 
-		if (DebrisActor)
+		int32 PieceIndex = INDEX_NONE;
+		const FVector RelativePos = FVector(Centroid) - GridCellLayout.GridOrigin;
+		const FIntVector GridCoord(
+			FMath::FloorToInt(RelativePos.X / GridCellLayout.CellSize.X),
+			FMath::FloorToInt(RelativePos.Y / GridCellLayout.CellSize.Y),
+			FMath::FloorToInt(RelativePos.Z / GridCellLayout.CellSize.Z));
+		if (GridCellLayout.IsValidCoord(GridCoord))
 		{
-			DebrisActor->ApplyLocalMesh(Mesh); 
+			if (const int32* Found = CellToPiece.Find(GridCellLayout.CoordToId(GridCoord)))
+			{
+				PieceIndex = *Found;
+			}
 		}
 
-		// TempActor 정리
-		AActor* TempActor = Mesh->GetOwner();
-		if (TempActor)
+		if (PieceIndex == INDEX_NONE)
 		{
-			TempActor->Destroy();
+			double BestDistSq = TNumericLimits<double>::Max();
+			for (int32 j = 0; j < NumActors; ++j)
+			{
+				const double DistSq = FVector3d::DistSquared(Centroid, PieceCenters[j]);
+				if (DistSq < BestDistSq)
+				{
+					BestDistSq = DistSq;
+					PieceIndex = j;
+				}
+			}
 		}
+
+		TrianglesByPiece[PieceIndex].Append(Triangles);
 	}
-	else
-	{
-		// 로컬 메쉬 먼저 등록 
-		LocalDebrisMeshMap.Add(InDebrisId, Mesh);
-		UE_LOG(LogTemp, Warning, TEXT("[Debris Actor] RegisterLocalDebris - DebrisId=%d"), InDebrisId);
-	} 
-}
 
-void URealtimeDestructibleMeshComponent::RegisterPendingDebrisActor(int32 InDebrisId, ADebrisActor* Actor)
-{
-	if (Actor && InDebrisId != INDEX_NONE)
+	// 조각별 메시를 잘라 각 Actor에 적용
+	for (int32 PieceIndex = 0; PieceIndex < NumActors; ++PieceIndex)
 	{
-		PendingDebrisActors.Add(InDebrisId, Actor);
-		UE_LOG(LogTemp, Warning, TEXT("[Debris Actor] Actor registered as pending - DebrisId=%d"), InDebrisId);
-	}
-}
+		ADebrisActor* Actor = Context.BatchDebrisActors[PieceIndex].Get();
+		if (!Actor || TrianglesByPiece[PieceIndex].Num() == 0)
+		{
+			continue;
+		}
 
-UProceduralMeshComponent* URealtimeDestructibleMeshComponent::FindAndRemoveLocalDebris(int32 InDebrisId)
-{
-	TObjectPtr<UProceduralMeshComponent> Found = nullptr;
+		FDynamicMesh3 PieceMesh;
+		PieceMesh.EnableAttributes();
+		PieceMesh.Attributes()->EnableMaterialID();
+		PieceMesh.EnableTriangleGroups();
 
-	if (LocalDebrisMeshMap.RemoveAndCopyValue(InDebrisId, Found))
-	{
-		UE_LOG(LogTemp, Warning, TEXT("[Debris Actor] Found DebridId=%d") , InDebrisId);
-		return Found;
-	}
+		FDynamicMeshEditor Editor(&PieceMesh);
+		FMeshIndexMappings Mappings;
+		FDynamicMeshEditResult EditResult;
+		Editor.AppendTriangles(&Source, TrianglesByPiece[PieceIndex], Mappings, EditResult);
 
-	UE_LOG(LogTemp, Error, TEXT("[Debris Actor] Not Found DebridId=%d") , InDebrisId);
-	return nullptr;
+		SpawnDebrisActor(MoveTemp(PieceMesh), Materials, Actor);
+	}
 }
 
 void URealtimeDestructibleMeshComponent::BroadcastDebrisPhysicsState()
@@ -3400,6 +5011,9 @@ void URealtimeDestructibleMeshComponent::ServerEnqueueOps_Implementation(const T
 		Op.OpId.Value = NextOpId++;
 		Op.Sequence = NextSequence++;
 		Op.Request = Request;
+
+		// 셀 누적 데미지 판정 (셀 파괴와 Multicast 전에, 판정 결과는 Op와 함께 전파)
+		ResolveCellDamage(Op.Request);
 		Ops.Add(Op);
 	}
 
@@ -3412,7 +5026,11 @@ void URealtimeDestructibleMeshComponent::ServerEnqueueOps_Implementation(const T
 		{
 			for (const FRealtimeDestructionOp& Op : Ops)
 			{
-				DestructionLogic(Op.Request);
+				// 데칼만 남는 타격은 셀을 파괴하지 않음
+				if (!Op.Request.bDecalOnly)
+				{
+					DestructionLogic(Op.Request);
+				}
 			}
 		}
 
@@ -3520,7 +5138,7 @@ void URealtimeDestructibleMeshComponent::MulticastDestroyedCells_Implementation(
 	// 클라이언트: CellState에 파괴된 셀 추가 + SuperCell 상태 업데이트
 	for (int32 CellId : DestroyedCellIds)
 	{
-		CellState.DestroyedCells.Add(CellId);
+		CellState.DestroyCell(CellId);
 
 		// SuperCell 상태 업데이트 (Cell 파괴 정보만으로 Server와 동기화)
 		if (bEnableSupercell && SupercellState.IsValid())
@@ -3529,121 +5147,455 @@ void URealtimeDestructibleMeshComponent::MulticastDestroyedCells_Implementation(
 	}
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("[Client] MulticastDestroyedCells: +%d cells, Total=%d"),
-		DestroyedCellIds.Num(), CellState.DestroyedCells.Num());
+	UE_LOG(LogTemp, Log, TEXT("[Client] MulticastDestroyedCells: +%d cells, Total=%d"),
+		DestroyedCellIds.Num(), CellState.DestroyedCells.Num());
+
+	// 클라이언트 Cell Box Collision: 파괴된 셀과 이웃 셀의 청크를 dirty 마킹
+	if (bServerCellCollisionInitialized)
+	{
+		TSet<int32> DirtyChunkIndices;
+		for (int32 CellId : DestroyedCellIds)
+		{
+			int32 ChunkIdx = GetCollisionChunkIndexForCell(CellId);
+			if (ChunkIdx != INDEX_NONE)
+			{
+				DirtyChunkIndices.Add(ChunkIdx);
+			}
+
+			const FIntArray& Neighbors = GridCellLayout.GetCellNeighbors(CellId);
+			for (int32 NeighborId : Neighbors.Values)
+			{
+				int32 NeighborChunkIdx = GetCollisionChunkIndexForCell(NeighborId);
+				if (NeighborChunkIdx != INDEX_NONE)
+				{
+					DirtyChunkIndices.Add(NeighborChunkIdx);
+				}
+			}
+		}
+
+		for (int32 ChunkIdx : DirtyChunkIndices)
+		{
+			MarkCollisionChunkDirty(ChunkIdx);
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("[ClientCellCollision] Marked %d chunks dirty from %d destroyed cells"),
+			DirtyChunkIndices.Num(), DestroyedCellIds.Num());
+	}
+}
+
+void URealtimeDestructibleMeshComponent::MulticastDetachSignal_Implementation(const TArray<FReplicatedDetachedGroup>& DetachedGroups)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	// Structural Integrity 비활성화 시 분리 셀 처리 스킵
+	if (!bEnableStructuralIntegrity)
+	{
+		return;
+	}
+
+	const ENetMode NetMode = World->GetNetMode();
+
+	// DedicatedServer는 스킵 (렌더링 없음)
+	if (NetMode == NM_DedicatedServer)
+	{
+		return;
+	}
+
+	// 서버(리슨 서버)는 FlushServerBatch에서 이미 로컬로 처리함
+	if (GetOwner() && GetOwner()->HasAuthority())
+	{
+		return;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[Client] MulticastDetachSignal RECEIVED - %d server groups"), DetachedGroups.Num());
+
+	if (DetachedGroups.Num() == 0)
+	{
+		CleanupSmallFragments(TSet<int32>());
+		return;
+	}
+
+	// 클라이언트: 서버가 계산한 그룹을 그대로 적용 (자체 BFS 없음)
+	const bool bIsDedicatedServerClient = bServerIsDedicatedServer && !GetOwner()->HasAuthority(); 
+	TArray<int32> GroupCellIds;
+	for (const FReplicatedDetachedGroup& Encoded : DetachedGroups)
+	{
+		Encoded.Decode(GroupCellIds);
+
+		// 로컬에서 이미 파괴된 셀은 제외
+		GroupCellIds.RemoveAllSwap([this](int32 CellId)
+		{
+			return !GridCellLayout.IsValidCellId(CellId) || CellState.DestroyedCells.Contains(CellId);
+		}, EAllowShrinking::No);
+
+		if (GroupCellIds.Num() == 0)
+		{
+			continue;
+		}
+
+		// CellState에 Detached 그룹 추가
+		CellState.AddDetachedGroup(GroupCellIds);
+
+		// 분리된 셀의 삼각형 삭제 (시각적 처리)
+		if (!bIsDedicatedServerClient)
+		{
+			RemoveTrianglesForDetachedCells(GroupCellIds);
+		}
+	}
+
+	// 분리된 셀들을 파괴됨 상태로 이동
+	CellState.MoveAllDetachedToDestroyed();
+
+	// RemoveTriangles 후 작은 파편 정리는 IslandRemoval 완료 콜백에서 처리
+	// (비동기 완료 시 FIslandRemovalContext::DisconnectedCellsForCleanup 사용)
+
+	UE_LOG(LogTemp, Log, TEXT("[Client] Detach processing complete"));
+}
+
+void URealtimeDestructibleMeshComponent::BroadcastCellStateChecksum()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(CellStateChecksum_Broadcast);
+
+	// 파괴 셀 해시는 DestroyCell에서 증분 유지 (최초 1회 또는 RegionSize 변경 시에만 전체 재계산)
+	CellState.EnsureRegionHashes(GridCellLayout, CellStateRegionSize);
+
+	TMap<int32, uint32> RegionHashes;
+	CellState.ComputeRegionHashes(GridCellLayout, CellStateRegionSize, RegionHashes);
+
+	TArray<int32> RegionIds;
+	RegionHashes.GenerateKeyArray(RegionIds);
+	RegionIds.Sort();
+
+	// 커서부터 최대 MaxCellChecksumRegionsPerRPC개 영역만 전송 (Unreliable 페이로드 상한)
+	// 파괴가 없는 구간도 전송 (클라이언트에만 파괴된 셀이 있는 경우 감지)
+	const int32 RangeBegin = CellStateChecksumCursor;
+	int32 Index = Algo::LowerBound(RegionIds, RangeBegin);
+
+	TArray<FCellRegionChecksum> Checksums;
+	Checksums.Reserve(FMath::Min(RegionIds.Num() - Index, MaxCellChecksumRegionsPerRPC));
+	for (; Index < RegionIds.Num() && Checksums.Num() < MaxCellChecksumRegionsPerRPC; ++Index)
+	{
+		FCellRegionChecksum& Checksum = Checksums.AddDefaulted_GetRef();
+		Checksum.RegionId = RegionIds[Index];
+		Checksum.Hash = RegionHashes[Checksum.RegionId];
+	}
+
+	// 남은 영역이 있으면 다음 주기에 그 지점부터, 없으면 처음부터 다시
+	const int32 RangeEnd = Index < RegionIds.Num() ? RegionIds[Index] : MAX_int32;
+	CellStateChecksumCursor = RangeEnd == MAX_int32 ? 0 : RangeEnd;
+
+	MulticastCellStateChecksum(RangeBegin, RangeEnd, Checksums);
+}
+
+void URealtimeDestructibleMeshComponent::MulticastCellStateChecksum_Implementation(int32 RegionRangeBegin, int32 RegionRangeEnd, const TArray<FCellRegionChecksum>& RegionChecksums)
+{
+	UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() != NM_Client)
+	{
+		return;
+	}
+
+	// Late Join 적용 전에는 비교하지 않음 (아직 전체 상태를 받지 못함)
+	if (!GridCellLayout.IsValid() || (bLateJoinCellsReceived && !bLateJoinApplied))
+	{
+		return;
+	}
+
+	// 비정상 구간이나 상한을 넘는 페이로드는 무시
+	if (RegionRangeBegin < 0 || RegionRangeEnd <= RegionRangeBegin || RegionChecksums.Num() > MaxCellChecksumRegionsPerRPC)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(CellStateChecksum_Compare);
+
+	CellState.EnsureRegionHashes(GridCellLayout, CellStateRegionSize);
+
+	TMap<int32, uint32> LocalHashes;
+	CellState.ComputeRegionHashes(GridCellLayout, CellStateRegionSize, LocalHashes);
+
+	auto IsInRange = [RegionRangeBegin, RegionRangeEnd](int32 RegionId)
+	{
+		return RegionId >= RegionRangeBegin && RegionId < RegionRangeEnd;
+	};
+
+	// 서버 해시와 다른 영역 + 클라이언트에만 파괴 셀이 있는 영역 (이번 구간 안에서만)
+	TSet<int32> MismatchedRegions;
+	for (const FCellRegionChecksum& Checksum : RegionChecksums)
+	{
+		if (!IsInRange(Checksum.RegionId))
+		{
+			continue;
+		}
+		const uint32* LocalHash = LocalHashes.Find(Checksum.RegionId);
+		if (!LocalHash || *LocalHash != Checksum.Hash)
+		{
+			MismatchedRegions.Add(Checksum.RegionId);
+		}
+		LocalHashes.Remove(Checksum.RegionId);
+	}
+	for (const TPair<int32, uint32>& Pair : LocalHashes)
+	{
+		if (IsInRange(Pair.Key))
+		{
+			MismatchedRegions.Add(Pair.Key);
+		}
+	}
+
+	// 두 번 연속 불일치한 영역만 재동기화 (전송 중인 Op로 인한 일시적 차이 무시)
+	TArray<int32> ResyncRegions;
+	for (int32 RegionId : MismatchedRegions)
+	{
+		if (SuspectCellRegions.Contains(RegionId) && ResyncRegions.Num() < MaxCellResyncRegionsPerRequest)
+		{
+			ResyncRegions.Add(RegionId);
+		}
+	}
+
+	// 의심 영역은 이번 구간 것만 교체 (다른 구간은 다음 슬라이스에서 판정)
+	for (auto It = SuspectCellRegions.CreateIterator(); It; ++It)
+	{
+		if (IsInRange(*It))
+		{
+			It.RemoveCurrent();
+		}
+	}
+	SuspectCellRegions.Append(MismatchedRegions);
+
+	if (ResyncRegions.Num() == 0)
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if (Now - LastCellResyncRequestTime < CellStateChecksumInterval)
+	{
+		return;
+	}
+
+	// 클라이언트 소유 액터(PlayerController)의 NetworkComponent를 통해 Server RPC 전송
+	APlayerController* PC = World->GetFirstPlayerController();
+	UDestructionNetworkComponent* NetComp = PC ? PC->FindComponentByClass<UDestructionNetworkComponent>() : nullptr;
+	if (!NetComp)
+	{
+		// 매 체크섬마다 반복되므로 한 번만 경고
+		if (!bWarnedMissingResyncNetComponent)
+		{
+			bWarnedMissingResyncNetComponent = true;
+			UE_LOG(LogTemp, Warning, TEXT("[CellChecksum] %d regions diverged but no DestructionNetworkComponent on PlayerController"), ResyncRegions.Num());
+		}
+		return;
+	}
+
+	LastCellResyncRequestTime = Now;
+	UE_LOG(LogTemp, Warning, TEXT("[CellChecksum] %d regions diverged from server, requesting resync"), ResyncRegions.Num());
+	NetComp->ServerRequestCellResync(this, ResyncRegions);
+}
+
+void URealtimeDestructibleMeshComponent::BuildCellRegionResync(const TArray<int32>& RegionIds, TArray<FReplicatedDetachedGroup>& OutRegionCells) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(CellStateChecksum_BuildResync);
+
+	OutRegionCells.Reset();
+	OutRegionCells.SetNum(RegionIds.Num());
+	if (!GridCellLayout.IsValid())
+	{
+		return;
+	}
+
+	TMap<int32, int32> RegionToIndex;
+	for (int32 i = 0; i < RegionIds.Num(); ++i)
+	{
+		RegionToIndex.Add(RegionIds[i], i);
+	}
+
+	TArray<TArray<int32>> CellsPerRegion;
+	CellsPerRegion.SetNum(RegionIds.Num());
 
-	// 클라이언트 Cell Box Collision: 파괴된 셀과 이웃 셀의 청크를 dirty 마킹
-	if (bServerCellCollisionInitialized)
+	auto CollectCell = [&](int32 CellId)
 	{
-		TSet<int32> DirtyChunkIndices;
-		for (int32 CellId : DestroyedCellIds)
+		if (const int32* Index = RegionToIndex.Find(FCellState::GetRegionId(GridCellLayout, CellId, CellStateRegionSize)))
 		{
-			int32 ChunkIdx = GetCollisionChunkIndexForCell(CellId);
-			if (ChunkIdx != INDEX_NONE)
-			{
-				DirtyChunkIndices.Add(ChunkIdx);
-			}
-
-			const FIntArray& Neighbors = GridCellLayout.GetCellNeighbors(CellId);
-			for (int32 NeighborId : Neighbors.Values)
-			{
-				int32 NeighborChunkIdx = GetCollisionChunkIndexForCell(NeighborId);
-				if (NeighborChunkIdx != INDEX_NONE)
-				{
-					DirtyChunkIndices.Add(NeighborChunkIdx);
-				}
-			}
+			CellsPerRegion[*Index].Add(CellId);
 		}
+	};
 
-		for (int32 ChunkIdx : DirtyChunkIndices)
+	for (int32 CellId : CellState.DestroyedCells)
+	{
+		CollectCell(CellId);
+	}
+	for (const FDetachedGroupWithSubCell& Group : CellState.DetachedGroups)
+	{
+		for (int32 CellId : Group.DetachedCellIds)
 		{
-			MarkCollisionChunkDirty(ChunkIdx);
+			CollectCell(CellId);
 		}
+	}
 
-		UE_LOG(LogTemp, Log, TEXT("[ClientCellCollision] Marked %d chunks dirty from %d destroyed cells"),
-			DirtyChunkIndices.Num(), DestroyedCellIds.Num());
+	for (int32 i = 0; i < RegionIds.Num(); ++i)
+	{
+		OutRegionCells[i] = FReplicatedDetachedGroup::Encode(CellsPerRegion[i]);
 	}
 }
 
-void URealtimeDestructibleMeshComponent::MulticastDetachSignal_Implementation()
+bool URealtimeDestructibleMeshComponent::CheckCellResyncCooldown(APlayerController* Player)
 {
-	UWorld* World = GetWorld();
-	if (!World)
+	if (!Player)
 	{
-		return;
+		return false;
 	}
 
-	// Structural Integrity 비활성화 시 분리 셀 처리 스킵
-	if (!bEnableStructuralIntegrity)
+	const double CurrentTime = FPlatformTime::Seconds();
+	double& LastTime = PlayerCellResyncTimes.FindOrAdd(Player, -DBL_MAX);
+
+	// 클라이언트 요청 주기(체크섬 간격)보다 빠른 요청은 거부
+	if (CurrentTime - LastTime < CellStateChecksumInterval)
 	{
-		return;
+		UE_LOG(LogTemp, Warning, TEXT("[CellChecksum] 플레이어 %s: 재동기화 요청 간격 %.2fs (최소: %.2fs)"),
+			*Player->GetName(), CurrentTime - LastTime, CellStateChecksumInterval);
+		return false;
 	}
 
-	const ENetMode NetMode = World->GetNetMode();
+	LastTime = CurrentTime;
+	return true;
+}
 
-	// DedicatedServer는 스킵 (렌더링 없음)
-	if (NetMode == NM_DedicatedServer)
+void URealtimeDestructibleMeshComponent::ApplyCellRegionResync(const TArray<int32>& RegionIds, const TArray<FReplicatedDetachedGroup>& RegionCells)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(CellStateChecksum_ApplyResync);
+
+	if (!GridCellLayout.IsValid() || RegionIds.Num() != RegionCells.Num())
 	{
 		return;
 	}
 
-	//// 서버는 이미 로컬에서 처리했으므로 스킵
-	//if (GetOwner() && GetOwner()->HasAuthority())
-	//{
-	//	return;
-	//}
-
-	UE_LOG(LogTemp, Warning, TEXT("[Client] MulticastDetachSignal RECEIVED - Running local BFS"));
+	// 서버 기준 셀 집합
+	TSet<int32> ResyncRegionSet(RegionIds);
+	TSet<int32> ServerCells;
+	TArray<int32> DecodedCells;
+	for (const FReplicatedDetachedGroup& Encoded : RegionCells)
+	{
+		Encoded.Decode(DecodedCells);
+		for (int32 CellId : DecodedCells)
+		{
+			if (GridCellLayout.IsValidCellId(CellId)
+				&& ResyncRegionSet.Contains(FCellState::GetRegionId(GridCellLayout, CellId, CellStateRegionSize)))
+			{
+				ServerCells.Add(CellId);
+			}
+		}
+	}
 
-	// 클라이언트: 자체 BFS 실행하여 분리된 셀 찾기
-	// 통합 API 사용: 서버와 동일한 알고리즘으로 일관성 유지
-	// Multiplayer: SubCell 상태는 Client에 동기화되지 않으므로 Standalone에서만 사용
-	TSet<int32> DisconnectedCells = FCellDestructionSystem::FindDisconnectedCells(
-		GridCellLayout,
-		SupercellState,
-		CellState,
-		bEnableSupercell && SupercellState.IsValid(),
-		bEnableSubcell && (NetMode == NM_Standalone),
-		CellContext); // subcell 동기화 안 하므로 subcell은 standalone에서만 허용 
+	// 클라이언트에만 파괴된 셀 (메시는 복원 불가, CellState만 서버에 맞춤)
+	TArray<int32> ExtraCells;
+	for (int32 CellId : CellState.DestroyedCells)
+	{
+		if (!ServerCells.Contains(CellId)
+			&& ResyncRegionSet.Contains(FCellState::GetRegionId(GridCellLayout, CellId, CellStateRegionSize)))
+		{
+			ExtraCells.Add(CellId);
+		}
+	}
+	for (int32 CellId : ExtraCells)
+	{
+		CellState.RestoreCell(CellId);
+	}
 
-	if (DisconnectedCells.Num() == 0)
+	// 서버에서만 파괴된 셀 (Late Join Phase 1 / 1.5와 동일하게 적용)
+	TArray<int32> MissingCells;
+	for (int32 CellId : ServerCells)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[Client] BFS result: No disconnected cells"));
-		CleanupSmallFragments(DisconnectedCells);
-		return;
+		if (!CellState.DestroyedCells.Contains(CellId))
+		{
+			MissingCells.Add(CellId);
+			CellState.DestroyCell(CellId);
+
+			if (bEnableSupercell && SupercellState.IsValid())
+			{
+				SupercellState.OnCellDestroyed(CellId);
+			}
+		}
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("[Client] BFS result: %d disconnected cells"), DisconnectedCells.Num());
+	// 영향받은 supercell의 파괴 셀 수를 현재 CellState 기준으로 재계산 (복원/추가 모두 반영)
+	if (bEnableSupercell && SupercellState.IsValid())
+	{
+		TSet<int32> TouchedSupercells;
+		for (int32 CellId : ExtraCells)
+		{
+			TouchedSupercells.Add(SupercellState.GetSupercellForCell(CellId));
+		}
+		for (int32 CellId : MissingCells)
+		{
+			TouchedSupercells.Add(SupercellState.GetSupercellForCell(CellId));
+		}
 
-	// 분리된 셀 그룹화
-	TArray<TArray<int32>> DetachedGroups = FCellDestructionSystem::GroupDetachedCells(
-		GridCellLayout,
-		DisconnectedCells,
-		CellState.DestroyedCells);
+		TArray<int32> SupercellCells;
+		for (int32 SuperCellId : TouchedSupercells)
+		{
+			// 강제 제거된 supercell은 카운트가 0으로 초기화되어 있으므로 유지
+			if (!SupercellState.DestroyedCellCounts.IsValidIndex(SuperCellId)
+				|| SupercellState.InitialValidCellCounts[SuperCellId] <= 0)
+			{
+				continue;
+			}
 
-	UE_LOG(LogTemp, Warning, TEXT("[Client] Grouped into %d debris groups"), DetachedGroups.Num());
+			SupercellState.GetCellsInSupercell(SuperCellId, GridCellLayout, SupercellCells);
+			int32 DestroyedCount = 0;
+			for (int32 CellId : SupercellCells)
+			{
+				if (CellState.DestroyedCells.Contains(CellId))
+				{
+					++DestroyedCount;
+				}
+			}
+			SupercellState.DestroyedCellCounts[SuperCellId] = DestroyedCount;
+		}
+	}
 
-	const bool bIsDedicatedServerClient = bServerIsDedicatedServer && !GetOwner()->HasAuthority(); 
-	// 각 그룹에 대해 처리
-	for (const TArray<int32>& Group : DetachedGroups)
+	if (bServerCellCollisionInitialized)
 	{
-		// CellState에 Detached 그룹 추가
-		CellState.AddDetachedGroup(Group);
-
-		// 분리된 셀의 삼각형 삭제 (시각적 처리)
-		if (!bIsDedicatedServerClient)
+		TSet<int32> DirtyChunkIndices;
+		auto MarkCellDirty = [&](int32 CellId)
+		{
+			const int32 ChunkIdx = GetCollisionChunkIndexForCell(CellId);
+			if (ChunkIdx != INDEX_NONE)
+			{
+				DirtyChunkIndices.Add(ChunkIdx);
+			}
+		};
+		for (int32 CellId : MissingCells)
+		{
+			MarkCellDirty(CellId);
+			for (int32 NeighborId : GridCellLayout.GetCellNeighbors(CellId).Values)
+			{
+				MarkCellDirty(NeighborId);
+			}
+		}
+		for (int32 CellId : ExtraCells)
+		{
+			MarkCellDirty(CellId);
+		}
+		for (int32 ChunkIdx : DirtyChunkIndices)
 		{
-			RemoveTrianglesForDetachedCells(Group);
+			MarkCollisionChunkDirty(ChunkIdx);
 		}
 	}
 
-	// 분리된 셀들을 파괴됨 상태로 이동
-	CellState.MoveAllDetachedToDestroyed();
+	if (MissingCells.Num() > 0)
+	{
+		RemoveTrianglesForDetachedCells(MissingCells);
+		CleanupSmallFragments(TSet<int32>(MissingCells));
+	}
 
-	// RemoveTriangles 후 작은 파편 정리는 IslandRemoval 완료 콜백에서 처리
-	// (비동기 완료 시 FIslandRemovalContext::DisconnectedCellsForCleanup 사용)
+	SuspectCellRegions = SuspectCellRegions.Difference(ResyncRegionSet);
 
-	UE_LOG(LogTemp, Warning, TEXT("[Client] Detach processing complete"));
+	UE_LOG(LogTemp, Log, TEXT("[CellChecksum] Resynced %d regions: +%d cells, -%d cells (local only)"),
+		RegionIds.Num(), MissingCells.Num(), ExtraCells.Num());
 }
 
 void URealtimeDestructibleMeshComponent::ApplyOpsDeterministic(const TArray<FRealtimeDestructionOp>& Ops)
@@ -3709,6 +5661,12 @@ void URealtimeDestructibleMeshComponent::ApplyOpsDeterministic(const TArray<FRea
 			TempDecal = SpawnTemporaryDecal(ModifiableRequest);
 		}
 
+		// 서버가 데칼만 남기기로 판정한 타격은 Boolean 연산 없음
+		if (ModifiableRequest.bDecalOnly)
+		{
+			continue;
+		}
+
 		// 비동기 경로로 처리 (워커 스레드 사용) - BatchId 전달
 		if (ModifiableRequest.ChunkIndex != INDEX_NONE && BooleanProcessor.IsValid())
 		{
@@ -3914,6 +5872,101 @@ TSharedPtr<FDynamicMesh3, ESPMode::ThreadSafe> URealtimeDestructibleMeshComponen
 	return Result;
 }
 
+TSharedPtr<FDynamicMesh3, ESPMode::ThreadSafe> URealtimeDestructibleMeshComponent::GetCachedToolMesh(
+	EDestructionToolShape ToolShape,
+	const FDestructionToolShapeParams& ShapeParams)
+{
+	FToolMeshCacheKey Key;
+	Key.ToolShape = ToolShape;
+	Key.ShapeParams = ShapeParams;
+
+	// 파라미터별로 한 번만 생성 (워커는 읽기 전용으로 복사해서 사용)
+	TSharedPtr<FDynamicMesh3, ESPMode::ThreadSafe>& ToolMesh = BulkToolMeshCache.FindOrAdd(Key);
+	if (!ToolMesh.IsValid())
+	{
+		ToolMesh = CreateToolMeshPtrFromShapeParams(ToolShape, ShapeParams);
+	}
+	return ToolMesh;
+}
+
+const FCellMaterialAttributes* URealtimeDestructibleMeshComponent::FindCellMaterialAttributesForCell(int32 CellId) const
+{
+	const int32 Slot = GridCellLayout.GetCellMaterialSlot(CellId);
+	if (Slot == INDEX_NONE || CellMaterialAttributes.IsEmpty() || !SourceStaticMesh)
+	{
+		return nullptr;
+	}
+
+	const TArray<FStaticMaterial>& StaticMaterials = SourceStaticMesh->GetStaticMaterials();
+	if (!StaticMaterials.IsValidIndex(Slot))
+	{
+		return nullptr;
+	}
+
+	const FName SlotName = StaticMaterials[Slot].MaterialSlotName;
+	return CellMaterialAttributes.FindByPredicate([&SlotName](const FCellMaterialAttributes& Attributes)
+	{
+		return Attributes.MaterialSlotName == SlotName;
+	});
+}
+
+const FCellMaterialAttributes* URealtimeDestructibleMeshComponent::FindCellMaterialAttributes(const FVector& WorldPoint, const FVector& WorldNormal) const
+{
+	if (CellMaterialAttributes.IsEmpty() || !GridCellLayout.IsValid())
+	{
+		return nullptr;
+	}
+
+	const FTransform& MeshTransform = GetComponentTransform();
+
+	// 충돌점은 표면(셀 경계)에 걸치므로 법선 반대 방향으로 반 셀 밀어 넣은 점의 셀을 사용
+	const FVector InsidePoint = WorldPoint - WorldNormal.GetSafeNormal() * (0.5f * GridCellSize.GetMin());
+	int32 CellId = GridCellLayout.WorldPosToId(InsidePoint, MeshTransform);
+	if (CellId == INDEX_NONE || !GridCellLayout.GetCellExists(CellId))
+	{
+		CellId = GridCellLayout.WorldPosToId(WorldPoint, MeshTransform);
+	}
+
+	return CellId != INDEX_NONE ? FindCellMaterialAttributesForCell(CellId) : nullptr;
+}
+
+FName URealtimeDestructibleMeshComponent::GetSurfaceTypeAt(const FVector& WorldPoint, const FVector& WorldNormal) const
+{
+	const FCellMaterialAttributes* Attributes = FindCellMaterialAttributes(WorldPoint, WorldNormal);
+	return (Attributes && !Attributes->SurfaceType.IsNone()) ? Attributes->SurfaceType : SurfaceType;
+}
+
+float URealtimeDestructibleMeshComponent::GetCellStrength(int32 CellId) const
+{
+	const FCellMaterialAttributes* Attributes = FindCellMaterialAttributesForCell(CellId);
+	return Attributes ? Attributes->Strength : 1.0f;
+}
+
+void URealtimeDestructibleMeshComponent::ApplyCellMaterialAttributes(FRealtimeDestructionRequest& InOutRequest)
+{
+	const FCellMaterialAttributes* Attributes = FindCellMaterialAttributes(InOutRequest.ImpactPoint, InOutRequest.ImpactNormal);
+	if (!Attributes)
+	{
+		return;
+	}
+
+	if (!Attributes->SurfaceType.IsNone())
+	{
+		InOutRequest.SurfaceType = Attributes->SurfaceType;
+	}
+
+	// 툴 크기 보정: ShapeParams에 반영되므로 클라이언트도 같은 크기로 툴 메시를 재생성
+	if (!FMath::IsNearlyEqual(Attributes->ToolSizeScale, 1.0f))
+	{
+		InOutRequest.ShapeParams.Radius *= Attributes->ToolSizeScale;
+		if (InOutRequest.ToolShape == EDestructionToolShape::Sphere)
+		{
+			InOutRequest.Depth = InOutRequest.ShapeParams.Radius;
+		}
+		InOutRequest.ToolMeshPtr = GetCachedToolMesh(InOutRequest.ToolShape, InOutRequest.ShapeParams);
+	}
+}
+
 void URealtimeDestructibleMeshComponent::CopyMaterialsFromStaticMesh(UStaticMesh* InMesh)
 {
 	if (!InMesh)
@@ -5090,6 +7143,12 @@ void URealtimeDestructibleMeshComponent::BeginPlay()
 
 	// 서버 Cell Box Collision 초기화 (데디케이티드 서버에서만)
 	BuildServerCellCollision();
+
+	// 지지 메시 접촉 계산 (지지 메시의 GridCellLayout이 BeginPlay에서 만들어질 수 있으므로 다음 틱)
+	if (SupportingActors.Num() > 0 && GetOwner() && GetOwner()->HasAuthority() && GetWorld())
+	{
+		GetWorld()->GetTimerManager().SetTimerForNextTick(this, &URealtimeDestructibleMeshComponent::RebuildSupportContacts);
+	}
 }
 
 void URealtimeDestructibleMeshComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -5170,6 +7229,25 @@ void URealtimeDestructibleMeshComponent::TickComponent(float DeltaTime, ELevelTi
 		ApplyLateJoinData();
 	}
 
+	// 셀 상태 체크섬 주기 전송 (서버)
+	if (bEnableCellStateChecksum && World && GridCellLayout.IsValid()
+		&& (World->GetNetMode() == NM_DedicatedServer || World->GetNetMode() == NM_ListenServer))
+	{
+		CellStateChecksumTimer += DeltaTime;
+		if (CellStateChecksumTimer >= CellStateChecksumInterval)
+		{
+			CellStateChecksumTimer = 0.0f;
+			BroadcastCellStateChecksum();
+		}
+	}
+
+	// 하중 기반 붕괴 (서버, 프레임당 예산 내에서 분할 계산)
+	if (bEnableLoadCollapse && bEnableStructuralIntegrity && GridCellLayout.IsValid()
+		&& GetOwner() && GetOwner()->HasAuthority())
+	{
+		TickLoadCollapse();
+	}
+
 	// 서버 배칭 처리
 	if (!bUseServerBatching)
 	{
@@ -5224,6 +7302,14 @@ void URealtimeDestructibleMeshComponent::BeginDestroy()
 
 void URealtimeDestructibleMeshComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	// 지지 메시가 통째로 사라지면 올려진 메시의 접촉 셀 전부 재검사
+	if (EndPlayReason == EEndPlayReason::Destroyed && SupportWatchedCells.Num() > 0)
+	{
+		NotifySupportedComponents(SupportWatchedCells.Array());
+	}
+	ClearSupportContacts();
+	SupportedComponents.Empty();
+
 	if (BooleanProcessor.IsValid())
 	{
 		BooleanProcessor->Shutdown();
@@ -5243,6 +7329,137 @@ void URealtimeDestructibleMeshComponent::GetLifetimeReplicatedProps(TArray<FLife
 	DOREPLIFETIME(URealtimeDestructibleMeshComponent, bServerIsDedicatedServer);
 }
 
+FRealtimeDestructionMemoryStats URealtimeDestructibleMeshComponent::GetMemoryStats() const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(RealtimeDestructibleMesh_GetMemoryStats);
+
+	FRealtimeDestructionMemoryStats Stats;
+
+	auto GetMeshBytes = [](const FDynamicMesh3* Mesh) -> int64
+	{
+		return Mesh ? static_cast<int64>(sizeof(FDynamicMesh3) + Mesh->GetByteCount()) : 0;
+	};
+
+	// 메시 데이터 (자기 자신 + 청크)
+	Stats.ChunkMeshBytes = GetMeshBytes(GetMesh());
+	for (const TObjectPtr<UDynamicMeshComponent>& ChunkMesh : ChunkMeshComponents)
+	{
+		if (ChunkMesh)
+		{
+			Stats.ChunkMeshBytes += GetMeshBytes(ChunkMesh->GetMesh());
+		}
+	}
+	Stats.ChunkMeshBytes += ChunkMeshComponents.GetAllocatedSize() + ChunkIndexMap.GetAllocatedSize()
+		+ GridToChunkMap.GetAllocatedSize() + ChunkBusyBits.GetAllocatedSize() + ChunkSubtractBusyBits.GetAllocatedSize();
+
+	if (BooleanProcessor.IsValid())
+	{
+		// 캐시된 툴 메시는 아래 OpHistoryBytes에서 계산하므로 제외
+		TSet<const FDynamicMesh3*> CachedToolMeshes;
+		CachedToolMeshes.Reserve(BulkToolMeshCache.Num());
+		for (const TPair<FToolMeshCacheKey, TSharedPtr<FDynamicMesh3, ESPMode::ThreadSafe>>& Pair : BulkToolMeshCache)
+		{
+			CachedToolMeshes.Add(Pair.Value.Get());
+		}
+		Stats.BooleanProcessorBytes = sizeof(FRealtimeBooleanProcessor) + BooleanProcessor->GetAllocatedSize(CachedToolMeshes);
+	}
+
+	Stats.GridLayoutBytes = GridCellLayout.GetAllocatedSize();
+
+	// 셀 상태
+	Stats.CellStateBytes = CellState.GetAllocatedSize() + SupercellState.GetAllocatedSize()
+		+ SupercellRemovalTemplates.GetAllocatedSize() + RecentDirectDestroyedCellIds.GetAllocatedSize();
+	for (const TPair<uint64, FSupercellRemovalTemplate>& Pair : SupercellRemovalTemplates)
+	{
+		const FSupercellRemovalTemplate& Template = Pair.Value;
+		Stats.CellStateBytes += Template.ToolMeshes.GetAllocatedSize() + Template.DebrisToolMeshes.GetAllocatedSize()
+			+ Template.PieceCellCoords.GetAllocatedSize();
+		for (const TArray<FIntVector>& LocalCoords : Template.PieceCellCoords)
+		{
+			Stats.CellStateBytes += LocalCoords.GetAllocatedSize();
+		}
+		for (const TSharedPtr<FDynamicMesh3>& Mesh : Template.ToolMeshes)
+		{
+			Stats.CellStateBytes += GetMeshBytes(Mesh.Get());
+		}
+		for (const TSharedPtr<FDynamicMesh3>& Mesh : Template.DebrisToolMeshes)
+		{
+			Stats.CellStateBytes += GetMeshBytes(Mesh.Get());
+		}
+	}
+
+	// 연결성 / 하중 / 지지 접촉
+	Stats.StructuralBytes = CellContext.GetAllocatedSize() + LoadSolver.GetAllocatedSize()
+		+ SupportLinks.GetAllocatedSize() + SupportAnchorRefs.GetAllocatedSize()
+		+ SupportedComponents.GetAllocatedSize() + SupportWatchedCells.GetAllocatedSize();
+	for (const FStructuralSupportLink& Link : SupportLinks)
+	{
+		Stats.StructuralBytes += Link.SupporterToContactCells.GetAllocatedSize() + Link.ContactSupportCount.GetAllocatedSize();
+		for (const TPair<int32, TArray<int32>>& Pair : Link.SupporterToContactCells)
+		{
+			Stats.StructuralBytes += Pair.Value.GetAllocatedSize();
+		}
+	}
+
+	// 서버 셀 콜리전
+	Stats.CollisionBytes = CollisionChunks.GetAllocatedSize() + CellToCollisionChunkMap.GetAllocatedSize();
+	for (const FCollisionChunkData& Chunk : CollisionChunks)
+	{
+		Stats.CollisionBytes += Chunk.CellIds.GetAllocatedSize() + Chunk.SurfaceCellIds.GetAllocatedSize();
+	}
+
+	// 연산 기록 / 배칭 (BulkToolMeshCache의 툴 메시는 여기서만 계산)
+	Stats.OpHistoryBytes = AppliedOpHistory.GetAllocatedSize() + LateJoinDestroyedCells.GetAllocatedSize()
+		+ DestructionInputHistory.GetAllocatedSize() + PendingServerBatchOps.GetAllocatedSize()
+		+ PendingServerBatchOpsCompact.GetAllocatedSize() + PendingReplicatedDetachGroups.GetAllocatedSize()
+		+ PendingDestructionResults.GetAllocatedSize() + ActiveBatchTrackers.GetAllocatedSize()
+		+ ModifiedChunkIds.GetAllocatedSize() + SuspectCellRegions.GetAllocatedSize()
+		+ LastOccupiedCells.GetAllocatedSize() + PlayerRateLimits.GetAllocatedSize() + PlayerCellResyncTimes.GetAllocatedSize()
+		+ BulkToolMeshCache.GetAllocatedSize();
+	for (const FReplicatedDetachedGroup& Group : PendingReplicatedDetachGroups)
+	{
+		Stats.OpHistoryBytes += Group.Payload.GetAllocatedSize();
+	}
+	for (const FDestructionResult& Result : PendingDestructionResults)
+	{
+		Stats.OpHistoryBytes += Result.AffectedCells.GetAllocatedSize() + Result.NewlyDestroyedCells.GetAllocatedSize()
+			+ Result.NewlyDeadSubCells.GetAllocatedSize();
+		for (const TPair<int32, FIntArray>& Pair : Result.NewlyDeadSubCells)
+		{
+			Stats.OpHistoryBytes += Pair.Value.Values.GetAllocatedSize();
+		}
+	}
+	for (const TPair<FToolMeshCacheKey, TSharedPtr<FDynamicMesh3, ESPMode::ThreadSafe>>& Pair : BulkToolMeshCache)
+	{
+		Stats.OpHistoryBytes += GetMeshBytes(Pair.Value.Get());
+	}
+
+	// 데칼
+	Stats.DecalBytes = ActiveDecals.GetAllocatedSize() + CellToDecalMap.GetAllocatedSize();
+	for (const TPair<int32, TArray<int32>>& Pair : CellToDecalMap)
+	{
+		Stats.DecalBytes += Pair.Value.GetAllocatedSize();
+	}
+
+	// 파편 (액터 자체는 월드가 소유)
+	Stats.DebrisBytes = ActiveDebrisActors.GetAllocatedSize() + LocalDebrisMeshMap.GetAllocatedSize()
+		+ PendingDebrisActors.GetAllocatedSize();
+
+	Stats.TotalBytes = Stats.ChunkMeshBytes + Stats.BooleanProcessorBytes + Stats.GridLayoutBytes + Stats.CellStateBytes
+		+ Stats.StructuralBytes + Stats.CollisionBytes + Stats.OpHistoryBytes + Stats.DecalBytes + Stats.DebrisBytes;
+
+	return Stats;
+}
+
+void URealtimeDestructibleMeshComponent::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	// 메시 데이터는 UDynamicMesh / 청크 컴포넌트가 각자 보고하므로 제외
+	const FRealtimeDestructionMemoryStats Stats = GetMemoryStats();
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(Stats.TotalBytes - Stats.ChunkMeshBytes);
+}
+
 void URealtimeDestructibleMeshComponent::OnRep_LateJoinOpHistory()
 {
 	bLateJoinOpsReceived = true;
@@ -5264,7 +7481,7 @@ void URealtimeDestructibleMeshComponent::ApplyLateJoinData()
 	// === Phase 1: CellState 즉시 적용 (충돌 정확성) ===
 	for (int32 CellId : LateJoinDestroyedCells)
 	{
-		CellState.DestroyedCells.Add(CellId);
+		CellState.DestroyCell(CellId);
 
 		// SuperCell 상태 업데이트
 		if (bEnableSupercell && SupercellState.IsValid())
@@ -5375,6 +7592,8 @@ void URealtimeDestructibleMeshComponent::FlushServerBatch()
 			if (UDestructionDebugger* Debugger = World->GetSubsystem<UDestructionDebugger>())
 			{
 				Debugger->RecordMulticastRPCWithSize(PendingServerBatchOpsCompact.Num(), true);
+				Debugger->RecordEvent(EDestructionEventSource::Multicast, this, 0, 0.0f,
+					UDestructionDebugger::EstimateRPCBytes(PendingServerBatchOpsCompact.Num(), true));
 			}
 		}
 
@@ -5390,11 +7609,11 @@ void URealtimeDestructibleMeshComponent::FlushServerBatch()
 			}
 		}
 
-		// 데디서버: Multicast는 자기 자신에게 실행 안 됨, BFS로 분리된 셀 찾기
+		// 서버(데디/리슨): BFS로 분리된 셀을 찾고 그 결과를 클라이언트에 그대로 복제
 		// DestructionLogic은 RequestDestruction에서 이미 호출되어 셀이 파괴됨
-		// 여기서는 BFS만 실행하여 분리된 셀을 찾아 Cell Box 업데이트
+		// 데디서버는 Cell Box 업데이트, 리슨 서버는 로컬 메시까지 처리
 		UWorld* World = GetWorld();
-		if (World && World->GetNetMode() == NM_DedicatedServer)
+		if (World && World->GetNetMode() != NM_Standalone && GetOwner() && GetOwner()->HasAuthority())
 		{
 			UE_LOG(LogTemp, Warning, TEXT("########## [BATCH START] Ops=%d ##########"), PendingServerBatchOpsCompact.Num());
 
@@ -5407,8 +7626,9 @@ void URealtimeDestructibleMeshComponent::FlushServerBatch()
 		// 압축된 데이터로 전파
 		MulticastApplyOpsCompact(PendingServerBatchOpsCompact);
 
-		// 클라이언트에게 분리 셀 처리 신호 전송
-		MulticastDetachSignal();
+		// 클라이언트에게 서버가 계산한 분리 그룹 전송
+		MulticastDetachSignal(PendingReplicatedDetachGroups);
+		PendingReplicatedDetachGroups.Reset();
 
 		// 대기열 비우기
 		PendingServerBatchOpsCompact.Empty();
@@ -5429,6 +7649,8 @@ void URealtimeDestructibleMeshComponent::FlushServerBatch()
 			if (UDestructionDebugger* Debugger = World->GetSubsystem<UDestructionDebugger>())
 			{
 				Debugger->RecordMulticastRPCWithSize(PendingServerBatchOps.Num(), false);
+				Debugger->RecordEvent(EDestructionEventSource::Multicast, this, 0, 0.0f,
+					UDestructionDebugger::EstimateRPCBytes(PendingServerBatchOps.Num(), false));
 			}
 		}
 
@@ -5444,9 +7666,9 @@ void URealtimeDestructibleMeshComponent::FlushServerBatch()
 			}
 		}
 
-		// 데디서버: Multicast는 자기 자신에게 실행 안 됨, BFS로 분리된 셀 찾기
+		// 서버(데디/리슨): BFS로 분리된 셀 찾기 (결과는 클라이언트에 복제)
 		UWorld* WorldNonCompact = GetWorld();
-		if (WorldNonCompact && WorldNonCompact->GetNetMode() == NM_DedicatedServer)
+		if (WorldNonCompact && WorldNonCompact->GetNetMode() != NM_Standalone && GetOwner() && GetOwner()->HasAuthority())
 		{
 			UE_LOG(LogTemp, Warning, TEXT("########## [BATCH START] Ops=%d (non-compact) ##########"), PendingServerBatchOps.Num());
 
@@ -5459,6 +7681,10 @@ void URealtimeDestructibleMeshComponent::FlushServerBatch()
 		// 비압축 데이터로 전파
 		MulticastApplyOps(PendingServerBatchOps);
 
+		// 클라이언트에게 서버가 계산한 분리 그룹 전송
+		MulticastDetachSignal(PendingReplicatedDetachGroups);
+		PendingReplicatedDetachGroups.Reset();
+
 		// 대기열 비우기
 		PendingServerBatchOps.Empty();
 	}
@@ -6187,6 +8413,8 @@ bool URealtimeDestructibleMeshComponent::BuildGridCells()
 	
 	// 5. SuperCell 상태 빌드 (BFS 최적화용)
 	SupercellState.BuildFromGridLayout(GridCellLayout);
+	SupercellRemovalTemplates.Reset();
+	LoadSolver.Reset();
 
 #if WITH_EDITOR
 	if (GetWorld() && !GetWorld()->IsGameWorld())
@@ -6560,16 +8788,22 @@ AActor* URealtimeDestructibleMeshComponent::CreateLocalOnlyDebrisActor(UWorld* W
 	// Lifespan
 	LocalActor->SetLifeSpan(10.0f);
 
+	// 로컬 전용 Debris도 전역 예산에 포함 (이 머신에서만 존재하므로 로컬에서 제거)
+	if (UDebrisManagerSubsystem* DebrisManager = World->GetSubsystem<UDebrisManagerSubsystem>())
+	{
+		DebrisManager->RegisterDebris(LocalActor, CollisionBox, Mesh);
+	}
+
 	return LocalActor;
 }
   
-void URealtimeDestructibleMeshComponent::ApplyDebrisPhysics(UBoxComponent* CollisionBox, const FVector& SpawnLocation, const FVector& BoxExtent)
+void URealtimeDestructibleMeshComponent::ApplyDebrisPhysics(UBoxComponent* CollisionBox, const FVector& SpawnLocation, const FVector& BoxExtent, float SolidVolume)
 {
 	if (!CollisionBox)
 	{
 		return;
 	}
-	float Volume = 8.0f * BoxExtent.X * BoxExtent.Y * BoxExtent.Z;
+	float Volume = SolidVolume > 0.0f ? SolidVolume : 8.0f * BoxExtent.X * BoxExtent.Y * BoxExtent.Z;
 	float CalcMassKg = 0.001f * Volume * DebrisDensity;
 	float FinalMassKg = FMath::Clamp(CalcMassKg, 0.001, MaxDebrisMass); 
 	float MassRatio = 1.0f - (FinalMassKg / MaxDebrisMass);
@@ -26,10 +26,15 @@
 // - destruction.filter [actor] [radius] : 필터 설정
 // - destruction.export [history|stats] [path] : CSV 내보내기
 // - destruction.summary             : 세션 요약 출력
+// - destruction.debris [clear]      : Debris 예산/Rubble 현황 (clear: Rubble 삭제)
+// - destruction.memory [count]      : 컴포넌트별 메모리 사용량 + 합계 (큰 순서로 count개)
 
 #include "Debug/DestructionDebugger.h"
 #include "Debug/DestructionProfiler.h"
 #include "Testing/NetworkTestSubsystem.h"
+#include "Subsystems/DebrisManagerSubsystem.h"
+#include "Components/RealtimeDestructibleMeshComponent.h"
+#include "UObject/UObjectIterator.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 #include "HAL/IConsoleManager.h"
@@ -512,6 +517,187 @@ static FAutoConsoleCommandWithWorldAndArgs GDestructionExportCmd(
 	})
 );
 
+//-------------------------------------------------------------------
+// destruction.events - 이벤트 타임라인 (링 버퍼) 제어
+// 사용법: destruction.events [freeze|unfreeze|clear|threshold <ms> [post]|capacity <n>|export <csv|json> [path]]
+//-------------------------------------------------------------------
+static FAutoConsoleCommandWithWorldAndArgs GDestructionEventsCmd(
+	TEXT("destruction.events"),
+	TEXT("Event timeline. Usage: destruction.events [freeze|unfreeze|clear|threshold <ms> [post_events]|capacity <n>|export <csv|json> [path]]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World)
+		{
+			return;
+		}
+
+		UDestructionDebugger* Debugger = World->GetSubsystem<UDestructionDebugger>();
+		if (!Debugger)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("destruction.events: Debugger not found"));
+			return;
+		}
+
+		// 인자 없으면 현재 상태 출력
+		if (Args.Num() == 0)
+		{
+			UE_LOG(LogTemp, Log, TEXT("destruction.events: %d / %d events, %s, freeze threshold %.2f ms"),
+				Debugger->GetEventCount(), Debugger->GetEventCapacity(),
+				Debugger->AreEventsFrozen() ? TEXT("FROZEN") : TEXT("recording"),
+				Debugger->GetEventFreezeThreshold());
+			return;
+		}
+
+		const FString& Action = Args[0];
+
+		if (Action.Equals(TEXT("freeze"), ESearchCase::IgnoreCase))
+		{
+			Debugger->FreezeEvents();
+		}
+		else if (Action.Equals(TEXT("unfreeze"), ESearchCase::IgnoreCase))
+		{
+			Debugger->UnfreezeEvents();
+		}
+		else if (Action.Equals(TEXT("clear"), ESearchCase::IgnoreCase))
+		{
+			Debugger->ClearEvents();
+		}
+		else if (Action.Equals(TEXT("threshold"), ESearchCase::IgnoreCase) && Args.Num() > 1)
+		{
+			const float ThresholdMs = FCString::Atof(*Args[1]);
+			const int32 PostEvents = Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 32;
+			Debugger->SetEventFreezeThreshold(ThresholdMs, PostEvents);
+			UE_LOG(LogTemp, Log, TEXT("destruction.events: Freeze at Boolean >= %.2f ms (+%d events)"), ThresholdMs, PostEvents);
+		}
+		else if (Action.Equals(TEXT("capacity"), ESearchCase::IgnoreCase) && Args.Num() > 1)
+		{
+			Debugger->SetEventCapacity(FCString::Atoi(*Args[1]));
+		}
+		else if (Action.Equals(TEXT("export"), ESearchCase::IgnoreCase))
+		{
+			const bool bJSON = Args.Num() > 1 && Args[1].Equals(TEXT("json"), ESearchCase::IgnoreCase);
+			const FString Timestamp = FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"));
+			const FString Directory = Args.Num() > 2 ? Args[2] : FPaths::ProjectSavedDir() / TEXT("Logs");
+			const FString FullPath = Directory / FString::Printf(TEXT("DestructionEvents_%s.%s"), *Timestamp, bJSON ? TEXT("json") : TEXT("csv"));
+
+			const bool bSuccess = bJSON ? Debugger->ExportEventsToJSON(FullPath) : Debugger->ExportEventsToCSV(FullPath);
+			if (!bSuccess)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("destruction.events: Export failed"));
+			}
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("destruction.events: Unknown action '%s'"), *Action);
+		}
+	})
+);
+
+//-------------------------------------------------------------------
+// destruction.debris - Debris 예산 사용량 및 Rubble 현황
+// 사용법: destruction.debris [clear]
+//-------------------------------------------------------------------
+static FAutoConsoleCommandWithWorldAndArgs GDestructionDebrisCmd(
+	TEXT("destruction.debris"),
+	TEXT("Print debris budget usage and rubble stats. Usage: destruction.debris [clear]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World)
+		{
+			return;
+		}
+
+		UDebrisManagerSubsystem* DebrisManager = World->GetSubsystem<UDebrisManagerSubsystem>();
+		if (!DebrisManager)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("destruction.debris: Debris manager not found"));
+			return;
+		}
+
+		if (Args.Num() > 0 && Args[0].Equals(TEXT("clear"), ESearchCase::IgnoreCase))
+		{
+			DebrisManager->ClearRubble();
+			UE_LOG(LogTemp, Log, TEXT("destruction.debris: Rubble cleared"));
+			return;
+		}
+
+		int32 Count = 0;
+		int32 Triangles = 0;
+		int32 Bodies = 0;
+		DebrisManager->GetDebrisBudgetUsage(Count, Triangles, Bodies);
+
+		UE_LOG(LogTemp, Log, TEXT("destruction.debris: Debris=%d, Triangles=%d, Bodies=%d | Rubble Areas=%d, Triangles=%d"),
+			Count, Triangles, Bodies, DebrisManager->GetRubbleAreaCount(), DebrisManager->GetRubbleTriangleCount());
+	})
+);
+
+//-------------------------------------------------------------------
+// destruction.memory - 컴포넌트별 메모리 사용량
+// 사용법: destruction.memory [count]
+//-------------------------------------------------------------------
+static FAutoConsoleCommandWithWorldAndArgs GDestructionMemoryCmd(
+	TEXT("destruction.memory"),
+	TEXT("Print heap memory per destructible component and the world total. Usage: destruction.memory [count]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World)
+		{
+			return;
+		}
+
+		TArray<TPair<const URealtimeDestructibleMeshComponent*, FRealtimeDestructionMemoryStats>> Entries;
+		for (TObjectIterator<URealtimeDestructibleMeshComponent> It; It; ++It)
+		{
+			const URealtimeDestructibleMeshComponent* Component = *It;
+			if (IsValid(Component) && Component->GetWorld() == World)
+			{
+				Entries.Emplace(Component, Component->GetMemoryStats());
+			}
+		}
+
+		Entries.Sort([](const auto& A, const auto& B) { return A.Value.TotalBytes > B.Value.TotalBytes; });
+
+		const int32 MaxRows = Args.Num() > 0 ? FMath::Max(0, FCString::Atoi(*Args[0])) : Entries.Num();
+		auto ToKB = [](int64 Bytes) { return static_cast<double>(Bytes) / 1024.0; };
+
+		FRealtimeDestructionMemoryStats Sum;
+		UE_LOG(LogTemp, Log, TEXT("destruction.memory: %d components (KB)"), Entries.Num());
+		UE_LOG(LogTemp, Log, TEXT("  %10s %10s %10s %10s %10s %10s %10s %10s %10s %10s  %s"),
+			TEXT("Total"), TEXT("Mesh"), TEXT("Boolean"), TEXT("Grid"), TEXT("CellState"), TEXT("Struct"),
+			TEXT("Collision"), TEXT("OpHistory"), TEXT("Decal"), TEXT("Debris"), TEXT("Component"));
+
+		for (int32 Index = 0; Index < Entries.Num(); ++Index)
+		{
+			const FRealtimeDestructionMemoryStats& Stats = Entries[Index].Value;
+			Sum.ChunkMeshBytes += Stats.ChunkMeshBytes;
+			Sum.BooleanProcessorBytes += Stats.BooleanProcessorBytes;
+			Sum.GridLayoutBytes += Stats.GridLayoutBytes;
+			Sum.CellStateBytes += Stats.CellStateBytes;
+			Sum.StructuralBytes += Stats.StructuralBytes;
+			Sum.CollisionBytes += Stats.CollisionBytes;
+			Sum.OpHistoryBytes += Stats.OpHistoryBytes;
+			Sum.DecalBytes += Stats.DecalBytes;
+			Sum.DebrisBytes += Stats.DebrisBytes;
+			Sum.TotalBytes += Stats.TotalBytes;
+
+			if (Index < MaxRows)
+			{
+				const URealtimeDestructibleMeshComponent* Component = Entries[Index].Key;
+				UE_LOG(LogTemp, Log, TEXT("  %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f  %s.%s"),
+					ToKB(Stats.TotalBytes), ToKB(Stats.ChunkMeshBytes), ToKB(Stats.BooleanProcessorBytes),
+					ToKB(Stats.GridLayoutBytes), ToKB(Stats.CellStateBytes), ToKB(Stats.StructuralBytes),
+					ToKB(Stats.CollisionBytes), ToKB(Stats.OpHistoryBytes), ToKB(Stats.DecalBytes), ToKB(Stats.DebrisBytes),
+					*GetNameSafe(Component->GetOwner()), *Component->GetName());
+			}
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("  %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f  TOTAL"),
+			ToKB(Sum.TotalBytes), ToKB(Sum.ChunkMeshBytes), ToKB(Sum.BooleanProcessorBytes),
+			ToKB(Sum.GridLayoutBytes), ToKB(Sum.CellStateBytes), ToKB(Sum.StructuralBytes),
+			ToKB(Sum.CollisionBytes), ToKB(Sum.OpHistoryBytes), ToKB(Sum.DecalBytes), ToKB(Sum.DebrisBytes));
+	})
+);
+
 //-------------------------------------------------------------------
 // destruction.summary - 세션 요약 출력
 //-------------------------------------------------------------------
@@ -576,9 +762,26 @@ static FAutoConsoleCommand GDestructionHelpCmd(
 		UE_LOG(LogTemp, Log, TEXT("  destruction.export history [path] - Export history to CSV"));
 		UE_LOG(LogTemp, Log, TEXT("  destruction.export stats [path]   - Export stats to CSV"));
 		UE_LOG(LogTemp, Log, TEXT(""));
+		UE_LOG(LogTemp, Log, TEXT("=== Event Timeline ==="));
+		UE_LOG(LogTemp, Log, TEXT("  destruction.events                - Print timeline status"));
+		UE_LOG(LogTemp, Log, TEXT("  destruction.events freeze|unfreeze|clear"));
+		UE_LOG(LogTemp, Log, TEXT("  destruction.events threshold <ms> [post] - Freeze when Boolean time >= ms"));
+		UE_LOG(LogTemp, Log, TEXT("  destruction.events capacity <n>   - Resize ring buffer (clears it)"));
+		UE_LOG(LogTemp, Log, TEXT("  destruction.events export csv|json [path] - Export timeline"));
+		UE_LOG(LogTemp, Log, TEXT(""));
+		UE_LOG(LogTemp, Log, TEXT("=== Debris ==="));
+		UE_LOG(LogTemp, Log, TEXT("  destruction.debris                - Print debris budget and rubble stats"));
+		UE_LOG(LogTemp, Log, TEXT("  destruction.debris clear          - Remove all rubble"));
+		UE_LOG(LogTemp, Log, TEXT(""));
+		UE_LOG(LogTemp, Log, TEXT("=== Memory ==="));
+		UE_LOG(LogTemp, Log, TEXT("  destruction.memory [count]        - Print memory per component (largest first) and total"));
+		UE_LOG(LogTemp, Log, TEXT(""));
 		UE_LOG(LogTemp, Log, TEXT("=== Network Test ==="));
 		UE_LOG(LogTemp, Log, TEXT("  Destruction.NetPreset [preset]    - Set network preset (off/good/normal/bad/worst)"));
 		UE_LOG(LogTemp, Log, TEXT("  Destruction.NetStatus             - Print current network test status"));
+		UE_LOG(LogTemp, Log, TEXT("  Destruction.Soak [n] [sec] [preset|all] [pattern] - Run multi-client soak test (server)"));
+		UE_LOG(LogTemp, Log, TEXT("  Destruction.SoakStop              - Stop soak test and print report"));
+		UE_LOG(LogTemp, Log, TEXT("  Destruction.SoakHash              - Print cell state hash per component"));
 		UE_LOG(LogTemp, Log, TEXT(""));
 		UE_LOG(LogTemp, Log, TEXT("=== Profiling ==="));
 		UE_LOG(LogTemp, Log, TEXT("  Destruction.ProfileStats          - Print profiler statistics"));
@@ -654,6 +857,112 @@ static FAutoConsoleCommandWithWorld GDestructionNetStatusCmd(
 	})
 );
 
+//-------------------------------------------------------------------
+// Destruction.Soak - 멀티 클라이언트 소크 테스트 (서버에서 실행)
+//-------------------------------------------------------------------
+static FAutoConsoleCommandWithWorldAndArgs GDestructionSoakCmd(
+	TEXT("Destruction.Soak"),
+	TEXT("Run destruction soak test on the server. Usage: Destruction.Soak [clients=4] [seconds=30] [off|good|normal|bad|worst|all] [sweep|random|cluster]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		// PIE에서 클라이언트 뷰포트로 입력해도 서버 월드에서 실행
+		if ((!World || World->GetNetMode() == NM_Client) && GEngine)
+		{
+			for (const FWorldContext& Context : GEngine->GetWorldContexts())
+			{
+				UWorld* ContextWorld = Context.World();
+				if (ContextWorld && ContextWorld->IsGameWorld() && ContextWorld->GetNetMode() != NM_Client)
+				{
+					World = ContextWorld;
+					break;
+				}
+			}
+		}
+
+		UNetworkTestSubsystem* NetTest = World ? World->GetSubsystem<UNetworkTestSubsystem>() : nullptr;
+		if (!NetTest)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Destruction.Soak: No server world with NetworkTestSubsystem"));
+			return;
+		}
+
+		FNetworkSoakConfig Config;
+		if (Args.Num() > 0)
+		{
+			Config.NumClients = FCString::Atoi(*Args[0]);
+		}
+		if (Args.Num() > 1)
+		{
+			Config.SecondsPerPreset = FCString::Atof(*Args[1]);
+		}
+		if (Args.Num() > 2 && !Args[2].Equals(TEXT("all"), ESearchCase::IgnoreCase))
+		{
+			const int64 PresetValue = StaticEnum<ENetworkTestPreset>()->GetValueByNameString(Args[2]);
+			if (PresetValue == INDEX_NONE)
+			{
+				NetTest->PrintAvailablePresets();
+				return;
+			}
+			Config.Presets.Add(static_cast<ENetworkTestPreset>(PresetValue));
+		}
+		if (Args.Num() > 3)
+		{
+			const int64 PatternValue = StaticEnum<ENetworkSoakPattern>()->GetValueByNameString(Args[3]);
+			if (PatternValue != INDEX_NONE)
+			{
+				Config.Pattern = static_cast<ENetworkSoakPattern>(PatternValue);
+			}
+		}
+
+		NetTest->StartSoakTest(Config);
+	})
+);
+
+//-------------------------------------------------------------------
+// Destruction.SoakStop - 소크 테스트 중단
+//-------------------------------------------------------------------
+static FAutoConsoleCommandWithWorld GDestructionSoakStopCmd(
+	TEXT("Destruction.SoakStop"),
+	TEXT("Stop the running soak test and print its report"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* /*World*/)
+	{
+		if (!GEngine)
+		{
+			return;
+		}
+
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			UWorld* ContextWorld = Context.World();
+			UNetworkTestSubsystem* NetTest = ContextWorld ? ContextWorld->GetSubsystem<UNetworkTestSubsystem>() : nullptr;
+			if (NetTest && NetTest->IsSoakTestRunning())
+			{
+				NetTest->StopSoakTest();
+			}
+		}
+	})
+);
+
+//-------------------------------------------------------------------
+// Destruction.SoakHash - 셀 상태 해시 출력 (프로세스 간 비교용)
+//-------------------------------------------------------------------
+static FAutoConsoleCommandWithWorld GDestructionSoakHashCmd(
+	TEXT("Destruction.SoakHash"),
+	TEXT("Print destroyed-cell hash of every destructible component (compare across server/client logs)"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		UNetworkTestSubsystem* NetTest = World ? World->GetSubsystem<UNetworkTestSubsystem>() : nullptr;
+		if (NetTest)
+		{
+			NetTest->PrintCellStateHashes();
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Destruction.SoakHash: NetworkTestSubsystem not found"));
+		}
+	})
+);
+
 //=============================================================================
 // 프로파일링 명령어
 //=============================================================================
@@ -35,6 +35,9 @@ void UDestructionDebugger::Initialize(FSubsystemCollectionBase& Collection)
 		SessionStartTime = World->GetTimeSeconds();
 	}
 
+	// 이벤트 타임라인 버퍼는 한 번만 할당 (기록 시 할당 없음)
+	EventRing.SetNum(EventCapacity);
+
 	// Tick 등록
 	TickHandle = FTSTicker::GetCoreTicker().AddTicker(
 		FTickerDelegate::CreateUObject(this, &UDestructionDebugger::OnTick),
@@ -274,15 +277,20 @@ void UDestructionDebugger::RecordBytesReceived(int32 Bytes)
 	NetworkStats.TotalBytesReceived += Bytes;
 }
 
+int32 UDestructionDebugger::EstimateRPCBytes(int32 OpCount, bool bIsCompact)
+{
+	return bIsCompact
+		? (OpCount * COMPACT_OP_SIZE + RPC_OVERHEAD)
+		: (OpCount * UNCOMPRESSED_OP_SIZE + RPC_OVERHEAD);
+}
+
 void UDestructionDebugger::RecordMulticastRPCWithSize(int32 OpCount, bool bIsCompact)
 {
 	if (!bIsEnabled) return;
 
 	NetworkStats.MulticastRPCCount++;
 
-	int32 DataSize = bIsCompact
-		? (OpCount * COMPACT_OP_SIZE + RPC_OVERHEAD)
-		: (OpCount * UNCOMPRESSED_OP_SIZE + RPC_OVERHEAD);
+	int32 DataSize = EstimateRPCBytes(OpCount, bIsCompact);
 
 	RecordBytesSent(DataSize, bIsCompact);
 
@@ -300,9 +308,7 @@ void UDestructionDebugger::RecordServerRPCWithSize(bool bIsCompact)
 
 	NetworkStats.ServerRPCCount++;
 
-	int32 DataSize = bIsCompact
-		? (COMPACT_OP_SIZE + RPC_OVERHEAD)
-		: (UNCOMPRESSED_OP_SIZE + RPC_OVERHEAD);
+	int32 DataSize = EstimateRPCBytes(1, bIsCompact);
 
 	RecordBytesSent(DataSize, bIsCompact);
 
@@ -612,6 +618,197 @@ bool UDestructionDebugger::ExportStatsToCSV(const FString& FilePath)
 	return false;
 }
 
+//-------------------------------------------------------------------
+// 이벤트 타임라인
+//-------------------------------------------------------------------
+
+void UDestructionDebugger::RecordEvent(
+	EDestructionEventSource Source,
+	const UActorComponent* Component,
+	int32 CellCount,
+	float BooleanTimeMs,
+	int32 BytesSent)
+{
+	if (!bIsEnabled || bEventsFrozen || EventRing.Num() == 0)
+	{
+		return;
+	}
+
+	// 가장 오래된 레코드 자리에 덮어쓰기 (할당 없음)
+	FDestructionEventRecord& Record = EventRing[EventHead];
+	const UWorld* World = GetWorld();
+	Record.Time = World ? World->GetTimeSeconds() : 0.0;
+	Record.Frame = GFrameCounter;
+	Record.ActorName = (Component && Component->GetOwner()) ? Component->GetOwner()->GetFName() : NAME_None;
+	Record.ComponentName = Component ? Component->GetFName() : NAME_None;
+	Record.CellCount = CellCount;
+	Record.BooleanTimeMs = BooleanTimeMs;
+	Record.BytesSent = BytesSent;
+	Record.Source = Source;
+
+	if (++EventHead == EventRing.Num())
+	{
+		EventHead = 0;
+	}
+	EventCount = FMath::Min(EventCount + 1, EventRing.Num());
+
+	// 트리거 이후 지정한 수만큼 더 기록하고 고정
+	if (EventPostTriggerRemaining != INDEX_NONE)
+	{
+		if (--EventPostTriggerRemaining <= 0)
+		{
+			FreezeEvents();
+		}
+	}
+	else if (EventFreezeThresholdMs > 0.0f && BooleanTimeMs >= EventFreezeThresholdMs)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("DestructionDebugger: Event timeline triggered (%s, Boolean %.2f ms >= %.2f ms)"),
+			*Record.ActorName.ToString(), BooleanTimeMs, EventFreezeThresholdMs);
+
+		EventPostTriggerRemaining = EventPostTriggerCount;
+		if (EventPostTriggerRemaining <= 0)
+		{
+			FreezeEvents();
+		}
+	}
+}
+
+const TCHAR* UDestructionDebugger::GetEventSourceName(EDestructionEventSource Source)
+{
+	switch (Source)
+	{
+	case EDestructionEventSource::Request:		return TEXT("Request");
+	case EDestructionEventSource::Boolean:		return TEXT("Boolean");
+	case EDestructionEventSource::Detach:		return TEXT("Detach");
+	case EDestructionEventSource::ServerRPC:	return TEXT("ServerRPC");
+	case EDestructionEventSource::Multicast:	return TEXT("Multicast");
+	default:									return TEXT("Unknown");
+	}
+}
+
+void UDestructionDebugger::SetEventCapacity(int32 NewCapacity)
+{
+	EventCapacity = FMath::Max(1, NewCapacity);
+	EventRing.Empty(EventCapacity);
+	EventRing.SetNum(EventCapacity);
+	EventHead = 0;
+	EventCount = 0;
+	UE_LOG(LogTemp, Log, TEXT("DestructionDebugger: Event timeline capacity %d"), EventCapacity);
+}
+
+void UDestructionDebugger::SetEventFreezeThreshold(float ThresholdMs, int32 PostTriggerEvents)
+{
+	EventFreezeThresholdMs = FMath::Max(0.0f, ThresholdMs);
+	EventPostTriggerCount = FMath::Max(0, PostTriggerEvents);
+	EventPostTriggerRemaining = INDEX_NONE;
+}
+
+void UDestructionDebugger::FreezeEvents()
+{
+	bEventsFrozen = true;
+	EventPostTriggerRemaining = INDEX_NONE;
+	UE_LOG(LogTemp, Log, TEXT("DestructionDebugger: Event timeline frozen (%d events)"), EventCount);
+}
+
+void UDestructionDebugger::UnfreezeEvents()
+{
+	bEventsFrozen = false;
+	EventPostTriggerRemaining = INDEX_NONE;
+	UE_LOG(LogTemp, Log, TEXT("DestructionDebugger: Event timeline resumed"));
+}
+
+void UDestructionDebugger::GetEvents(TArray<FDestructionEventRecord>& OutEvents) const
+{
+	OutEvents.Reset(EventCount);
+
+	// Head가 가장 오래된 레코드 (버퍼가 찬 경우)
+	const int32 Start = (EventCount == EventRing.Num()) ? EventHead : 0;
+	for (int32 i = 0; i < EventCount; ++i)
+	{
+		OutEvents.Add(EventRing[(Start + i) % EventRing.Num()]);
+	}
+}
+
+void UDestructionDebugger::ClearEvents()
+{
+	EventHead = 0;
+	EventCount = 0;
+	EventPostTriggerRemaining = INDEX_NONE;
+	UE_LOG(LogTemp, Log, TEXT("DestructionDebugger: Event timeline cleared"));
+}
+
+bool UDestructionDebugger::ExportEventsToCSV(const FString& FilePath) const
+{
+	TArray<FDestructionEventRecord> Events;
+	GetEvents(Events);
+
+	FString CSVContent = TEXT("Time,Frame,Source,Actor,Component,CellCount,BooleanMs,BytesSent\n");
+	for (const FDestructionEventRecord& Event : Events)
+	{
+		CSVContent += FString::Printf(
+			TEXT("%.4f,%llu,%s,%s,%s,%d,%.3f,%d\n"),
+			Event.Time,
+			Event.Frame,
+			GetEventSourceName(Event.Source),
+			*Event.ActorName.ToString(),
+			*Event.ComponentName.ToString(),
+			Event.CellCount,
+			Event.BooleanTimeMs,
+			Event.BytesSent
+		);
+	}
+
+	FString FullPath = FilePath.IsEmpty() ? FPaths::ProjectSavedDir() / TEXT("DestructionEvents.csv") : FilePath;
+
+	if (FFileHelper::SaveStringToFile(CSVContent, *FullPath))
+	{
+		UE_LOG(LogTemp, Log, TEXT("DestructionDebugger: %d events exported to %s"), Events.Num(), *FullPath);
+		return true;
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("DestructionDebugger: Failed to export events to %s"), *FullPath);
+	return false;
+}
+
+bool UDestructionDebugger::ExportEventsToJSON(const FString& FilePath) const
+{
+	TArray<FDestructionEventRecord> Events;
+	GetEvents(Events);
+
+	// 액터/컴포넌트 이름은 FName이므로 JSON 이스케이프가 필요한 문자 없음
+	FString JSONContent = FString::Printf(TEXT("{\n\t\"frozen\": %s,\n\t\"freezeThresholdMs\": %.3f,\n\t\"events\": [\n"),
+		bEventsFrozen ? TEXT("true") : TEXT("false"), EventFreezeThresholdMs);
+
+	for (int32 i = 0; i < Events.Num(); ++i)
+	{
+		const FDestructionEventRecord& Event = Events[i];
+		JSONContent += FString::Printf(
+			TEXT("\t\t{\"time\": %.4f, \"frame\": %llu, \"source\": \"%s\", \"actor\": \"%s\", \"component\": \"%s\", \"cells\": %d, \"booleanMs\": %.3f, \"bytesSent\": %d}%s\n"),
+			Event.Time,
+			Event.Frame,
+			GetEventSourceName(Event.Source),
+			*Event.ActorName.ToString(),
+			*Event.ComponentName.ToString(),
+			Event.CellCount,
+			Event.BooleanTimeMs,
+			Event.BytesSent,
+			(i + 1 < Events.Num()) ? TEXT(",") : TEXT("")
+		);
+	}
+	JSONContent += TEXT("\t]\n}\n");
+
+	FString FullPath = FilePath.IsEmpty() ? FPaths::ProjectSavedDir() / TEXT("DestructionEvents.json") : FilePath;
+
+	if (FFileHelper::SaveStringToFile(JSONContent, *FullPath))
+	{
+		UE_LOG(LogTemp, Log, TEXT("DestructionDebugger: %d events exported to %s"), Events.Num(), *FullPath);
+		return true;
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("DestructionDebugger: Failed to export events to %s"), *FullPath);
+	return false;
+}
+
 //-------------------------------------------------------------------
 // 콘솔 명령어용 함수
 //-------------------------------------------------------------------
@@ -18,6 +18,25 @@ URDMSetting::URDMSetting()
 
 	MaxThreadCount = 8;
 	ThreadPercentage = 50;
+
+	bUseDedicatedThreadPool = false;
+	WorkerPriority = ERDMWorkerPriority::Default;
+	WorkerAffinityMask = 0;
+
+	bEnableDynamicWorkerScaling = false;
+	TargetFrameTimeMs = 16.6f;
+
+	bConsolidateSettledDebris = true;
+	RubbleAreaSize = 2000.0f;
+	MaxRubbleTrianglesPerArea = 50000;
+	RubbleMergeInterval = 0.5f;
+
+	bEnableDebrisBudget = true;
+	MaxDebrisCount = 200;
+	MaxDebrisTriangles = 200000;
+	MaxDebrisBodies = 100;
+	DebrisImportanceHalfDistance = 3000.0f;
+	DebrisImportanceHalfAge = 5.0f;
 }
 
 URDMSetting* URDMSetting::Get()
@@ -80,6 +99,11 @@ int32 URDMSetting::	GetEffectiveThreadCount() const
 	}
 }
 
+int32 URDMSetting::GetDynamicThreadCountLimit()
+{
+	return FMath::Max(1, GetSystemThreadCount() - 2);
+}
+
 int32 URDMSetting::GetSystemThreadCount()
 {
 	return FPlatformMisc::NumberOfCoresIncludingHyperthreads();
@@ -173,51 +173,60 @@ TSet<int32> FCellDestructionSystem::FindDisconnectedCellsCellLevel(
 	const TSet<int32>& DestroyedCells)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_FindDisconnectedCellsCellLevel)
-	TSet<int32> Connected;
-	TQueue<int32> Queue;
+	const int32 TotalCells = GridLayout.GetTotalCellCount();
+
+	// Cell-only kernel: destroyed/visited are flat bit arrays, so the inner loop does no hashing.
+	// A cell is blocked once it is destroyed or already visited.
+	TBitArray<> Blocked(false, TotalCells);
+	for (int32 CellId : DestroyedCells)
+	{
+		if (CellId >= 0 && CellId < TotalCells)
+		{
+			Blocked[CellId] = true;
+		}
+	}
+	const int32 DestroyedCount = DestroyedCells.Num();
+
+	TArray<int32> Queue;
+	Queue.Reserve(TotalCells);
 
 	// 1. Start BFS from anchors
-	for (int32 CellId = 0; CellId < GridLayout.GetTotalCellCount(); CellId++)
+	for (int32 CellId = 0; CellId < TotalCells; CellId++)
 	{
 		if (GridLayout.GetCellExists(CellId) &&
 		    GridLayout.GetCellIsAnchor(CellId) &&
-		    !DestroyedCells.Contains(CellId))
+		    !Blocked[CellId])
 		{
-			Queue.Enqueue(CellId);
-			Connected.Add(CellId);
+			Blocked[CellId] = true;
+			Queue.Add(CellId);
 		}
 	}
 
 	// 2. BFS traversal
-	while (!Queue.IsEmpty())
+	for (int32 Head = 0; Head < Queue.Num(); ++Head)
 	{
-		int32 Current;
-		Queue.Dequeue(Current);
-
-		for (int32 Neighbor : GridLayout.GetCellNeighbors(Current))
+		for (int32 Neighbor : GridLayout.GetCellNeighbors(Queue[Head]))
 		{
-			if (!DestroyedCells.Contains(Neighbor) &&
-			    !Connected.Contains(Neighbor))
+			if (!Blocked[Neighbor])
 			{
-				Connected.Add(Neighbor);
-				Queue.Enqueue(Neighbor);
+				Blocked[Neighbor] = true;
+				Queue.Add(Neighbor);
 			}
 		}
 	}
 
-	// 3. Unconnected cells are detached
+	// 3. Unconnected cells are detached (neither destroyed nor reached)
 	TSet<int32> Disconnected;
 	int32 ValidCellCount = 0;
 	int32 AnchorCount = 0;
-	for (int32 CellId = 0; CellId < GridLayout.GetTotalCellCount(); CellId++)
+	for (int32 CellId = 0; CellId < TotalCells; CellId++)
 	{
 		if (GridLayout.GetCellExists(CellId))
 		{
 			ValidCellCount++;
 			if (GridLayout.GetCellIsAnchor(CellId)) AnchorCount++;
 
-			if (!DestroyedCells.Contains(CellId) &&
-			    !Connected.Contains(CellId))
+			if (!Blocked[CellId])
 			{
 				Disconnected.Add(CellId);
 			}
@@ -225,7 +234,7 @@ TSet<int32> FCellDestructionSystem::FindDisconnectedCellsCellLevel(
 	}
 
 	UE_LOG(LogTemp, Warning, TEXT("FindDisconnectedCellsCellLevel: Valid=%d, Anchor=%d, Destroyed=%d, Connected=%d, Disconnected=%d"),
-		ValidCellCount, AnchorCount, DestroyedCells.Num(), Connected.Num(), Disconnected.Num());
+		ValidCellCount, AnchorCount, DestroyedCount, Queue.Num(), Disconnected.Num());
 
 	return Disconnected;
 }
@@ -235,47 +244,128 @@ TArray<TArray<int32>> FCellDestructionSystem::GroupDetachedCells(
 	const TSet<int32>& DisconnectedCells,
 	const TSet<int32>& DestroyedCells)
 {
+	TArray<FDetachedCellGroup> Labeled;
+	LabelDetachedCells(GridLayout, DisconnectedCells, Labeled);
+
 	TArray<TArray<int32>> Groups;
-	TSet<int32> Visited;
+	Groups.Reserve(Labeled.Num());
+	for (FDetachedCellGroup& Group : Labeled)
+	{
+		Groups.Add(MoveTemp(Group.CellIds));
+	}
+
+	return Groups;
+}
+
+void FCellDestructionSystem::LabelDetachedCells(
+	const FGridCellLayout& GridLayout,
+	const TSet<int32>& DisconnectedCells,
+	TArray<FDetachedCellGroup>& OutGroups)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_LabelDetachedCells);
 
-	//=========================================================================
-	// Phase 1: Group disconnected cells via BFS
-	//=========================================================================
-	for (int32 StartCell : DisconnectedCells)
+	OutGroups.Reset();
+	if (DisconnectedCells.Num() == 0)
 	{
-		if (Visited.Contains(StartCell))
+		return;
+	}
+
+	// Scanline order: sorted IDs walk the grid X-first, so roots end up at each group's smallest ID
+	TArray<int32> Cells = DisconnectedCells.Array();
+	Cells.Sort();
+
+	// Grid index -> local index lookup. Reused per thread; only touched entries are reset on exit.
+	static thread_local TArray<int32> LocalIndexOfCell;
+	const int32 TotalCells = GridLayout.GetTotalCellCount();
+	if (LocalIndexOfCell.Num() < TotalCells)
+	{
+		LocalIndexOfCell.Init(INDEX_NONE, TotalCells);
+	}
+
+	for (int32 i = 0; i < Cells.Num(); ++i)
+	{
+		if (Cells[i] >= 0 && Cells[i] < TotalCells)
 		{
-			continue;
+			LocalIndexOfCell[Cells[i]] = i;
 		}
+	}
 
-		// Find a connected detached cell group via BFS
-		TArray<int32> Group;
-		TQueue<int32> Queue;
+	TArray<int32> Parent;
+	Parent.SetNumUninitialized(Cells.Num());
+	for (int32 i = 0; i < Cells.Num(); ++i)
+	{
+		Parent[i] = i;
+	}
 
-		Queue.Enqueue(StartCell);
-		Visited.Add(StartCell);
+	auto Find = [&Parent](int32 Index)
+	{
+		while (Parent[Index] != Index)
+		{
+			Parent[Index] = Parent[Parent[Index]];
+			Index = Parent[Index];
+		}
+		return Index;
+	};
 
-		while (!Queue.IsEmpty())
+	// Union pass: each edge is visited once (from the smaller ID)
+	for (int32 i = 0; i < Cells.Num(); ++i)
+	{
+		const int32 CellId = Cells[i];
+		if (CellId < 0 || CellId >= TotalCells)
 		{
-			int32 Current;
-			Queue.Dequeue(Current);
-			Group.Add(Current);
+			continue;
+		}
 
-			for (int32 Neighbor : GridLayout.GetCellNeighbors(Current))
+		for (int32 Neighbor : GridLayout.GetCellNeighbors(CellId))
+		{
+			if (Neighbor <= CellId || Neighbor >= TotalCells)
 			{
-				if (DisconnectedCells.Contains(Neighbor) &&
-				    !Visited.Contains(Neighbor))
-				{
-					Visited.Add(Neighbor);
-					Queue.Enqueue(Neighbor);
-				}
+				continue;
+			}
+
+			const int32 j = LocalIndexOfCell[Neighbor];
+			if (j == INDEX_NONE)
+			{
+				continue;
+			}
+
+			const int32 RootA = Find(i);
+			const int32 RootB = Find(j);
+			if (RootA != RootB)
+			{
+				// Keep the smaller local index as root so group order follows the smallest cell ID
+				Parent[FMath::Max(RootA, RootB)] = FMath::Min(RootA, RootB);
 			}
 		}
+	}
+
+	// Emit pass: groups, bounds and counts in ascending cell order
+	TArray<int32> GroupOfRoot;
+	GroupOfRoot.Init(INDEX_NONE, Cells.Num());
+	for (int32 i = 0; i < Cells.Num(); ++i)
+	{
+		const int32 Root = Find(i);
+		int32& GroupIndex = GroupOfRoot[Root];
+		if (GroupIndex == INDEX_NONE)
+		{
+			GroupIndex = OutGroups.AddDefaulted();
+		}
+
+		FDetachedCellGroup& Group = OutGroups[GroupIndex];
+		Group.CellIds.Add(Cells[i]);
 
-		Groups.Add(MoveTemp(Group));
+		const FIntVector Coord = GridLayout.IdToCoord(Cells[i]);
+		Group.MinCoord = FIntVector(FMath::Min(Group.MinCoord.X, Coord.X), FMath::Min(Group.MinCoord.Y, Coord.Y), FMath::Min(Group.MinCoord.Z, Coord.Z));
+		Group.MaxCoord = FIntVector(FMath::Max(Group.MaxCoord.X, Coord.X), FMath::Max(Group.MaxCoord.Y, Coord.Y), FMath::Max(Group.MaxCoord.Z, Coord.Z));
+	}
+
+	for (int32 CellId : Cells)
+	{
+		if (CellId >= 0 && CellId < TotalCells)
+		{
+			LocalIndexOfCell[CellId] = INDEX_NONE;
+		}
 	}
-	
-	return Groups;
 }
 
 //=============================================================================
@@ -439,7 +529,7 @@ void FDestructionBatchProcessor::ProcessBatch()
 	//=====================================================
 	for (int32 CellId : NewlyDestroyed)
 	{
-		CellStatePtr->DestroyedCells.Add(CellId);
+		CellStatePtr->DestroyCell(CellId);
 	}
 
 	//=====================================================
@@ -458,7 +548,7 @@ void FDestructionBatchProcessor::ProcessBatch()
 	{
 		for (int32 CellId : Group)
 		{
-			CellStatePtr->DestroyedCells.Add(CellId);
+			CellStatePtr->DestroyCell(CellId);
 		}
 	}
 
@@ -1453,13 +1543,13 @@ namespace HierarchicalBFSHelper
 		}
 	}
 
+	template <bool bSubcell>
 	FORCEINLINE void TryAddNeighborCell_Opt(
 		int32 BoundaryCellId,
 		int32 NeighborCellId,
 		int32 Dir,
 		const FGridCellLayout& GridLayout,
 		const FCellState& CellState,
-		bool bEnableSubcell,
 		FConnectivityContext& Context,
 		TArray<FCellNode>& Stack)
 	{
@@ -1478,10 +1568,12 @@ namespace HierarchicalBFSHelper
 			return;
 		}
 
-		if (bEnableSubcell &&
-			!SubCellBFSHelper::HasConnectedBoundary(BoundaryCellId, NeighborCellId, Dir, CellState))
+		if constexpr (bSubcell)
 		{
-			return;
+			if (!SubCellBFSHelper::HasConnectedBoundary(BoundaryCellId, NeighborCellId, Dir, CellState))
+			{
+				return;
+			}
 		}
 
 		Context.SetCellConnected(NeighborCellId);
@@ -1514,12 +1606,12 @@ namespace HierarchicalBFSHelper
 		}
 	}
 
+	template <bool bSubcell>
 	void ProcessSupercellNode_Opt(
 		int32 SupercellId,
 		const FGridCellLayout& GridLayout,
 		FSuperCellState& SupercellState,
 		const FCellState& CellState,
-		bool bEnableSubcell,
 		FConnectivityContext& Context,
 		TArray<FCellNode>& Stack
 		)
@@ -1565,8 +1657,8 @@ namespace HierarchicalBFSHelper
 						if (GridLayout.IsValidCoord(Range.StartX - 1, Y, Z))
 						{
 							const int32 NeighborCellId = GridLayout.CoordToId(Range.StartX - 1, Y, Z);
-							TryAddNeighborCell_Opt(BoundaryCellId, NeighborCellId, Dir, GridLayout, CellState,
-							                       bEnableSubcell, Context, Stack);
+							TryAddNeighborCell_Opt<bSubcell>(BoundaryCellId, NeighborCellId, Dir, GridLayout, CellState,
+							                                 Context, Stack);
 						}
 					}
 				}
@@ -1581,8 +1673,8 @@ namespace HierarchicalBFSHelper
 						if (GridLayout.IsValidCoord(Range.EndX, Y, Z))
 						{
 							const int32 NeighborCellId = GridLayout.CoordToId(Range.EndX, Y, Z);
-							TryAddNeighborCell_Opt(BoundaryCellId, NeighborCellId, Dir, GridLayout, CellState,
-							                       bEnableSubcell, Context, Stack);
+							TryAddNeighborCell_Opt<bSubcell>(BoundaryCellId, NeighborCellId, Dir, GridLayout, CellState,
+							                                 Context, Stack);
 						}
 					}
 				}
@@ -1597,8 +1689,8 @@ namespace HierarchicalBFSHelper
 						if (GridLayout.IsValidCoord(X, Range.StartY - 1, Z))
 						{
 							const int32 NeighborCellId = GridLayout.CoordToId(X, Range.StartY - 1, Z);
-							TryAddNeighborCell_Opt(BoundaryCellId, NeighborCellId, Dir, GridLayout, CellState,
-							                       bEnableSubcell, Context, Stack);
+							TryAddNeighborCell_Opt<bSubcell>(BoundaryCellId, NeighborCellId, Dir, GridLayout, CellState,
+							                                 Context, Stack);
 						}
 					}
 				}
@@ -1613,8 +1705,8 @@ namespace HierarchicalBFSHelper
 						if (GridLayout.IsValidCoord(X, Range.EndY, Z))
 						{
 							const int32 NeighborCellId = GridLayout.CoordToId(X, Range.EndY, Z);
-							TryAddNeighborCell_Opt(BoundaryCellId, NeighborCellId, Dir, GridLayout, CellState,
-							                       bEnableSubcell, Context, Stack);
+							TryAddNeighborCell_Opt<bSubcell>(BoundaryCellId, NeighborCellId, Dir, GridLayout, CellState,
+							                                 Context, Stack);
 						}
 					}
 				}
@@ -1629,8 +1721,8 @@ namespace HierarchicalBFSHelper
 						if (GridLayout.IsValidCoord(X, Y, Range.StartZ - 1))
 						{
 							const int32 NeighborCellId = GridLayout.CoordToId(X, Y, Range.StartZ - 1);
-							TryAddNeighborCell_Opt(BoundaryCellId, NeighborCellId, Dir, GridLayout, CellState,
-							                       bEnableSubcell, Context, Stack);
+							TryAddNeighborCell_Opt<bSubcell>(BoundaryCellId, NeighborCellId, Dir, GridLayout, CellState,
+							                                 Context, Stack);
 						}
 					}
 				}
@@ -1645,8 +1737,8 @@ namespace HierarchicalBFSHelper
 						if (GridLayout.IsValidCoord(X, Y, Range.EndZ))
 						{
 							const int32 NeighborCellId = GridLayout.CoordToId(X, Y, Range.EndZ);
-							TryAddNeighborCell_Opt(BoundaryCellId, NeighborCellId, Dir, GridLayout, CellState,
-							                       bEnableSubcell, Context, Stack);
+							TryAddNeighborCell_Opt<bSubcell>(BoundaryCellId, NeighborCellId, Dir, GridLayout, CellState,
+							                                 Context, Stack);
 						}
 					}
 				}
@@ -1658,8 +1750,8 @@ namespace HierarchicalBFSHelper
 		{
 			if (SupercellState.IsCellOrphan(NeighborCellId))
 			{
-				TryAddNeighborCell_Opt(BoundaryCellId, NeighborCellId, OrphanDir, GridLayout, CellState,
-				                       bEnableSubcell, Context, Stack);
+				TryAddNeighborCell_Opt<bSubcell>(BoundaryCellId, NeighborCellId, OrphanDir, GridLayout, CellState,
+				                                 Context, Stack);
 			}
 		};
 
@@ -1791,263 +1883,294 @@ TSet<int32> FCellDestructionSystem::FindDisconnectedCellsHierarchicalLevel(
 	return Disconnected;
 }
 
-void FCellDestructionSystem::FindConnectedCellsHierarchical_Optimized(
-	const FGridCellLayout& Cache,
-	FSuperCellState& SupercellState,
-	const FCellState& CellState,
-	FConnectivityContext& Context,
-	bool bEnableSubcell)
+namespace HierarchicalBFSHelper
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_FindConnectedCellsHierarchical_Opt);
-	
-	using namespace HierarchicalBFSHelper;
-	int32 TotalCells = Cache.GetTotalCellCount();
-	
-	Context.Reset(TotalCells, SupercellState.GetTotalSupercellCount());
+	/**
+	 * Bitmask of the six directions (-X, +X, -Y, +Y, -Z, +Z) that stay inside the grid.
+	 * Computed once per cell so the neighbor loop does one test per direction instead of six.
+	 */
+	FORCEINLINE uint8 GetInteriorDirectionMask(int32 X, int32 Y, int32 Z, const FIntVector& GridSize)
+	{
+		return static_cast<uint8>(
+			((X > 0) ? 1 << 0 : 0) |
+			((X < GridSize.X - 1) ? 1 << 1 : 0) |
+			((Y > 0) ? 1 << 2 : 0) |
+			((Y < GridSize.Y - 1) ? 1 << 3 : 0) |
+			((Z > 0) ? 1 << 4 : 0) |
+			((Z < GridSize.Z - 1) ? 1 << 5 : 0));
+	}
 
-	TArray<FCellNode>& Stack = Context.WorkStack;
+	/**
+	 * Hierarchical connectivity kernel.
+	 * bSubcell is resolved at compile time, so the cell-only variant carries no subcell lookups.
+	 */
+	template <bool bSubcell>
+	void FindConnectedCellsHierarchicalKernel(
+		const FGridCellLayout& Cache,
+		FSuperCellState& SupercellState,
+		const FCellState& CellState,
+		FConnectivityContext& Context)
+	{
+		const int32 TotalCells = Cache.GetTotalCellCount();
 
-	const int32 SizeX = Cache.GridSize.X;
-	const int32 SizeY = Cache.GridSize.Y;
-	const int32 SizeXY = Cache.GridSize.X * Cache.GridSize.Y;
+		Context.Reset(TotalCells, SupercellState.GetTotalSupercellCount());
 
-	const int32 Strides[6] = {-1, 1, -SizeX, SizeX, -SizeXY, SizeXY};
+		TArray<FCellNode>& Stack = Context.WorkStack;
+
+		const int32 SizeX = Cache.GridSize.X;
+		const int32 SizeXY = Cache.GridSize.X * Cache.GridSize.Y;
+
+		const int32 Strides[6] = {-1, 1, -SizeX, SizeX, -SizeXY, SizeXY};
 
-	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_FindConnectedCellsHierarchical_Opt_Anchor);
-		for (int32 CellId = 0; CellId < TotalCells; CellId++)
 		{
-			if (!Cache.GetCellExists(CellId))
-			{
-				continue;
-			}
-		
-			if (!Cache.GetCellIsAnchor(CellId))
+			TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_FindConnectedCellsHierarchical_Opt_Anchor);
+			for (int32 CellId = 0; CellId < TotalCells; CellId++)
 			{
-				continue;
-			}		
+				if (!Cache.GetCellExists(CellId))
+				{
+					continue;
+				}
 
-			if (CellState.DestroyedCells.Contains(CellId))
-			{
-				continue;
-			}
+				if (!Cache.GetCellIsAnchor(CellId))
+				{
+					continue;
+				}		
 
-			if (bEnableSubcell && !SubCellBFSHelper::HasAliveSubCell(CellId, CellState))
-			{
-				continue;
-			}
+				if (CellState.DestroyedCells.Contains(CellId))
+				{
+					continue;
+				}
 
-			const int32 SupercellId = SupercellState.GetSupercellForCell(CellId);
+				if constexpr (bSubcell)
+				{
+					if (!SubCellBFSHelper::HasAliveSubCell(CellId, CellState))
+					{
+						continue;
+					}
+				}
 
-			if (SupercellId != INDEX_NONE &&
-				SupercellState.IsSupercellIntact(SupercellId) &&
-				!Context.IsSuperCellVisited(SupercellId))
-			{
-				Context.SetSuperCellVisited(SupercellId);
-				Stack.Push(FCellNode::MakeSupercell(SupercellId));
-				MarkAllCellsInSuperCell_Bit(SupercellId, SupercellState, Cache, CellState, Context);
-			}
-			else
-			{
-				if (!Context.IsCellConnected(CellId))
+				const int32 SupercellId = SupercellState.GetSupercellForCell(CellId);
+
+				if (SupercellId != INDEX_NONE &&
+					SupercellState.IsSupercellIntact(SupercellId) &&
+					!Context.IsSuperCellVisited(SupercellId))
 				{
-					Context.SetCellConnected(CellId);
-					Stack.Push(FCellNode::MakeCell(CellId));
+					Context.SetSuperCellVisited(SupercellId);
+					Stack.Push(FCellNode::MakeSupercell(SupercellId));
+					MarkAllCellsInSuperCell_Bit(SupercellId, SupercellState, Cache, CellState, Context);
+				}
+				else
+				{
+					if (!Context.IsCellConnected(CellId))
+					{
+						Context.SetCellConnected(CellId);
+						Stack.Push(FCellNode::MakeCell(CellId));
+					}
 				}
 			}
 		}
-	}
 
-	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_FindConnectedCellsHierarchical_Opt_DFS);
-		while (Stack.Num() > 0)
 		{
-			const FCellNode Current = Stack.Pop(EAllowShrinking::No);
-
-			if (Current.bIsSupercell)
+			TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_FindConnectedCellsHierarchical_Opt_DFS);
+			while (Stack.Num() > 0)
 			{
-				TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_FindConnectedCellsHierarchical_Opt_Intact);
-				ProcessSupercellNode_Opt(
-					Current.Id,
-					Cache,
-					SupercellState,
-					CellState,
-					bEnableSubcell,
-					Context,
-					Stack);
-			}
-			else
-			{
-				TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_FindConnectedCellsHierarchical_Opt_Cell);
-				const int32 CurrentId = Current.Id;
-
-				const int32 Z = CurrentId / SizeXY;
-				const int32 RemXY = CurrentId - Z * SizeXY;
-				const int32 Y = RemXY / SizeX;
-				const int32 X = RemXY - Y * SizeX;
+				const FCellNode Current = Stack.Pop(EAllowShrinking::No);
 
-				for (int32 Dir = 0; Dir < 6; ++Dir)
+				if (Current.bIsSupercell)
 				{
-					// -X boundary
-					if (Dir == 0 && X == 0)
-					{
-						continue;
-					}
-					// +X boundary
-					if (Dir == 1 && X == SizeX - 1)
-					{
-						continue;
-					}				
-				
-					// -Y boundary
-					if (Dir == 2 && Y == 0)
-					{
-						continue;
-					}
-					// +Y boundary
-					if (Dir == 3 && Y >= (SizeY - 1))
-					{
-						continue;
-					}
+					TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_FindConnectedCellsHierarchical_Opt_Intact);
+					ProcessSupercellNode_Opt<bSubcell>(
+						Current.Id,
+						Cache,
+						SupercellState,
+						CellState,
+						Context,
+						Stack);
+				}
+				else
+				{
+					TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_FindConnectedCellsHierarchical_Opt_Cell);
+					const int32 CurrentId = Current.Id;
 
-					// -Z boundary
-					if (Dir == 4 && Z == 0)
-					{
-						continue;
-					}
-					// +Z boundary
-					if (Dir == 5 && Z == Cache.GridSize.Z - 1)
-					{
-						continue;
-					}
+					const int32 Z = CurrentId / SizeXY;
+					const int32 RemXY = CurrentId - Z * SizeXY;
+					const int32 Y = RemXY / SizeX;
+					const int32 X = RemXY - Y * SizeX;
 
-					const int32 NeighborId = CurrentId + Strides[Dir];
+					const uint8 DirMask = GetInteriorDirectionMask(X, Y, Z, Cache.GridSize);
 
-					if (!Cache.GetCellExists(NeighborId))
+					for (int32 Dir = 0; Dir < 6; ++Dir)
 					{
-						continue;
-					}
+						if ((DirMask & (1 << Dir)) == 0)
+						{
+							continue;
+						}
 
-					if (CellState.DestroyedCells.Contains(NeighborId))
-					{
-						continue;
-					}
+						const int32 NeighborId = CurrentId + Strides[Dir];
 
-					if (Context.IsCellConnected(NeighborId))
-					{
-						continue;
-					}
-				
-					if (bEnableSubcell && !SubCellBFSHelper::HasConnectedBoundary(CurrentId, NeighborId, Dir, CellState))
-					{
-						continue;
-					}
+						if (!Cache.GetCellExists(NeighborId))
+						{
+							continue;
+						}
 
-					const int32 NeighborSupercellId = SupercellState.GetSupercellForCell(NeighborId);
+						if (CellState.DestroyedCells.Contains(NeighborId))
+						{
+							continue;
+						}
 
-					if (NeighborSupercellId != INDEX_NONE &&
-						SupercellState.IsSupercellIntact(NeighborSupercellId) &&
-						!Context.IsSuperCellVisited(NeighborSupercellId))
-					{
-						Context.SetSuperCellVisited(NeighborSupercellId);
-						Stack.Push(FCellNode::MakeSupercell(NeighborSupercellId));
-						MarkAllCellsInSuperCell_Bit(NeighborSupercellId, SupercellState, Cache, CellState, Context);
-					}
-					else
-					{
-						Context.SetCellConnected(NeighborId);
-						Stack.Push(FCellNode::MakeCell(NeighborId));
+						if (Context.IsCellConnected(NeighborId))
+						{
+							continue;
+						}
+
+						if constexpr (bSubcell)
+						{
+							if (!SubCellBFSHelper::HasConnectedBoundary(CurrentId, NeighborId, Dir, CellState))
+							{
+								continue;
+							}
+						}
+
+						const int32 NeighborSupercellId = SupercellState.GetSupercellForCell(NeighborId);
+
+						if (NeighborSupercellId != INDEX_NONE &&
+							SupercellState.IsSupercellIntact(NeighborSupercellId) &&
+							!Context.IsSuperCellVisited(NeighborSupercellId))
+						{
+							Context.SetSuperCellVisited(NeighborSupercellId);
+							Stack.Push(FCellNode::MakeSupercell(NeighborSupercellId));
+							MarkAllCellsInSuperCell_Bit(NeighborSupercellId, SupercellState, Cache, CellState, Context);
+						}
+						else
+						{
+							Context.SetCellConnected(NeighborId);
+							Stack.Push(FCellNode::MakeCell(NeighborId));
+						}
 					}
 				}
 			}
 		}
 	}
+}
 
-	// TSet<int32> ConnectedCells(Context.ConnectedCellIds);
-	//
-	// return ConnectedCells;
-} 
-
-TSet<int32> FCellDestructionSystem::FindDisconnectedCellsFromAffected(
+void FCellDestructionSystem::FindConnectedCellsHierarchical_Optimized(
 	const FGridCellLayout& Cache,
 	FSuperCellState& SupercellState,
 	const FCellState& CellState,
-	const TArray<int32>& AffectedNeighborCells,
 	FConnectivityContext& Context,
-	bool bEnableSupercell,
 	bool bEnableSubcell)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(DFSToAnchor_FindDisconnectedCellsFromAffected);
-	using namespace HierarchicalBFSHelper;
+	TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_FindConnectedCellsHierarchical_Opt);
 
-	TSet<int32> DisconnectedCells;
-	TSet<int32> ConfirmedConnected;
+	// Select the specialized kernel once per call (no flag checks in the inner loops)
+	if (bEnableSubcell)
+	{
+		HierarchicalBFSHelper::FindConnectedCellsHierarchicalKernel<true>(Cache, SupercellState, CellState, Context);
+	}
+	else
+	{
+		HierarchicalBFSHelper::FindConnectedCellsHierarchicalKernel<false>(Cache, SupercellState, CellState, Context);
+	}
+}
 
-	const int32 TotalCells = Cache.GetTotalCellCount();
-	const int32 SizeX = Cache.GridSize.X;
-	const int32 SizeY = Cache.GridSize.Y;
-	const int32 SizeZ = Cache.GridSize.Z;
-	const int32 SizeXY = SizeX * SizeY;
+namespace HierarchicalBFSHelper
+{
+	/**
+	 * Local DFS-to-anchor kernel for FindDisconnectedCellsFromAffected.
+	 * bSupercell / bSubcell are resolved at compile time (four variants, one selected per call).
+	 */
+	template <bool bSupercell, bool bSubcell>
+	TSet<int32> FindDisconnectedCellsFromAffectedKernel(
+		const FGridCellLayout& Cache,
+		FSuperCellState& SupercellState,
+		const FCellState& CellState,
+		const TArray<int32>& AffectedNeighborCells,
+		FConnectivityContext& Context)
+	{
+		TSet<int32> DisconnectedCells;
+		TSet<int32> ConfirmedConnected;
 
-	// CellId = X + Y * SizeX + Z * SizeX * SizeY
-	// x축 이동 = 1, y축 이동 = sizeX, z축 이동 = sizeX * sizeY 
-	const int32 Stride[6] = { -1, 1, -SizeX, SizeX, -SizeXY, SizeXY };
+		const int32 TotalCells = Cache.GetTotalCellCount();
+		const int32 SizeX = Cache.GridSize.X;
+		const int32 SizeXY = SizeX * Cache.GridSize.Y;
 
-	for (int32 StartCellId : AffectedNeighborCells)
-	{
-		// 이미 정해진 Cell Id 
-		if (ConfirmedConnected.Contains(StartCellId) || DisconnectedCells.Contains(StartCellId))
-		{
-			continue;
-		}
+		// CellId = X + Y * SizeX + Z * SizeX * SizeY
+		// x축 이동 = 1, y축 이동 = sizeX, z축 이동 = sizeX * sizeY 
+		const int32 Stride[6] = { -1, 1, -SizeX, SizeX, -SizeXY, SizeXY };
 
-		// Skip Destroyed cells
-		if (CellState.DestroyedCells.Contains(StartCellId))
+		for (int32 StartCellId : AffectedNeighborCells)
 		{
-			continue;
-		}
+			// 이미 정해진 Cell Id 
+			if (ConfirmedConnected.Contains(StartCellId) || DisconnectedCells.Contains(StartCellId))
+			{
+				continue;
+			}
 
-		// Skip non-existent cells
-		if (!Cache.GetCellExists(StartCellId))
-		{
-			continue;	
-		}
+			// Skip Destroyed cells
+			if (CellState.DestroyedCells.Contains(StartCellId))
+			{
+				continue;
+			}
 
-		// Reset context for this search
-		Context.Reset(TotalCells, SupercellState.GetTotalSupercellCount());
-		 
-		TArray<FCellNode>& Stack = Context.WorkStack;
-		bool bFoundAnchor = false;
+			// Skip non-existent cells
+			if (!Cache.GetCellExists(StartCellId))
+			{
+				continue;	
+			}
 
-		if (bEnableSupercell)
-		{
-			const int32 SupercellId = SupercellState.GetSupercellForCell(StartCellId);
+			// Reset context for this search
+			Context.Reset(TotalCells, SupercellState.GetTotalSupercellCount());
 
-			// Supercell 존재 && 손상 X 
-			if (SupercellId != INDEX_NONE && SupercellState.IsSupercellIntact(SupercellId))
-			{	
-				// 앵커가 있는 Supercell에 도착
-				if (SupercellContainsAnchor(SupercellId, Cache, SupercellState, CellState))
-				{
-					bFoundAnchor = true;
-				}
+			TArray<FCellNode>& Stack = Context.WorkStack;
+			bool bFoundAnchor = false;
 
-				// ConfirmedConnected를 포함중
-				else if (SupercellContainsConfirmedConnected(SupercellId, Cache, SupercellState, ConfirmedConnected))
-				{
-					bFoundAnchor = true;
+			if constexpr (bSupercell)
+			{
+				const int32 SupercellId = SupercellState.GetSupercellForCell(StartCellId);
+
+				// Supercell 존재 && 손상 X 
+				if (SupercellId != INDEX_NONE && SupercellState.IsSupercellIntact(SupercellId))
+				{	
+					// 앵커가 있는 Supercell에 도착
+					if (FCellDestructionSystem::SupercellContainsAnchor(SupercellId, Cache, SupercellState, CellState))
+					{
+						bFoundAnchor = true;
+					}
+
+					// ConfirmedConnected를 포함중
+					else if (FCellDestructionSystem::SupercellContainsConfirmedConnected(SupercellId, Cache, SupercellState, ConfirmedConnected))
+					{
+						bFoundAnchor = true;
+					}
+					else
+					{
+						Context.SetSuperCellVisited(SupercellId);
+						Stack.Push(FCellNode::MakeSupercell(SupercellId));
+						MarkAllCellsInSuperCell_Bit(SupercellId, SupercellState, Cache, CellState, Context); // 이미 intact false 인데, 한번에 bit찍으면 되지 않나 ?
+
+					}
 				}
 				else
 				{
-					Context.SetSuperCellVisited(SupercellId);
-					Stack.Push(FCellNode::MakeSupercell(SupercellId));
-					MarkAllCellsInSuperCell_Bit(SupercellId, SupercellState, Cache, CellState, Context); // 이미 intact false 인데, 한번에 bit찍으면 되지 않나 ?
-
+					// Broken SuperCell 또는 Orphan → Cell로 Push
+					if (Cache.GetCellIsAnchor(StartCellId))
+					{
+						bFoundAnchor = true;
+					}
+					else if (ConfirmedConnected.Contains(StartCellId))
+					{
+						bFoundAnchor = true;
+					}
+					else
+					{
+						Context.SetCellConnected(StartCellId);
+						Stack.Push(FCellNode::MakeCell(StartCellId));
+					}
 				}
 			}
+			// Supercell을 안쓰는 경우
 			else
 			{
-				// Broken SuperCell 또는 Orphan → Cell로 Push
 				if (Cache.GetCellIsAnchor(StartCellId))
 				{
 					bFoundAnchor = true;
@@ -2062,266 +2185,261 @@ TSet<int32> FCellDestructionSystem::FindDisconnectedCellsFromAffected(
 					Stack.Push(FCellNode::MakeCell(StartCellId));
 				}
 			}
-		}
-		// Supercell을 안쓰는 경우
-		else
-		{
-			if (Cache.GetCellIsAnchor(StartCellId))
-			{
-				bFoundAnchor = true;
-			}
-			else if (ConfirmedConnected.Contains(StartCellId))
-			{
-				bFoundAnchor = true;
-			}
-			else
-			{
-				Context.SetCellConnected(StartCellId);
-				Stack.Push(FCellNode::MakeCell(StartCellId));
-			}
-		}
 
-		// DFS Loop
-		while (!bFoundAnchor && Stack.Num() > 0)
-		{
-			// EAllowShrinking: 원소를 제거할 때 메모리를(capacity) 줄이지 않기
-			const FCellNode Current = Stack.Pop(EAllowShrinking::No);
-
-			if (Current.bIsSupercell)
+			// DFS Loop
+			while (!bFoundAnchor && Stack.Num() > 0)
 			{
-				const int32 SupercellId = Current.Id;
-				const FSupercellCellRange Range(SupercellId, SupercellState, Cache);
-				const FIntVector SupercellCoord = SupercellState.SupercellIdToCoord(SupercellId);
+				// EAllowShrinking: 원소를 제거할 때 메모리를(capacity) 줄이지 않기
+				const FCellNode Current = Stack.Pop(EAllowShrinking::No);
 
-				for (int32 Dir = 0; Dir < 6 && !bFoundAnchor; ++Dir)
+				if (Current.bIsSupercell)
 				{
-					const FIntVector NeighborsSCCoord = SupercellCoord + FIntVector(
-					DIRECTION_OFFSETS[Dir][0] ,
-					DIRECTION_OFFSETS[Dir][1] ,
-					DIRECTION_OFFSETS[Dir][2]
-					);
+					const int32 SupercellId = Current.Id;
+					const FSupercellCellRange Range(SupercellId, SupercellState, Cache);
+					const FIntVector SupercellCoord = SupercellState.SupercellIdToCoord(SupercellId);
 
-					if (!SupercellState.IsValidSupercellCoord(NeighborsSCCoord))
+					for (int32 Dir = 0; Dir < 6 && !bFoundAnchor; ++Dir)
 					{
-						continue;
-					}
-
-					const int32 NeighborSupercellId = SupercellState.SupercellCoordToId(NeighborsSCCoord);
+						const FIntVector NeighborsSCCoord = SupercellCoord + FIntVector(
+						DIRECTION_OFFSETS[Dir][0] ,
+						DIRECTION_OFFSETS[Dir][1] ,
+						DIRECTION_OFFSETS[Dir][2]
+						);
 
-					// Supercell이 손상이 안됐을 때
-					if (SupercellState.IsSupercellIntact(NeighborSupercellId))
-					{
-						// 이미 확인했으면 Pass
-						if (Context.IsSuperCellVisited(NeighborSupercellId))
+						if (!SupercellState.IsValidSupercellCoord(NeighborsSCCoord))
 						{
 							continue;
 						}
 
-						// 앵커를 포함하는 Supercell인가 
-						if (SupercellContainsAnchor(NeighborSupercellId,  Cache, SupercellState, CellState))
-						{
-							bFoundAnchor = true;
-							break;
-						}
-
-						// ConfirmedConnected를 포함하는 Supercell 
-						if (SupercellContainsConfirmedConnected(NeighborSupercellId, Cache, SupercellState, ConfirmedConnected))
-						{
-							bFoundAnchor = true;
-							break;
-						}
-
-						Context.SetSuperCellVisited(NeighborSupercellId);
-						Stack.Push(FCellNode::MakeSupercell(NeighborSupercellId));
-						MarkAllCellsInSuperCell_Bit(NeighborSupercellId, SupercellState, Cache, CellState, Context);
-					}
-					else
-					{
-						// 이미 깨진 Supercell  
-						TArray<int32> BoundaryCellIds;
-						SupercellState.GetBoundaryCellsInDirection(SupercellId, Dir, Cache, BoundaryCellIds);
+						const int32 NeighborSupercellId = SupercellState.SupercellCoordToId(NeighborsSCCoord);
 
-						for (int32 BoundaryCellId : BoundaryCellIds)
+						// Supercell이 손상이 안됐을 때
+						if (SupercellState.IsSupercellIntact(NeighborSupercellId))
 						{
-							// 존재하지 않거나, 파괴된 cell을 패스
-							if (!Cache.GetCellExists(BoundaryCellId) || CellState.DestroyedCells.Contains(BoundaryCellId))
+							// 이미 확인했으면 Pass
+							if (Context.IsSuperCellVisited(NeighborSupercellId))
 							{
 								continue;
 							}
 
-							const FIntVector BoundaryCoord = Cache.IdToCoord(BoundaryCellId);
-							const FIntVector NeighborCoord = BoundaryCoord + FIntVector(
-								DIRECTION_OFFSETS[Dir][0],
-								DIRECTION_OFFSETS[Dir][1],
-								DIRECTION_OFFSETS[Dir][2]
-							);
-						
-							if (!Cache.IsValidCoord(NeighborCoord))
+							// 앵커를 포함하는 Supercell인가 
+							if (FCellDestructionSystem::SupercellContainsAnchor(NeighborSupercellId,  Cache, SupercellState, CellState))
 							{
-								continue;
-							}
-
-							const int32 NeighborCellId = Cache.CoordToId(NeighborCoord);
-
-							// 이미 방문했거나 파괴된 Cell은 스킵
-							if (!Cache.GetCellExists(NeighborCellId) || CellState.DestroyedCells.Contains(NeighborCellId) || Context.IsCellConnected(NeighborCellId))
-							{
-								continue;
-							}
-
-							if (bEnableSubcell && !SubCellBFSHelper::HasConnectedBoundary(BoundaryCellId, NeighborCellId, Dir, CellState))
-							{
-								continue;
+								bFoundAnchor = true;
+								break;
 							}
 
-							if (Cache.GetCellIsAnchor(NeighborCellId))
+							// ConfirmedConnected를 포함하는 Supercell 
+							if (FCellDestructionSystem::SupercellContainsConfirmedConnected(NeighborSupercellId, Cache, SupercellState, ConfirmedConnected))
 							{
 								bFoundAnchor = true;
 								break;
 							}
 
-							if (ConfirmedConnected.Contains(NeighborCellId))
+							Context.SetSuperCellVisited(NeighborSupercellId);
+							Stack.Push(FCellNode::MakeSupercell(NeighborSupercellId));
+							MarkAllCellsInSuperCell_Bit(NeighborSupercellId, SupercellState, Cache, CellState, Context);
+						}
+						else
+						{
+							// 이미 깨진 Supercell  
+							TArray<int32> BoundaryCellIds;
+							SupercellState.GetBoundaryCellsInDirection(SupercellId, Dir, Cache, BoundaryCellIds);
+
+							for (int32 BoundaryCellId : BoundaryCellIds)
 							{
-								bFoundAnchor = true;
-								break;
+								// 존재하지 않거나, 파괴된 cell을 패스
+								if (!Cache.GetCellExists(BoundaryCellId) || CellState.DestroyedCells.Contains(BoundaryCellId))
+								{
+									continue;
+								}
+
+								const FIntVector BoundaryCoord = Cache.IdToCoord(BoundaryCellId);
+								const FIntVector NeighborCoord = BoundaryCoord + FIntVector(
+									DIRECTION_OFFSETS[Dir][0],
+									DIRECTION_OFFSETS[Dir][1],
+									DIRECTION_OFFSETS[Dir][2]
+								);
+
+								if (!Cache.IsValidCoord(NeighborCoord))
+								{
+									continue;
+								}
+
+								const int32 NeighborCellId = Cache.CoordToId(NeighborCoord);
+
+								// 이미 방문했거나 파괴된 Cell은 스킵
+								if (!Cache.GetCellExists(NeighborCellId) || CellState.DestroyedCells.Contains(NeighborCellId) || Context.IsCellConnected(NeighborCellId))
+								{
+									continue;
+								}
+
+								if constexpr (bSubcell)
+								{
+									if (!SubCellBFSHelper::HasConnectedBoundary(BoundaryCellId, NeighborCellId, Dir, CellState))
+									{
+										continue;
+									}
+								}
+
+								if (Cache.GetCellIsAnchor(NeighborCellId))
+								{
+									bFoundAnchor = true;
+									break;
+								}
+
+								if (ConfirmedConnected.Contains(NeighborCellId))
+								{
+									bFoundAnchor = true;
+									break;
+								}
+
+								Context.SetCellConnected(NeighborCellId);
+								Stack.Push(FCellNode::MakeCell(NeighborCellId));
 							}
 
-							Context.SetCellConnected(NeighborCellId);
-							Stack.Push(FCellNode::MakeCell(NeighborCellId));
 						}
 
 					}
 
 				}
-
-			}
-			else
-			{
-				// Cell 노드 처리 
-				const int32 CurrentCellId = Current.Id;
-
-				//CellId = X + Y * SizeX + Z * SizeX * SizeY
-				const int32 Z = CurrentCellId / SizeXY;
-				const int32 RemXY = CurrentCellId - Z * SizeXY;
-				const int32 Y = RemXY / SizeX;
-				const int32 X = RemXY - Y * SizeX;
-
-				// 정방향 : -X, X, -Y, Y, -Z, Z 
-				for (int32 Dir = 5 ; Dir >= 0 && !bFoundAnchor; --Dir)
+				else
 				{
-					// 경계 체크
-					if (Dir == 0 && X == 0)
-					{
-						continue;
-					}
-					if (Dir == 1 && X == SizeX - 1)
-					{
-						continue;
-					}
-					if (Dir == 2 && Y == 0)
-					{
-						continue;
-					}
-					if (Dir == 3 && Y == SizeY - 1)
-					{
-						continue;
-					}
-					if (Dir == 4 && Z == 0)
-					{
-						continue;
-					}
-					if (Dir == 5 && Z == SizeZ - 1)
-					{
-						continue;
-					}
+					// Cell 노드 처리 
+					const int32 CurrentCellId = Current.Id;
 
-					const int32 NeighborCellId = CurrentCellId + Stride[Dir];
+					//CellId = X + Y * SizeX + Z * SizeX * SizeY
+					const int32 Z = CurrentCellId / SizeXY;
+					const int32 RemXY = CurrentCellId - Z * SizeXY;
+					const int32 Y = RemXY / SizeX;
+					const int32 X = RemXY - Y * SizeX;
 
-					// 기본 체크
-					if (!Cache.GetCellExists(NeighborCellId) ||
-						CellState.DestroyedCells.Contains(NeighborCellId) ||
-						Context.IsCellConnected(NeighborCellId))
-					{
-						continue;
-					}
+					const uint8 DirMask = GetInteriorDirectionMask(X, Y, Z, Cache.GridSize);
 
-					// SubCell 경계 연결성 체크
-					if (bEnableSubcell &&
-						!SubCellBFSHelper::HasConnectedBoundary(CurrentCellId, NeighborCellId, Dir, CellState))
+					// 정방향 : -X, X, -Y, Y, -Z, Z 
+					for (int32 Dir = 5 ; Dir >= 0 && !bFoundAnchor; --Dir)
 					{
-						continue;
-					}
+						// 경계 체크
+						if ((DirMask & (1 << Dir)) == 0)
+						{
+							continue;
+						}
 
-					// 앵커 도달 체크
-					if (Cache.GetCellIsAnchor(NeighborCellId))
-					{
-						bFoundAnchor = true;
-						break;
-					}
+						const int32 NeighborCellId = CurrentCellId + Stride[Dir];
 
-					// ConfirmedConnected 도달 체크
-					if (ConfirmedConnected.Contains(NeighborCellId))
-					{
-						bFoundAnchor = true;
-						break;
-					}
-
-					// 이웃이 Intact SuperCell에 속하는지 체크
-					if (bEnableSupercell)
-					{
-						const int32 NeighborSupercellId = SupercellState.GetSupercellForCell(NeighborCellId);
+						// 기본 체크
+						if (!Cache.GetCellExists(NeighborCellId) ||
+							CellState.DestroyedCells.Contains(NeighborCellId) ||
+							Context.IsCellConnected(NeighborCellId))
+						{
+							continue;
+						}
 
-						if (NeighborSupercellId != INDEX_NONE &&
-							SupercellState.IsSupercellIntact(NeighborSupercellId) &&
-							!Context.IsSuperCellVisited(NeighborSupercellId))
+						// SubCell 경계 연결성 체크
+						if constexpr (bSubcell)
 						{
-							// Intact SuperCell -> 앵커/ConfirmedConnected 체크 후 SuperCell로 Push
-							if (SupercellContainsAnchor(NeighborSupercellId, Cache, SupercellState, CellState))
+							if (!SubCellBFSHelper::HasConnectedBoundary(CurrentCellId, NeighborCellId, Dir, CellState))
 							{
-								bFoundAnchor = true;
-								break;
+								continue;
 							}
+						}
+
+						// 앵커 도달 체크
+						if (Cache.GetCellIsAnchor(NeighborCellId))
+						{
+							bFoundAnchor = true;
+							break;
+						}
+
+						// ConfirmedConnected 도달 체크
+						if (ConfirmedConnected.Contains(NeighborCellId))
+						{
+							bFoundAnchor = true;
+							break;
+						}
 
-							if (SupercellContainsConfirmedConnected(NeighborSupercellId, Cache, SupercellState, ConfirmedConnected))
+						// 이웃이 Intact SuperCell에 속하는지 체크
+						if constexpr (bSupercell)
+						{
+							const int32 NeighborSupercellId = SupercellState.GetSupercellForCell(NeighborCellId);
+
+							if (NeighborSupercellId != INDEX_NONE &&
+								SupercellState.IsSupercellIntact(NeighborSupercellId) &&
+								!Context.IsSuperCellVisited(NeighborSupercellId))
 							{
-								bFoundAnchor = true;
-								break;
+								// Intact SuperCell -> 앵커/ConfirmedConnected 체크 후 SuperCell로 Push
+								if (FCellDestructionSystem::SupercellContainsAnchor(NeighborSupercellId, Cache, SupercellState, CellState))
+								{
+									bFoundAnchor = true;
+									break;
+								}
+
+								if (FCellDestructionSystem::SupercellContainsConfirmedConnected(NeighborSupercellId, Cache, SupercellState, ConfirmedConnected))
+								{
+									bFoundAnchor = true;
+									break;
+								}
+
+								Context.SetSuperCellVisited(NeighborSupercellId);
+								Stack.Push(FCellNode::MakeSupercell(NeighborSupercellId));
+								MarkAllCellsInSuperCell_Bit(NeighborSupercellId, SupercellState, Cache, CellState, Context);
+								continue;
 							}
-
-							Context.SetSuperCellVisited(NeighborSupercellId);
-							Stack.Push(FCellNode::MakeSupercell(NeighborSupercellId));
-							MarkAllCellsInSuperCell_Bit(NeighborSupercellId, SupercellState, Cache, CellState, Context);
-							continue;
 						}
-					}
 
-					// Broken SuperCell 또는 Orphan -> Cell로 Push
-					Context.SetCellConnected(NeighborCellId);
-					Stack.Push(FCellNode::MakeCell(NeighborCellId));
+						// Broken SuperCell 또는 Orphan -> Cell로 Push
+						Context.SetCellConnected(NeighborCellId);
+						Stack.Push(FCellNode::MakeCell(NeighborCellId));
+					}
 				}
-			}
 
-		}
+			}
 
-		if (bFoundAnchor)
-		{
-			for (int32 CellId : Context.ConnectedCellIds)
+			if (bFoundAnchor)
 			{
-				ConfirmedConnected.Add(CellId);
+				for (int32 CellId : Context.ConnectedCellIds)
+				{
+					ConfirmedConnected.Add(CellId);
+				}
 			}
-		}
 
-		else
-		{
-			for (int32 CellId : Context.ConnectedCellIds)
+			else
 			{
-				DisconnectedCells.Add(CellId);
+				for (int32 CellId : Context.ConnectedCellIds)
+				{
+					DisconnectedCells.Add(CellId);
+				}
 			}
 		}
+
+		return DisconnectedCells;
 	}
-	 
-	return DisconnectedCells;
 }
+
+TSet<int32> FCellDestructionSystem::FindDisconnectedCellsFromAffected(
+	const FGridCellLayout& Cache,
+	FSuperCellState& SupercellState,
+	const FCellState& CellState,
+	const TArray<int32>& AffectedNeighborCells,
+	FConnectivityContext& Context,
+	bool bEnableSupercell,
+	bool bEnableSubcell)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(DFSToAnchor_FindDisconnectedCellsFromAffected);
+	using namespace HierarchicalBFSHelper;
+
+	// Select the specialized kernel once per call (no flag checks in the inner loops)
+	if (bEnableSupercell)
+	{
+		return bEnableSubcell
+			? FindDisconnectedCellsFromAffectedKernel<true, true>(Cache, SupercellState, CellState, AffectedNeighborCells, Context)
+			: FindDisconnectedCellsFromAffectedKernel<true, false>(Cache, SupercellState, CellState, AffectedNeighborCells, Context);
+	}
+	return bEnableSubcell
+		? FindDisconnectedCellsFromAffectedKernel<false, true>(Cache, SupercellState, CellState, AffectedNeighborCells, Context)
+		: FindDisconnectedCellsFromAffectedKernel<false, false>(Cache, SupercellState, CellState, AffectedNeighborCells, Context);
+}
+
 bool FCellDestructionSystem::SupercellContainsAnchor(
 	int32 SupercellId,
 	const FGridCellLayout& Cache,
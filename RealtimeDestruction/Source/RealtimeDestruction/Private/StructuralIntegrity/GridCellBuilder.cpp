@@ -116,6 +116,13 @@ bool FGridCellBuilder::BuildFromStaticMesh(
 	// 7. Determine anchors
 	DetermineAnchors(OutLayout, AnchorHeightThreshold);
 
+	// 8. Bake per-cell material slots (assets cached before slots were captured pick them up here)
+	if (OutLayout.CachedTriangleMaterialSlots.Num() != OutLayout.CachedIndices.Num() / 3)
+	{
+		CacheTriangleMaterialSlots(SourceMesh, OutLayout);
+	}
+	BakeCellMaterialSlots(OutLayout);
+
 	UE_LOG(LogTemp, Log, TEXT("FGridCellBuilder: Built grid %dx%dx%d, valid cells: %d"),
 		OutLayout.GridSize.X, OutLayout.GridSize.Y, OutLayout.GridSize.Z,
 		OutLayout.GetValidCellCount());
@@ -441,6 +448,127 @@ void FGridCellBuilder::AssignTrianglesToCells(
 	}
 }
 
+void FGridCellBuilder::CacheTriangleMaterialSlots(
+	const UStaticMesh* SourceMesh,
+	FGridCellLayout& OutLayout)
+{
+	OutLayout.CachedTriangleMaterialSlots.Reset();
+
+	const int32 NumTris = OutLayout.CachedIndices.Num() / 3;
+	UStaticMeshDescription* StaticMeshDesc = SourceMesh ? const_cast<UStaticMesh*>(SourceMesh)->GetStaticMeshDescription(0) : nullptr;
+	const FMeshDescription* MeshDesc = StaticMeshDesc ? &StaticMeshDesc->GetMeshDescription() : nullptr;
+	if (!MeshDesc || NumTris == 0 || MeshDesc->Triangles().Num() != NumTris)
+	{
+		return;
+	}
+
+	FStaticMeshConstAttributes Attributes(*MeshDesc);
+	TPolygonGroupAttributesConstRef<FName> SlotNames = Attributes.GetPolygonGroupMaterialSlotNames();
+
+	// Same walk as VoxelizeWithTriangles, so the order matches CachedIndices
+	OutLayout.CachedTriangleMaterialSlots.Reserve(NumTris);
+	for (const FTriangleID TriID : MeshDesc->Triangles().GetElementIDs())
+	{
+		const FPolygonGroupID GroupID = MeshDesc->GetTrianglePolygonGroup(TriID);
+		int32 SlotIndex = SourceMesh->GetMaterialIndex(SlotNames[GroupID]);
+		if (SlotIndex == INDEX_NONE)
+		{
+			SlotIndex = GroupID.GetValue();
+		}
+		OutLayout.CachedTriangleMaterialSlots.Add(static_cast<uint8>(FMath::Clamp(SlotIndex, 0, 255)));
+	}
+}
+
+void FGridCellBuilder::BakeCellMaterialSlots(FGridCellLayout& OutLayout)
+{
+	OutLayout.CellMaterialSlots.Reset();
+
+	const int32 NumTris = OutLayout.CachedIndices.Num() / 3;
+	if (NumTris == 0 || OutLayout.CachedTriangleMaterialSlots.Num() != NumTris)
+	{
+		return;
+	}
+
+	const TArray<FVector>& Vertices = OutLayout.CachedVertices;
+	const uint32 NumVertices = Vertices.Num();
+
+	// Triangle area touching each cell, per slot (cells rarely see more than two slots)
+	TMap<int32, TArray<TPair<uint8, float>, TInlineAllocator<2>>> CellSlotAreas;
+	for (int32 TriIdx = 0; TriIdx < NumTris; ++TriIdx)
+	{
+		const uint32 I0 = OutLayout.CachedIndices[TriIdx * 3 + 0];
+		const uint32 I1 = OutLayout.CachedIndices[TriIdx * 3 + 1];
+		const uint32 I2 = OutLayout.CachedIndices[TriIdx * 3 + 2];
+		if (I0 >= NumVertices || I1 >= NumVertices || I2 >= NumVertices)
+		{
+			continue;
+		}
+
+		const FVector& V0 = Vertices[I0];
+		const FVector& V1 = Vertices[I1];
+		const FVector& V2 = Vertices[I2];
+		const float Area = 0.5f * FVector::CrossProduct(V1 - V0, V2 - V0).Size();
+		const uint8 Slot = OutLayout.CachedTriangleMaterialSlots[TriIdx];
+
+		RasterizeTriangleConservative(V0, V1, V2, OutLayout, [&CellSlotAreas, Slot, Area](int32 CellId)
+		{
+			auto& SlotAreas = CellSlotAreas.FindOrAdd(CellId);
+			for (TPair<uint8, float>& SlotArea : SlotAreas)
+			{
+				if (SlotArea.Key == Slot)
+				{
+					SlotArea.Value += Area;
+					return;
+				}
+			}
+			SlotAreas.Emplace(Slot, Area);
+		});
+	}
+
+	const int32 TotalCells = OutLayout.GetTotalCellCount();
+	OutLayout.CellMaterialSlots.SetNumZeroed(TotalCells);
+	TBitArray<> Assigned(false, TotalCells);
+	TArray<int32> Frontier;
+	Frontier.Reserve(CellSlotAreas.Num());
+
+	// Surface cells: slot with the most area
+	for (const auto& Pair : CellSlotAreas)
+	{
+		const TPair<uint8, float>* Best = nullptr;
+		for (const TPair<uint8, float>& SlotArea : Pair.Value)
+		{
+			if (!Best || SlotArea.Value > Best->Value)
+			{
+				Best = &SlotArea;
+			}
+		}
+
+		if (Best)
+		{
+			OutLayout.CellMaterialSlots[Pair.Key] = Best->Key;
+			Assigned[Pair.Key] = true;
+			Frontier.Add(Pair.Key);
+		}
+	}
+
+	// Interior cells: breadth-first from the surface, so each takes its nearest surface slot
+	for (int32 Cursor = 0; Cursor < Frontier.Num(); ++Cursor)
+	{
+		const int32 CellId = Frontier[Cursor];
+		for (int32 NeighborId : OutLayout.GetCellNeighbors(CellId).Values)
+		{
+			if (NeighborId >= 0 && NeighborId < TotalCells && !Assigned[NeighborId] && OutLayout.GetCellExists(NeighborId))
+			{
+				OutLayout.CellMaterialSlots[NeighborId] = OutLayout.CellMaterialSlots[CellId];
+				Assigned[NeighborId] = true;
+				Frontier.Add(NeighborId);
+			}
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("BakeCellMaterialSlots: %d surface cells, %d cells baked"), CellSlotAreas.Num(), Frontier.Num());
+}
+
 void FGridCellBuilder::VoxelizeMesh(
 	const UE::Geometry::FDynamicMesh3& Mesh,
 	FGridCellLayout& OutLayout)
@@ -790,6 +918,107 @@ void FGridCellBuilder::VoxelizeFromArrays(
     UE_LOG(LogTemp, Log, TEXT("VoxelizeFromArrays: Valid cells = %d"), OutLayout.GetValidCellCount());
 }
 
+void FGridCellBuilder::RasterizeTriangleConservative(const FVector& V0, const FVector& V1, const FVector& V2, const FGridCellLayout& Layout, TFunctionRef<void(int32 CellId)> Visit)
+{
+	const FVector& Origin = Layout.GridOrigin;
+	const FVector& CS = Layout.CellSize;
+	const FIntVector& GridSize = Layout.GridSize;
+
+	// Same padding ratio as TriangleIntersectsAABB so no candidate is dropped before the SAT test
+	const FVector Pad = CS * 0.02;
+
+	const FVector TriMin = V0.ComponentMin(V1).ComponentMin(V2);
+	const FVector TriMax = V0.ComponentMax(V1).ComponentMax(V2);
+
+	FIntVector CMin, CMax;
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		CMin[Axis] = FMath::Max(0, FMath::FloorToInt32((TriMin[Axis] - Pad[Axis] - Origin[Axis]) / CS[Axis]));
+		CMax[Axis] = FMath::Min(GridSize[Axis] - 1, FMath::FloorToInt32((TriMax[Axis] + Pad[Axis] - Origin[Axis]) / CS[Axis]));
+		if (CMin[Axis] > CMax[Axis])
+		{
+			return;
+		}
+	}
+
+	auto TestCell = [&](const FIntVector& Coord)
+	{
+		const int32 CellId = Layout.CoordToId(Coord);
+		if (!Layout.GetCellExists(CellId))
+		{
+			return;
+		}
+
+		const FVector CellMin(Origin.X + Coord.X * CS.X, Origin.Y + Coord.Y * CS.Y, Origin.Z + Coord.Z * CS.Z);
+		if (TriangleIntersectsAABB(V0, V1, V2, CellMin, CellMin + CS))
+		{
+			Visit(CellId);
+		}
+	};
+
+	const FVector Normal = FVector::CrossProduct(V1 - V0, V2 - V0);
+	const FVector AbsNormal = Normal.GetAbs();
+
+	// Degenerate triangle: fall back to the AABB walk
+	if (AbsNormal.GetMax() <= UE_SMALL_NUMBER)
+	{
+		for (int32 Z = CMin.Z; Z <= CMax.Z; ++Z)
+		{
+			for (int32 Y = CMin.Y; Y <= CMax.Y; ++Y)
+			{
+				for (int32 X = CMin.X; X <= CMax.X; ++X)
+				{
+					TestCell(FIntVector(X, Y, Z));
+				}
+			}
+		}
+		return;
+	}
+
+	// Dominant axis D, column axes U and W
+	const int32 D = (AbsNormal.X >= AbsNormal.Y && AbsNormal.X >= AbsNormal.Z) ? 0 : (AbsNormal.Y >= AbsNormal.Z ? 1 : 2);
+	const int32 U = (D + 1) % 3;
+	const int32 W = (D + 2) % 3;
+	const double PlaneD = FVector::DotProduct(Normal, V0);
+
+	for (int32 CW = CMin[W]; CW <= CMax[W]; ++CW)
+	{
+		const double W0 = FMath::Max(TriMin[W], Origin[W] + CW * CS[W]) - Pad[W];
+		const double W1 = FMath::Min(TriMax[W], Origin[W] + (CW + 1) * CS[W]) + Pad[W];
+
+		for (int32 CU = CMin[U]; CU <= CMax[U]; ++CU)
+		{
+			const double U0 = FMath::Max(TriMin[U], Origin[U] + CU * CS[U]) - Pad[U];
+			const double U1 = FMath::Min(TriMax[U], Origin[U] + (CU + 1) * CS[U]) + Pad[U];
+
+			// Plane height range over the column rectangle (linear, so the corners bound it)
+			auto PlaneAt = [&](double PU, double PW)
+			{
+				return (PlaneD - Normal[U] * PU - Normal[W] * PW) / Normal[D];
+			};
+			const double H00 = PlaneAt(U0, W0);
+			const double H10 = PlaneAt(U1, W0);
+			const double H01 = PlaneAt(U0, W1);
+			const double H11 = PlaneAt(U1, W1);
+
+			const double HMin = FMath::Max(FMath::Min(FMath::Min(H00, H10), FMath::Min(H01, H11)), TriMin[D]) - Pad[D];
+			const double HMax = FMath::Min(FMath::Max(FMath::Max(H00, H10), FMath::Max(H01, H11)), TriMax[D]) + Pad[D];
+
+			const int32 DStart = FMath::Max(CMin[D], FMath::FloorToInt32((HMin - Origin[D]) / CS[D]));
+			const int32 DEnd = FMath::Min(CMax[D], FMath::FloorToInt32((HMax - Origin[D]) / CS[D]));
+
+			FIntVector Coord;
+			Coord[U] = CU;
+			Coord[W] = CW;
+			for (int32 CD = DStart; CD <= DEnd; ++CD)
+			{
+				Coord[D] = CD;
+				TestCell(Coord);
+			}
+		}
+	}
+}
+
 bool FGridCellBuilder::TriangleIntersectsAABB(const FVector& V0, const FVector& V1, const FVector& V2, const FVector& BoxMin, const FVector& BoxMax)
 {
 	// Assume the box is at (0,0,0) to simplify the math
@@ -83,14 +83,45 @@ bool FCellDestructionShape::ContainsPoint(const FVector& Point) const
 	return false;
 }
 
+FBox FCellDestructionShape::GetBounds() const
+{
+	switch (Type)
+	{
+	case ECellDestructionShapeType::Sphere:
+		return FBox::BuildAABB(Center, FVector(Radius));
+
+	case ECellDestructionShapeType::Box:
+		// Bounding sphere of the rotated box
+		return FBox::BuildAABB(Center, FVector(BoxExtent.Size()));
+
+	case ECellDestructionShapeType::Cylinder:
+		return FBox::BuildAABB(Center, FVector(FMath::Sqrt(FMath::Square(Radius) + FMath::Square(BoxExtent.Z))));
+
+	case ECellDestructionShapeType::Line:
+		{
+			FBox Bounds(ForceInit);
+			Bounds += Center;
+			Bounds += EndPoint;
+			return Bounds.ExpandBy(LineThickness);
+		}
+	}
+
+	return FBox::BuildAABB(Center, FVector(Radius));
+}
 
 FCellDestructionShape FCellDestructionShape::CreateFromRequest(const FRealtimeDestructionRequest& Request)
+{
+	return CreateFromToolShape(Request.ToolShape, Request.ShapeParams, Request.ImpactPoint, Request.ToolForwardVector);
+}
+
+FCellDestructionShape FCellDestructionShape::CreateFromToolShape(EDestructionToolShape ToolShape,
+	const FDestructionToolShapeParams& ShapeParams, const FVector& ImpactPoint, const FVector& ToolForwardVector)
 {
 	FCellDestructionShape Shape;
-	Shape.Center = Request.ImpactPoint;
-	Shape.Radius = Request.ShapeParams.Radius;
+	Shape.Center = ImpactPoint;
+	Shape.Radius = ShapeParams.Radius;
 
-	switch (Request.ToolShape)
+	switch (ToolShape)
 	{
 	case EDestructionToolShape::Sphere:
 		Shape.Type = ECellDestructionShapeType::Sphere;
@@ -98,8 +129,8 @@ FCellDestructionShape FCellDestructionShape::CreateFromRequest(const FRealtimeDe
 
 	case EDestructionToolShape::Cylinder:
 		Shape.Type = ECellDestructionShapeType::Line;
-		Shape.EndPoint = Request.ImpactPoint + Request.ToolForwardVector * Request.ShapeParams.Height;
-		Shape.LineThickness = Request.ShapeParams.Radius;
+		Shape.EndPoint = ImpactPoint + ToolForwardVector * ShapeParams.Height;
+		Shape.LineThickness = ShapeParams.Radius;
 		break;
 
 	default:
@@ -652,6 +683,7 @@ void FGridCellLayout::Reset()
 	SparseIndexToCellId.Empty();
 	SparseCellTriangles.Empty();
 	SparseCellNeighbors.Empty();
+	CellMaterialSlots.Empty();
 
 	// Note: Do NOT clear CachedVertices/CachedIndices here
 	// They need to persist for runtime rebuilds
@@ -680,6 +712,32 @@ bool FGridCellLayout::IsValid() const
 	       CellIdToSparseIndex.Num() == ValidCellCount;
 }
 
+SIZE_T FGridCellLayout::GetAllocatedSize() const
+{
+	SIZE_T Size = CellExistsBits.GetAllocatedSize()
+		+ CellIsAnchorBits.GetAllocatedSize()
+		+ CellIdToSparseIndex.GetAllocatedSize()
+		+ SparseIndexToCellId.GetAllocatedSize()
+		+ SparseCellTriangles.GetAllocatedSize()
+		+ SparseCellNeighbors.GetAllocatedSize()
+		+ CachedVertices.GetAllocatedSize()
+		+ CachedIndices.GetAllocatedSize()
+		+ CachedTriangleMaterialSlots.GetAllocatedSize()
+		+ CellMaterialSlots.GetAllocatedSize();
+
+	// Per-cell arrays own their own allocations
+	for (const FIntArray& Triangles : SparseCellTriangles)
+	{
+		Size += Triangles.Values.GetAllocatedSize();
+	}
+	for (const FIntArray& Neighbors : SparseCellNeighbors)
+	{
+		Size += Neighbors.Values.GetAllocatedSize();
+	}
+
+	return Size;
+}
+
 TArray<int32> FGridCellLayout::GetCellsInAABB(const FBox& WorldAABB, const FTransform& MeshTransform) const
 {
 	TArray<int32> Result;
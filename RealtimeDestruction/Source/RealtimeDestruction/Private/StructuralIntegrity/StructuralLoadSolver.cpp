@@ -0,0 +1,644 @@
+// Copyright (c) 2026 LazyDevelopers <lazydeveloper24@gmail.com>. All rights reserved.
+// This plugin is distributed under the Fab Standard License.
+//
+// This product was independently developed by us while participating in the Epic Project, a developer-support
+// program of the KRAFTON JUNGLE GameTech Lab. All rights, title, and interest in and to the product are exclusively
+// vested in us. Krafton, Inc. was not involved in its development and distribution and disclaims all representations
+// and warranties, express or implied, and assumes no responsibility or liability for any consequences arising from
+// the use of this product.
+
+#include "StructuralIntegrity/StructuralLoadSolver.h"
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+	/** Work units between clock checks (one unit = one node visit; measuring a supercell counts as a full interval). */
+	constexpr int32 LoadSolverTimeCheckInterval = 64;
+}
+
+float FStructuralLoadSettings::GetLinkCapacity(int32 Direction) const
+{
+	// A link is vertical when it points along gravity, lateral across it or against it
+	const double Sign = (Direction & 1) ? 1.0 : -1.0;
+	const double Alignment = Sign * AxisGravityAlignment[Direction >> 1];
+	return FMath::Lerp(LateralLinkCapacity, VerticalLinkCapacity, static_cast<float>(FMath::Max(0.0, Alignment)));
+}
+
+void FStructuralLoadSolver::Reset()
+{
+	Phase = EPhase::Idle;
+	bFullSolveRequested = true;
+	NodeCount = FIntVector::ZeroValue;
+	NodeSize = FIntVector::ZeroValue;
+	GridSize = FIntVector::ZeroValue;
+	Nodes.Empty();
+	DirtyNodes.Empty();
+	GatherCursor = 0;
+	Ordered.Empty();
+	BfsCursor = 0;
+	LoadCursor = INDEX_NONE;
+	DistanceBuckets.Empty();
+	TopBucket = INDEX_NONE;
+	OverloadCandidates.Empty();
+}
+
+void FStructuralLoadSolver::InitNodes(const FSuperCellState& Supercells)
+{
+	NodeCount = Supercells.SupercellCount;
+	NodeSize = Supercells.SupercellSize;
+	Nodes.Reset();
+	Nodes.SetNum(Supercells.GetTotalSupercellCount());
+	DirtyNodes.Reset();
+	DistanceBuckets.Reset();
+	TopBucket = INDEX_NONE;
+	OverloadCandidates.Reset();
+	Phase = EPhase::Idle;
+	bFullSolveRequested = true;
+}
+
+void FStructuralLoadSolver::MarkCellsDirty(const FGridCellLayout& Layout, const FSuperCellState& Supercells, TConstArrayView<int32> CellIds)
+{
+	// Nodes not built yet: the first full solve measures everything anyway
+	if (Nodes.Num() == 0 || NodeCount != Supercells.SupercellCount)
+	{
+		return;
+	}
+
+	for (int32 CellId : CellIds)
+	{
+		if (!Layout.IsValidCellId(CellId))
+		{
+			continue;
+		}
+
+		const int32 NodeId = GetNodeId(Supercells.CellCoordToSupercellCoord(Layout.IdToCoord(CellId)));
+		if (Nodes.IsValidIndex(NodeId) && !Nodes[NodeId].bDirty)
+		{
+			Nodes[NodeId].bDirty = true;
+			DirtyNodes.Add(NodeId);
+		}
+	}
+}
+
+bool FStructuralLoadSolver::IsBusy() const
+{
+	return bFullSolveRequested || Phase != EPhase::Idle || DirtyNodes.Num() > 0
+		|| TopBucket != INDEX_NONE || OverloadCandidates.Num() > 0;
+}
+
+float FStructuralLoadSolver::GetCellMass(const FCellState& CellState, int32 CellId)
+{
+	// Partially destroyed cells weigh their alive subcells only
+	if (const FSubCell* SubCell = CellState.SubCellStates.Find(CellId))
+	{
+		return static_cast<float>(FMath::CountBits(SubCell->Bits)) / SUBCELL_COUNT;
+	}
+	return 1.0f;
+}
+
+float FStructuralLoadSolver::GetSupercellLoad(int32 SupercellId) const
+{
+	return Nodes.IsValidIndex(SupercellId) ? Nodes[SupercellId].Load * SolvedSettings.CellMass : 0.0f;
+}
+
+float FStructuralLoadSolver::GetSupercellStressRatio(int32 SupercellId) const
+{
+	return Nodes.IsValidIndex(SupercellId) ? Nodes[SupercellId].StressRatio : 0.0f;
+}
+
+SIZE_T FStructuralLoadSolver::GetAllocatedSize() const
+{
+	SIZE_T Size = Nodes.GetAllocatedSize() + DirtyNodes.GetAllocatedSize() + Ordered.GetAllocatedSize()
+		+ DistanceBuckets.GetAllocatedSize() + OverloadCandidates.GetAllocatedSize();
+	for (const TArray<int32>& Bucket : DistanceBuckets)
+	{
+		Size += Bucket.GetAllocatedSize();
+	}
+	return Size;
+}
+
+int32 FStructuralLoadSolver::GetNeighborNode(int32 NodeId, int32 Direction) const
+{
+	FIntVector Coord = GetNodeCoord(NodeId);
+	const int32 Axis = Direction >> 1;
+	Coord[Axis] += (Direction & 1) ? 1 : -1;
+	if (Coord[Axis] < 0 || Coord[Axis] >= NodeCount[Axis])
+	{
+		return INDEX_NONE;
+	}
+	return GetNodeId(Coord);
+}
+
+uint16 FStructuralLoadSolver::GetLinkCount(int32 NodeId, int32 Direction) const
+{
+	const int32 Axis = Direction >> 1;
+	if (Direction & 1)
+	{
+		return Nodes[NodeId].FaceLinks[Axis];
+	}
+
+	const int32 NeighborId = GetNeighborNode(NodeId, Direction);
+	return NeighborId != INDEX_NONE ? Nodes[NeighborId].FaceLinks[Axis] : 0;
+}
+
+uint16 FStructuralLoadSolver::CountFaceLinks(const FIntVector& NodeCoord, int32 Axis, const FGridCellLayout& Layout, const FCellState& CellState) const
+{
+	// Last cell layer of this supercell along Axis and the first layer of the next one
+	const int32 Layer = NodeCoord[Axis] * NodeSize[Axis] + NodeSize[Axis] - 1;
+	if (Layer + 1 >= GridSize[Axis])
+	{
+		return 0;
+	}
+
+	const int32 AxisU = (Axis + 1) % 3;
+	const int32 AxisV = (Axis + 2) % 3;
+	const int32 StartU = NodeCoord[AxisU] * NodeSize[AxisU];
+	const int32 StartV = NodeCoord[AxisV] * NodeSize[AxisV];
+	const int32 EndU = FMath::Min(StartU + NodeSize[AxisU], GridSize[AxisU]);
+	const int32 EndV = FMath::Min(StartV + NodeSize[AxisV], GridSize[AxisV]);
+
+	uint16 Links = 0;
+	FIntVector Coord;
+	for (int32 V = StartV; V < EndV; ++V)
+	{
+		for (int32 U = StartU; U < EndU; ++U)
+		{
+			Coord[Axis] = Layer;
+			Coord[AxisU] = U;
+			Coord[AxisV] = V;
+			if (!IsCellAlive(Layout, CellState, Layout.CoordToId(Coord)))
+			{
+				continue;
+			}
+
+			Coord[Axis] = Layer + 1;
+			if (IsCellAlive(Layout, CellState, Layout.CoordToId(Coord)))
+			{
+				++Links;
+			}
+		}
+	}
+	return Links;
+}
+
+FStructuralLoadSolver::FNodeMeasure FStructuralLoadSolver::MeasureNode(int32 NodeId, const FGridCellLayout& Layout, const FCellState& CellState) const
+{
+	FNodeMeasure Measure;
+
+	const FIntVector NodeCoord = GetNodeCoord(NodeId);
+	const FIntVector Start(NodeCoord.X * NodeSize.X, NodeCoord.Y * NodeSize.Y, NodeCoord.Z * NodeSize.Z);
+	const FIntVector End(
+		FMath::Min(Start.X + NodeSize.X, GridSize.X),
+		FMath::Min(Start.Y + NodeSize.Y, GridSize.Y),
+		FMath::Min(Start.Z + NodeSize.Z, GridSize.Z));
+
+	for (int32 Z = Start.Z; Z < End.Z; ++Z)
+	{
+		for (int32 Y = Start.Y; Y < End.Y; ++Y)
+		{
+			for (int32 X = Start.X; X < End.X; ++X)
+			{
+				const int32 CellId = Layout.CoordToId(X, Y, Z);
+				if (!IsCellAlive(Layout, CellState, CellId))
+				{
+					continue;
+				}
+
+				Measure.Mass += GetCellMass(CellState, CellId);
+				if (Layout.GetCellIsAnchor(CellId))
+				{
+					++Measure.AnchorCount;
+				}
+			}
+		}
+	}
+
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		Measure.FaceLinks[Axis] = CountFaceLinks(NodeCoord, Axis, Layout, CellState);
+		if (NodeCoord[Axis] > 0)
+		{
+			FIntVector PrevCoord = NodeCoord;
+			PrevCoord[Axis] -= 1;
+			Measure.NegativeFaceLinks[Axis] = CountFaceLinks(PrevCoord, Axis, Layout, CellState);
+		}
+	}
+
+	return Measure;
+}
+
+void FStructuralLoadSolver::GetSupportLinks(int32 NodeId, uint16 (&OutLinks)[6]) const
+{
+	const int32 SupportDistance = Nodes[NodeId].Distance - 1;
+	for (int32 Direction = 0; Direction < 6; ++Direction)
+	{
+		const int32 NeighborId = GetNeighborNode(NodeId, Direction);
+		OutLinks[Direction] = (NeighborId != INDEX_NONE && Nodes[NeighborId].Distance == SupportDistance && Nodes[NeighborId].Mass > 0.0f)
+			? GetLinkCount(NodeId, Direction)
+			: 0;
+	}
+}
+
+float FStructuralLoadSolver::ComputeSplit(float InLoad, const uint16 (&Links)[6], float (&OutShares)[6]) const
+{
+	// Split by capacity, so every supporting link ends up at the same stress ratio
+	float TotalCapacity = 0.0f;
+	for (int32 Direction = 0; Direction < 6; ++Direction)
+	{
+		TotalCapacity += Links[Direction] * LinkCapacity[Direction];
+	}
+
+	for (int32 Direction = 0; Direction < 6; ++Direction)
+	{
+		OutShares[Direction] = TotalCapacity > 0.0f ? InLoad * (Links[Direction] * LinkCapacity[Direction] / TotalCapacity) : 0.0f;
+	}
+	return TotalCapacity;
+}
+
+void FStructuralLoadSolver::QueueNode(int32 NodeId)
+{
+	FLoadNode& Node = Nodes[NodeId];
+	if (Node.bQueued || Node.Distance == INDEX_NONE)
+	{
+		return;
+	}
+
+	if (!DistanceBuckets.IsValidIndex(Node.Distance))
+	{
+		DistanceBuckets.SetNum(Node.Distance + 1);
+	}
+	DistanceBuckets[Node.Distance].Add(NodeId);
+	Node.bQueued = true;
+	TopBucket = FMath::Max(TopBucket, Node.Distance);
+}
+
+bool FStructuralLoadSolver::RefreshNode(int32 NodeId, const FGridCellLayout& Layout, const FCellState& CellState)
+{
+	const FNodeMeasure Measure = MeasureNode(NodeId, Layout, CellState);
+	FLoadNode& Node = Nodes[NodeId];
+
+	// Graph shape changed (supercell emptied, anchoring changed, a face lost its last link): distances are stale
+	if ((Measure.Mass > 0.0f) != (Node.Mass > 0.0f) || (Measure.AnchorCount > 0) != (Node.AnchorCount > 0))
+	{
+		return false;
+	}
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		if ((Measure.FaceLinks[Axis] > 0) != (Node.FaceLinks[Axis] > 0))
+		{
+			return false;
+		}
+		const int32 PrevId = GetNeighborNode(NodeId, Axis * 2);
+		if (PrevId != INDEX_NONE && (Measure.NegativeFaceLinks[Axis] > 0) != (Nodes[PrevId].FaceLinks[Axis] > 0))
+		{
+			return false;
+		}
+	}
+
+	// Same shape: only capacities and masses moved. A changed link re-splits the supported side of it.
+	auto OnLinkChanged = [this](int32 NodeA, int32 NodeB)
+	{
+		const int32 DistanceA = Nodes[NodeA].Distance;
+		const int32 DistanceB = Nodes[NodeB].Distance;
+		if (DistanceA == INDEX_NONE || DistanceB == INDEX_NONE)
+		{
+			return;
+		}
+		if (DistanceA == DistanceB + 1)
+		{
+			QueueNode(NodeA);
+		}
+		else if (DistanceB == DistanceA + 1)
+		{
+			QueueNode(NodeB);
+		}
+	};
+
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		if (Measure.FaceLinks[Axis] != Node.FaceLinks[Axis])
+		{
+			Node.FaceLinks[Axis] = Measure.FaceLinks[Axis];
+			OnLinkChanged(NodeId, GetNeighborNode(NodeId, Axis * 2 + 1));
+		}
+
+		const int32 PrevId = GetNeighborNode(NodeId, Axis * 2);
+		if (PrevId != INDEX_NONE && Measure.NegativeFaceLinks[Axis] != Nodes[PrevId].FaceLinks[Axis])
+		{
+			Nodes[PrevId].FaceLinks[Axis] = Measure.NegativeFaceLinks[Axis];
+			OnLinkChanged(NodeId, PrevId);
+		}
+	}
+
+	const float MassDelta = Measure.Mass - Node.Mass;
+	Node.Mass = Measure.Mass;
+	Node.AnchorCount = Measure.AnchorCount;
+	if (MassDelta != 0.0f && Node.Distance != INDEX_NONE)
+	{
+		Node.PendingLoad += MassDelta;
+		QueueNode(NodeId);
+	}
+
+	return true;
+}
+
+void FStructuralLoadSolver::PropagateNode(int32 NodeId)
+{
+	FLoadNode& Node = Nodes[NodeId];
+	const float OldLoad = Node.Load;
+	Node.Load += Node.PendingLoad;
+	Node.PendingLoad = 0.0f;
+
+	// Anchored supercells hand their load to the ground
+	if (Node.Distance <= 0)
+	{
+		return;
+	}
+
+	// Loads are linear: push only the difference between the old and the new split
+	uint16 NewLinks[6];
+	GetSupportLinks(NodeId, NewLinks);
+
+	float OldShares[6];
+	float NewShares[6];
+	ComputeSplit(OldLoad, Node.SplitLinks, OldShares);
+	const float Capacity = ComputeSplit(Node.Load, NewLinks, NewShares);
+	FMemory::Memcpy(Node.SplitLinks, NewLinks, sizeof(NewLinks));
+
+	Node.StressRatio = Capacity > 0.0f ? Node.Load * SolvedSettings.CellMass / Capacity : 0.0f;
+	if (Node.StressRatio > 1.0f)
+	{
+		OverloadCandidates.Add(NodeId);
+	}
+
+	for (int32 Direction = 0; Direction < 6; ++Direction)
+	{
+		const float Delta = NewShares[Direction] - OldShares[Direction];
+		if (Delta != 0.0f)
+		{
+			const int32 SupporterId = GetNeighborNode(NodeId, Direction);
+			Nodes[SupporterId].PendingLoad += Delta;
+			QueueNode(SupporterId);
+		}
+	}
+}
+
+bool FStructuralLoadSolver::CollectFailure(FStructuralLoadFailure& OutFailure)
+{
+	int32 WorstNodeId = INDEX_NONE;
+	float WorstRatio = 1.0f;
+	for (int32 NodeId : OverloadCandidates)
+	{
+		// Candidates may have been relieved since they were recorded
+		const FLoadNode& Node = Nodes[NodeId];
+		if (Node.Mass > 0.0f && Node.Distance > 0 && Node.StressRatio > WorstRatio)
+		{
+			WorstRatio = Node.StressRatio;
+			WorstNodeId = NodeId;
+		}
+	}
+	OverloadCandidates.Reset();
+
+	if (WorstNodeId == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutFailure.SupercellId = WorstNodeId;
+	OutFailure.StressRatio = WorstRatio;
+	OutFailure.SupportDirectionMask = 0;
+	for (int32 Direction = 0; Direction < 6; ++Direction)
+	{
+		if (Nodes[WorstNodeId].SplitLinks[Direction] > 0)
+		{
+			OutFailure.SupportDirectionMask |= static_cast<uint8>(1 << Direction);
+		}
+	}
+	return true;
+}
+
+void FStructuralLoadSolver::BeginFullSolve(const FStructuralLoadSettings& Settings)
+{
+	Phase = EPhase::Gather;
+	bFullSolveRequested = false;
+	SolvedSettings = Settings;
+	for (int32 Direction = 0; Direction < 6; ++Direction)
+	{
+		LinkCapacity[Direction] = Settings.GetLinkCapacity(Direction);
+	}
+
+	// Gather measures every supercell, so earlier dirty marks are covered
+	for (int32 NodeId : DirtyNodes)
+	{
+		Nodes[NodeId].bDirty = false;
+	}
+	DirtyNodes.Reset();
+	for (TArray<int32>& Bucket : DistanceBuckets)
+	{
+		Bucket.Reset();
+	}
+	TopBucket = INDEX_NONE;
+	OverloadCandidates.Reset();
+
+	GatherCursor = 0;
+	Ordered.Reset();
+	BfsCursor = 0;
+	LoadCursor = INDEX_NONE;
+}
+
+bool FStructuralLoadSolver::Step(
+	const FGridCellLayout& Layout,
+	const FCellState& CellState,
+	const FSuperCellState& Supercells,
+	const FStructuralLoadSettings& Settings,
+	double BudgetSeconds,
+	FStructuralLoadFailure& OutFailure)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(LoadSolver_Step);
+
+	OutFailure = FStructuralLoadFailure();
+
+	if (!Layout.IsValid() || !Supercells.IsValid())
+	{
+		return false;
+	}
+
+	if (Nodes.Num() != Supercells.GetTotalSupercellCount() || NodeCount != Supercells.SupercellCount)
+	{
+		InitNodes(Supercells);
+	}
+	GridSize = Layout.GridSize;
+
+	const double EndTime = FPlatformTime::Seconds() + BudgetSeconds;
+	int32 Work = 0;
+
+	auto IsOutOfBudget = [&Work, EndTime](int32 Cost)
+	{
+		Work += Cost;
+		if (Work < LoadSolverTimeCheckInterval)
+		{
+			return false;
+		}
+		Work = 0;
+		return FPlatformTime::Seconds() >= EndTime;
+	};
+
+	for (;;)
+	{
+		if (Phase == EPhase::Idle && (bFullSolveRequested || !(Settings == SolvedSettings)))
+		{
+			BeginFullSolve(Settings);
+		}
+
+		switch (Phase)
+		{
+		//=====================================================================
+		// Full solve 1: measure every supercell, seed the anchored ones
+		//=====================================================================
+		case EPhase::Gather:
+			while (GatherCursor < Nodes.Num())
+			{
+				const int32 NodeId = GatherCursor++;
+				const FNodeMeasure Measure = MeasureNode(NodeId, Layout, CellState);
+
+				FLoadNode& Node = Nodes[NodeId];
+				Node.Mass = Measure.Mass;
+				Node.AnchorCount = Measure.AnchorCount;
+				FMemory::Memcpy(Node.FaceLinks, Measure.FaceLinks, sizeof(Node.FaceLinks));
+				FMemory::Memzero(Node.SplitLinks, sizeof(Node.SplitLinks));
+				Node.Distance = INDEX_NONE;
+				Node.Load = 0.0f;
+				Node.PendingLoad = 0.0f;
+				Node.StressRatio = 0.0f;
+				Node.bQueued = false;
+
+				if (Node.Mass > 0.0f && Node.AnchorCount > 0)
+				{
+					Node.Distance = 0;
+					Ordered.Add(NodeId);
+				}
+
+				if (IsOutOfBudget(LoadSolverTimeCheckInterval))
+				{
+					return false;
+				}
+			}
+			Phase = EPhase::Distance;
+			break;
+
+		//=====================================================================
+		// Full solve 2: hop distance to the nearest anchored supercell
+		//=====================================================================
+		case EPhase::Distance:
+			while (BfsCursor < Ordered.Num())
+			{
+				const int32 NodeId = Ordered[BfsCursor++];
+				const int32 NextDistance = Nodes[NodeId].Distance + 1;
+
+				for (int32 Direction = 0; Direction < 6; ++Direction)
+				{
+					const int32 NeighborId = GetNeighborNode(NodeId, Direction);
+					if (NeighborId != INDEX_NONE && Nodes[NeighborId].Distance == INDEX_NONE
+						&& Nodes[NeighborId].Mass > 0.0f && GetLinkCount(NodeId, Direction) > 0)
+					{
+						Nodes[NeighborId].Distance = NextDistance;
+						Ordered.Add(NeighborId);
+					}
+				}
+
+				if (IsOutOfBudget(1))
+				{
+					return false;
+				}
+			}
+			Phase = EPhase::Load;
+			LoadCursor = Ordered.Num() - 1;
+			break;
+
+		//=====================================================================
+		// Full solve 3: push load from the farthest supercells toward anchors
+		//=====================================================================
+		case EPhase::Load:
+			while (LoadCursor >= 0)
+			{
+				const int32 NodeId = Ordered[LoadCursor--];
+				FLoadNode& Node = Nodes[NodeId];
+				Node.Load += Node.Mass;
+
+				if (Node.Distance > 0)
+				{
+					float Shares[6];
+					GetSupportLinks(NodeId, Node.SplitLinks);
+					const float Capacity = ComputeSplit(Node.Load, Node.SplitLinks, Shares);
+
+					Node.StressRatio = Capacity > 0.0f ? Node.Load * SolvedSettings.CellMass / Capacity : 0.0f;
+					if (Node.StressRatio > 1.0f)
+					{
+						OverloadCandidates.Add(NodeId);
+					}
+
+					for (int32 Direction = 0; Direction < 6; ++Direction)
+					{
+						if (Shares[Direction] > 0.0f)
+						{
+							Nodes[GetNeighborNode(NodeId, Direction)].Load += Shares[Direction];
+						}
+					}
+				}
+
+				if (IsOutOfBudget(1))
+				{
+					return false;
+				}
+			}
+
+			if (Ordered.Num() > 0)
+			{
+				DistanceBuckets.SetNum(Nodes[Ordered.Last()].Distance + 1);
+			}
+			Phase = EPhase::Idle;
+			break;
+
+		//=====================================================================
+		// Incremental: re-measure dirty supercells, push load differences
+		//=====================================================================
+		case EPhase::Idle:
+			if (DirtyNodes.Num() > 0)
+			{
+				const int32 NodeId = DirtyNodes.Pop(EAllowShrinking::No);
+				Nodes[NodeId].bDirty = false;
+				if (!RefreshNode(NodeId, Layout, CellState))
+				{
+					bFullSolveRequested = true;
+				}
+
+				if (IsOutOfBudget(LoadSolverTimeCheckInterval))
+				{
+					return false;
+				}
+				break;
+			}
+
+			while (TopBucket >= 0 && DistanceBuckets[TopBucket].Num() == 0)
+			{
+				--TopBucket;
+			}
+			if (TopBucket >= 0)
+			{
+				const int32 NodeId = DistanceBuckets[TopBucket].Pop(EAllowShrinking::No);
+				Nodes[NodeId].bQueued = false;
+				PropagateNode(NodeId);
+
+				if (IsOutOfBudget(1))
+				{
+					return false;
+				}
+				break;
+			}
+			TopBucket = INDEX_NONE;
+
+			// Everything drained: the solution matches the current cell state
+			return CollectFailure(OutFailure);
+		}
+	}
+}
@@ -118,7 +118,7 @@ bool FSubCellProcessor::ProcessSubCellDestruction(
 			// If all subcells are destroyed, mark the cell itself as destroyed
 			if (SubCellState.IsFullyDestroyed())
 			{
-				InOutCellState.DestroyedCells.Add(CellId);
+				InOutCellState.DestroyCell(CellId);
 				InOutCellState.SubCellStates.Remove(CellId);
 #if SUBCELL_DEBUG_LOG
 				UE_LOG(LogSubCellDebug, Log, TEXT("  -> CellId=%d FULLY DESTROYED"), CellId);
@@ -0,0 +1,561 @@
+// Copyright (c) 2026 LazyDevelopers <lazydeveloper24@gmail.com>. All rights reserved.
+// This plugin is distributed under the Fab Standard License.
+//
+// This product was independently developed by us while participating in the Epic Project, a developer-support
+// program of the KRAFTON JUNGLE GameTech Lab. All rights, title, and interest in and to the product are exclusively
+// vested in us. Krafton, Inc. was not involved in its development and distribution and disclaims all representations
+// and warranties, express or implied, and assumes no responsibility or liability for any consequences arising from
+// the use of this product.
+
+#include "Subsystems/DebrisManagerSubsystem.h"
+
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "Materials/MaterialInterface.h"
+#include "Components/PrimitiveComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Actors/DebrisActor.h"
+#include "Settings/RDMSetting.h"
+
+namespace
+{
+	/** Budget pass interval (s); bursts over the count cap are also trimmed on the next tick */
+	constexpr float DebrisBudgetInterval = 0.1f;
+
+	/** Pieces slower than this (cm/s) are baked into rubble instead of removed when over budget */
+	constexpr float DebrisDowngradeMaxSpeed = 50.0f;
+
+	/** Open rubble mesh size at which it is sealed and a new one starts (bounds the per-flush rebuild) */
+	constexpr int32 RubbleMeshSealTriangles = 16384;
+}
+
+void UDebrisManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (const URDMSetting* Settings = URDMSetting::Get())
+	{
+		bConsolidationEnabled = Settings->bConsolidateSettledDebris;
+		AreaSize = FMath::Max(Settings->RubbleAreaSize, 100.0f);
+		MaxTrianglesPerArea = FMath::Max(Settings->MaxRubbleTrianglesPerArea, 0);
+		MergeInterval = FMath::Max(Settings->RubbleMergeInterval, 0.0f);
+
+		bBudgetEnabled = Settings->bEnableDebrisBudget;
+		MaxDebrisCount = FMath::Max(Settings->MaxDebrisCount, 0);
+		MaxDebrisTriangles = FMath::Max(Settings->MaxDebrisTriangles, 0);
+		MaxDebrisBodies = FMath::Max(Settings->MaxDebrisBodies, 0);
+		ImportanceHalfDistance = FMath::Max(Settings->DebrisImportanceHalfDistance, 1.0f);
+		ImportanceHalfAge = FMath::Max(Settings->DebrisImportanceHalfAge, 0.1f);
+	}
+}
+
+void UDebrisManagerSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(FlushTimerHandle);
+		World->GetTimerManager().ClearTimer(BudgetTimerHandle);
+	}
+
+	// Rubble/Debris Actor는 월드와 함께 정리되므로 참조만 해제
+	RubbleAreas.Empty();
+	DirtyAreas.Empty();
+	TrackedDebris.Empty();
+
+	Super::Deinitialize();
+}
+
+UDebrisManagerSubsystem::FRubbleArea* UDebrisManagerSubsystem::FindOrAddArea(const FVector& WorldLocation, FIntVector& OutAreaKey)
+{
+	OutAreaKey = FIntVector(
+		FMath::FloorToInt(WorldLocation.X / AreaSize),
+		FMath::FloorToInt(WorldLocation.Y / AreaSize),
+		FMath::FloorToInt(WorldLocation.Z / AreaSize));
+
+	if (FRubbleArea* Existing = RubbleAreas.Find(OutAreaKey))
+	{
+		if (Existing->Mesh.IsValid())
+		{
+			return Existing;
+		}
+
+		// 외부에서 Rubble Actor가 삭제된 경우 새로 생성
+		RubbleAreas.Remove(OutAreaKey);
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	// Area 중심 = 메시 원점 (버텍스는 Area 로컬 좌표로 저장)
+	const FVector AreaCenter = (FVector(OutAreaKey) + FVector(0.5f)) * AreaSize;
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParams.ObjectFlags |= RF_Transient;
+
+	// 복제하지 않는 로컬 전용 Actor
+	AActor* RubbleActor = World->SpawnActor<AActor>(AActor::StaticClass(), AreaCenter, FRotator::ZeroRotator, SpawnParams);
+	if (!RubbleActor)
+	{
+		return nullptr;
+	}
+
+	UProceduralMeshComponent* RubbleMesh = CreateRubbleMesh(RubbleActor, AreaCenter);
+
+	FRubbleArea& NewArea = RubbleAreas.Add(OutAreaKey);
+	NewArea.Mesh = RubbleMesh;
+	return &NewArea;
+}
+
+UProceduralMeshComponent* UDebrisManagerSubsystem::CreateRubbleMesh(AActor* RubbleActor, const FVector& AreaCenter)
+{
+	UProceduralMeshComponent* RubbleMesh = NewObject<UProceduralMeshComponent>(RubbleActor,
+		UProceduralMeshComponent::StaticClass(),
+		MakeUniqueObjectName(RubbleActor, UProceduralMeshComponent::StaticClass(), TEXT("RubbleMesh")));
+	RubbleMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	RubbleMesh->SetCanEverAffectNavigation(false);
+	RubbleMesh->SetMobility(EComponentMobility::Static);
+
+	// 첫 메시가 Root, 이후(봉인 후 새로 연) 메시는 Root와 같은 위치에 붙임
+	if (USceneComponent* Root = RubbleActor->GetRootComponent())
+	{
+		RubbleMesh->SetupAttachment(Root);
+	}
+	else
+	{
+		RubbleMesh->SetWorldLocation(AreaCenter);
+		RubbleActor->SetRootComponent(RubbleMesh);
+	}
+	RubbleMesh->RegisterComponent();
+	RubbleActor->AddInstanceComponent(RubbleMesh);
+	return RubbleMesh;
+}
+
+bool UDebrisManagerSubsystem::ConsolidateDebris(UProceduralMeshComponent* DebrisMesh)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(DebrisManager_ConsolidateDebris);
+
+	if (!bConsolidationEnabled || !DebrisMesh || GetWorld()->GetNetMode() == NM_DedicatedServer)
+	{
+		return false;
+	}
+
+	const int32 NumSections = DebrisMesh->GetNumSections();
+	int32 NumTriangles = 0;
+	for (int32 SectionIndex = 0; SectionIndex < NumSections; ++SectionIndex)
+	{
+		if (const FProcMeshSection* Section = DebrisMesh->GetProcMeshSection(SectionIndex))
+		{
+			NumTriangles += Section->ProcIndexBuffer.Num() / 3;
+		}
+	}
+
+	if (NumTriangles == 0)
+	{
+		return false;
+	}
+
+	const FTransform DebrisTransform = DebrisMesh->GetComponentTransform();
+
+	FIntVector AreaKey;
+	FRubbleArea* Area = FindOrAddArea(DebrisMesh->Bounds.Origin, AreaKey);
+	if (!Area || Area->NumTriangles + NumTriangles > MaxTrianglesPerArea)
+	{
+		return false;
+	}
+
+	UProceduralMeshComponent* RubbleMesh = Area->Mesh.Get();
+	const FVector AreaCenter = RubbleMesh->GetComponentLocation();
+
+	// 비균등 스케일에서도 노말이 면에 수직이도록 역전치 행렬 사용
+	const FMatrix NormalMatrix = DebrisTransform.ToMatrixWithScale().Inverse().GetTransposed();
+	const bool bFlipWinding = DebrisTransform.GetDeterminant() < 0.0f;
+
+	for (int32 SectionIndex = 0; SectionIndex < NumSections; ++SectionIndex)
+	{
+		const FProcMeshSection* Source = DebrisMesh->GetProcMeshSection(SectionIndex);
+		if (!Source || Source->ProcIndexBuffer.Num() == 0)
+		{
+			continue;
+		}
+
+		// 머티리얼별로 하나의 섹션에 누적
+		const TWeakObjectPtr<UMaterialInterface> Material = DebrisMesh->GetMaterial(SectionIndex);
+		int32* RubbleSectionIndex = Area->SectionByMaterial.Find(Material);
+		if (!RubbleSectionIndex)
+		{
+			RubbleSectionIndex = &Area->SectionByMaterial.Add(Material, Area->SectionByMaterial.Num());
+		}
+
+		FProcMeshSection& Pending = Area->PendingSections.FindOrAdd(*RubbleSectionIndex);
+		const uint32 BaseVertex = Pending.ProcVertexBuffer.Num();
+
+		Pending.ProcVertexBuffer.Reserve(BaseVertex + Source->ProcVertexBuffer.Num());
+		for (const FProcMeshVertex& SourceVertex : Source->ProcVertexBuffer)
+		{
+			FProcMeshVertex& Vertex = Pending.ProcVertexBuffer.Add_GetRef(SourceVertex);
+			Vertex.Position = DebrisTransform.TransformPosition(SourceVertex.Position) - AreaCenter;
+			Vertex.Normal = NormalMatrix.TransformVector(SourceVertex.Normal).GetSafeNormal();
+			Vertex.Tangent.TangentX = DebrisTransform.TransformVectorNoScale(SourceVertex.Tangent.TangentX);
+			Pending.SectionLocalBox += Vertex.Position;
+		}
+
+		Pending.ProcIndexBuffer.Reserve(Pending.ProcIndexBuffer.Num() + Source->ProcIndexBuffer.Num());
+		for (int32 Index = 0; Index + 2 < Source->ProcIndexBuffer.Num(); Index += 3)
+		{
+			Pending.ProcIndexBuffer.Add(BaseVertex + Source->ProcIndexBuffer[Index]);
+			Pending.ProcIndexBuffer.Add(BaseVertex + Source->ProcIndexBuffer[bFlipWinding ? Index + 2 : Index + 1]);
+			Pending.ProcIndexBuffer.Add(BaseVertex + Source->ProcIndexBuffer[bFlipWinding ? Index + 1 : Index + 2]);
+		}
+	}
+
+	Area->NumTriangles += NumTriangles;
+	DirtyAreas.Add(AreaKey);
+
+	// 섹션 재생성은 비싸므로 모아서 한 번에 병합
+	FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+	if (!TimerManager.IsTimerActive(FlushTimerHandle))
+	{
+		if (MergeInterval > 0.0f)
+		{
+			TimerManager.SetTimer(FlushTimerHandle, this, &UDebrisManagerSubsystem::FlushPendingRubble, MergeInterval, false);
+		}
+		else
+		{
+			FlushTimerHandle = TimerManager.SetTimerForNextTick(this, &UDebrisManagerSubsystem::FlushPendingRubble);
+		}
+	}
+
+	return true;
+}
+
+void UDebrisManagerSubsystem::FlushPendingRubble()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(DebrisManager_FlushPendingRubble);
+
+	for (const FIntVector& AreaKey : DirtyAreas)
+	{
+		FRubbleArea* Area = RubbleAreas.Find(AreaKey);
+		if (!Area)
+		{
+			continue;
+		}
+
+		UProceduralMeshComponent* RubbleMesh = Area->Mesh.Get();
+		if (!RubbleMesh)
+		{
+			RubbleAreas.Remove(AreaKey);
+			continue;
+		}
+
+		for (TPair<int32, FProcMeshSection>& Pair : Area->PendingSections)
+		{
+			const int32 SectionIndex = Pair.Key;
+			FProcMeshSection& Pending = Pair.Value;
+			Area->OpenMeshTriangles += Pending.ProcIndexBuffer.Num() / 3;
+
+			FProcMeshSection* Existing = RubbleMesh->GetProcMeshSection(SectionIndex);
+			if (!Existing || Existing->ProcIndexBuffer.Num() == 0)
+			{
+				Pending.bEnableCollision = false;
+				Pending.bSectionVisible = true;
+				RubbleMesh->SetProcMeshSection(SectionIndex, Pending);
+				continue;
+			}
+
+			// 기존 섹션 뒤에 제자리에서 이어붙임 (섹션 전체를 복사하지 않음)
+			const uint32 BaseVertex = Existing->ProcVertexBuffer.Num();
+			Existing->ProcVertexBuffer.Append(MoveTemp(Pending.ProcVertexBuffer));
+			Existing->ProcIndexBuffer.Reserve(Existing->ProcIndexBuffer.Num() + Pending.ProcIndexBuffer.Num());
+			for (uint32 Index : Pending.ProcIndexBuffer)
+			{
+				Existing->ProcIndexBuffer.Add(BaseVertex + Index);
+			}
+			Existing->SectionLocalBox += Pending.SectionLocalBox;
+
+			// 자기 자신을 대입하므로 복사 없이 바운드/렌더 상태만 갱신됨
+			RubbleMesh->SetProcMeshSection(SectionIndex, *Existing);
+		}
+		Area->PendingSections.Empty();
+
+		for (const TPair<TWeakObjectPtr<UMaterialInterface>, int32>& Pair : Area->SectionByMaterial)
+		{
+			UMaterialInterface* Material = Pair.Key.Get();
+			if (RubbleMesh->GetMaterial(Pair.Value) != Material)
+			{
+				RubbleMesh->SetMaterial(Pair.Value, Material);
+			}
+		}
+
+		// 열린 메시가 커지면 봉인하고 새 메시를 연다 (이후 Flush는 작은 메시만 재생성)
+		if (Area->OpenMeshTriangles >= RubbleMeshSealTriangles)
+		{
+			if (AActor* RubbleActor = RubbleMesh->GetOwner())
+			{
+				Area->Mesh = CreateRubbleMesh(RubbleActor, RubbleMesh->GetComponentLocation());
+				Area->SectionByMaterial.Reset();
+				Area->OpenMeshTriangles = 0;
+			}
+		}
+	}
+
+	DirtyAreas.Empty();
+}
+
+void UDebrisManagerSubsystem::ClearRubble()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(FlushTimerHandle);
+	}
+
+	for (const TPair<FIntVector, FRubbleArea>& Pair : RubbleAreas)
+	{
+		if (UProceduralMeshComponent* RubbleMesh = Pair.Value.Mesh.Get())
+		{
+			if (AActor* RubbleActor = RubbleMesh->GetOwner())
+			{
+				RubbleActor->Destroy();
+			}
+		}
+	}
+
+	RubbleAreas.Empty();
+	DirtyAreas.Empty();
+}
+
+int32 UDebrisManagerSubsystem::GetRubbleTriangleCount() const
+{
+	int32 Total = 0;
+	for (const TPair<FIntVector, FRubbleArea>& Pair : RubbleAreas)
+	{
+		Total += Pair.Value.NumTriangles;
+	}
+	return Total;
+}
+
+void UDebrisManagerSubsystem::RegisterDebris(AActor* DebrisActor, UPrimitiveComponent* Body, UProceduralMeshComponent* Mesh)
+{
+	UWorld* World = GetWorld();
+	if (!bBudgetEnabled || !DebrisActor || !World)
+	{
+		return;
+	}
+
+	FTrackedDebris& Debris = TrackedDebris.AddDefaulted_GetRef();
+	Debris.Actor = DebrisActor;
+	Debris.Body = Body;
+	Debris.Mesh = Mesh;
+	Debris.SpawnTime = World->GetTimeSeconds();
+
+	FTimerManager& TimerManager = World->GetTimerManager();
+	if (!TimerManager.IsTimerActive(BudgetTimerHandle))
+	{
+		TimerManager.SetTimer(BudgetTimerHandle, this, &UDebrisManagerSubsystem::EnforceDebrisBudget, DebrisBudgetInterval, true);
+	}
+
+	// 대량 붕괴로 개수 한도를 넘으면 다음 틱에 바로 정리 (스폰 도중 삭제 방지)
+	if (MaxDebrisCount > 0 && TrackedDebris.Num() > MaxDebrisCount)
+	{
+		TimerManager.SetTimerForNextTick(this, &UDebrisManagerSubsystem::EnforceDebrisBudget);
+	}
+}
+
+void UDebrisManagerSubsystem::UnregisterDebris(AActor* DebrisActor)
+{
+	// 예산 정리 도중(ForceSettle)에도 호출되므로 배열은 건드리지 않고 표시만 - 다음 패스에서 제거
+	for (FTrackedDebris& Debris : TrackedDebris)
+	{
+		if (Debris.Actor.Get() == DebrisActor)
+		{
+			Debris.Actor.Reset();
+		}
+	}
+}
+
+void UDebrisManagerSubsystem::GetDebrisBudgetUsage(int32& OutCount, int32& OutTriangles, int32& OutBodies) const
+{
+	OutCount = TrackedDebris.Num();
+	OutTriangles = LastDebrisTriangles;
+	OutBodies = LastDebrisBodies;
+}
+
+void UDebrisManagerSubsystem::EnforceDebrisBudget()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(DebrisManager_EnforceDebrisBudget);
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	// 1. 삭제된 Debris 정리 및 현재 사용량 집계
+	TrackedDebris.RemoveAllSwap([](const FTrackedDebris& Debris)
+	{
+		return !Debris.Actor.IsValid() || Debris.Actor->IsActorBeingDestroyed();
+	});
+
+	int32 TotalTriangles = 0;
+	int32 TotalBodies = 0;
+	for (FTrackedDebris& Debris : TrackedDebris)
+	{
+		// 클라이언트 메시는 늦게 채워질 수 있으므로 0이면 다시 센다
+		if (Debris.NumTriangles == 0)
+		{
+			if (UProceduralMeshComponent* Mesh = Debris.Mesh.Get())
+			{
+				for (int32 SectionIndex = 0; SectionIndex < Mesh->GetNumSections(); ++SectionIndex)
+				{
+					if (const FProcMeshSection* Section = Mesh->GetProcMeshSection(SectionIndex))
+					{
+						Debris.NumTriangles += Section->ProcIndexBuffer.Num() / 3;
+					}
+				}
+			}
+		}
+
+		const UPrimitiveComponent* Body = Debris.Body.Get();
+		Debris.bSimulating = Body && Body->IsSimulatingPhysics();
+
+		TotalTriangles += Debris.NumTriangles;
+		TotalBodies += Debris.bSimulating ? 1 : 0;
+	}
+
+	int32 TotalCount = TrackedDebris.Num();
+	LastDebrisTriangles = TotalTriangles;
+	LastDebrisBodies = TotalBodies;
+
+	auto IsOverCount = [&]() { return MaxDebrisCount > 0 && TotalCount > MaxDebrisCount; };
+	auto IsOverTriangles = [&]() { return MaxDebrisTriangles > 0 && TotalTriangles > MaxDebrisTriangles; };
+	auto IsOverBodies = [&]() { return MaxDebrisBodies > 0 && TotalBodies > MaxDebrisBodies; };
+
+	if (!IsOverCount() && !IsOverTriangles() && !IsOverBodies())
+	{
+		if (TrackedDebris.Num() == 0)
+		{
+			World->GetTimerManager().ClearTimer(BudgetTimerHandle);
+		}
+		return;
+	}
+
+	// 2. 중요도 계산: 크기 × 거리 감쇠 × 나이 감쇠 (플레이어 가까이, 크고, 최근 것이 중요)
+	TArray<FVector, TInlineAllocator<8>> ViewLocations;
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		if (const APlayerController* PC = It->Get())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			ViewLocations.Add(ViewLocation);
+		}
+	}
+
+	const double Now = World->GetTimeSeconds();
+	for (FTrackedDebris& Debris : TrackedDebris)
+	{
+		const UPrimitiveComponent* Body = Debris.Body.Get();
+		const FVector Location = Body ? Body->GetComponentLocation() : Debris.Actor->GetActorLocation();
+		const float Size = Body ? Body->Bounds.SphereRadius : 1.0f;
+
+		float NearestDistSq = ViewLocations.Num() > 0 ? TNumericLimits<float>::Max() : 0.0f;
+		for (const FVector& ViewLocation : ViewLocations)
+		{
+			NearestDistSq = FMath::Min(NearestDistSq, static_cast<float>(FVector::DistSquared(Location, ViewLocation)));
+		}
+
+		const float Age = static_cast<float>(Now - Debris.SpawnTime);
+		Debris.Importance = Size
+			* (ImportanceHalfDistance / (ImportanceHalfDistance + FMath::Sqrt(NearestDistSq)))
+			* (ImportanceHalfAge / (ImportanceHalfAge + Age));
+	}
+
+	TrackedDebris.Sort([](const FTrackedDebris& A, const FTrackedDebris& B)
+	{
+		return A.Importance < B.Importance;
+	});
+
+	// 3. 덜 중요한 것부터 한도 내로 들어올 때까지 다운그레이드/제거
+	int32 NumHandled = 0;
+	for (int32 Index = 0; Index < TrackedDebris.Num(); ++Index)
+	{
+		const bool bOverCountOrTriangles = IsOverCount() || IsOverTriangles();
+		if (!bOverCountOrTriangles && !IsOverBodies())
+		{
+			break;
+		}
+
+		const FTrackedDebris& Debris = TrackedDebris[Index];
+
+		// Body 한도만 넘은 경우 이미 멈춘 Debris는 건드리지 않음
+		if (!bOverCountOrTriangles && !Debris.bSimulating)
+		{
+			continue;
+		}
+
+		DowngradeDebris(Debris);
+
+		--TotalCount;
+		TotalTriangles -= Debris.NumTriangles;
+		TotalBodies -= Debris.bSimulating ? 1 : 0;
+
+		TrackedDebris[Index].Actor.Reset();
+		++NumHandled;
+	}
+
+	TrackedDebris.RemoveAllSwap([](const FTrackedDebris& Debris) { return !Debris.Actor.IsValid(); });
+
+	LastDebrisTriangles = TotalTriangles;
+	LastDebrisBodies = TotalBodies;
+
+	UE_LOG(LogTemp, Log, TEXT("[DebrisManager] Budget: evicted/downgraded %d debris (Count=%d, Triangles=%d, Bodies=%d)"),
+		NumHandled, TotalCount, TotalTriangles, TotalBodies);
+}
+
+void UDebrisManagerSubsystem::DowngradeDebris(const FTrackedDebris& Debris)
+{
+	AActor* DebrisActor = Debris.Actor.Get();
+	if (!DebrisActor)
+	{
+		return;
+	}
+
+	// 거의 멈춘 조각은 제자리에서 Rubble로 굽고, 움직이는 조각은 공중에 굳지 않도록 제거
+	const UPrimitiveComponent* Body = Debris.Body.Get();
+	const bool bSlow = !Body || !Body->IsSimulatingPhysics()
+		|| Body->GetPhysicsLinearVelocity().SizeSquared() <= FMath::Square(DebrisDowngradeMaxSpeed);
+
+	const bool bBake = bSlow && bConsolidationEnabled;
+
+	if (ADebrisActor* ReplicatedDebris = Cast<ADebrisActor>(DebrisActor))
+	{
+		// 클라이언트: 복제 Actor는 파괴할 수 없으므로 로컬에서만 굽거나 숨김 (로컬 상한)
+		if (!ReplicatedDebris->HasAuthority())
+		{
+			ReplicatedDebris->CullLocally(bBake);
+			return;
+		}
+
+		// 서버: 복제 Debris는 bSettled 복제로 클라이언트도 함께 굽는다
+		// 이미 멈췄는데 남아 있는 조각(Rubble이 거부)은 아래에서 제거
+		if (bBake && !ReplicatedDebris->bSettled)
+		{
+			ReplicatedDebris->ForceSettle();
+			return;
+		}
+	}
+
+	if (bBake)
+	{
+		if (UProceduralMeshComponent* Mesh = Debris.Mesh.Get())
+		{
+			ConsolidateDebris(Mesh);
+		}
+	}
+
+	DebrisActor->Destroy();
+}
@@ -13,11 +13,16 @@
 #include "Engine/GameInstance.h"
 #include "Tasks/Task.h"
 #include "Async/Async.h"
+#include "Misc/QueuedThreadPool.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/ScopeLock.h"
+#include "RenderCore.h"
 #include "ProfilingDebugging/CountersTrace.h"
 #include "Settings/RDMSetting.h"
 TRACE_DECLARE_INT_COUNTER(RDM_ActiveUnionWorkers, TEXT("RDMThreadManager/ActiveUnionWorkers"));
 TRACE_DECLARE_INT_COUNTER(RDM_ActiveSubtractWorkers, TEXT("RDMThreadManager/ActiveSubtractWorkers"));
 TRACE_DECLARE_INT_COUNTER(RDM_ActiveTotalWorkers, TEXT("RDMThreadManager/RDM_ActiveTotalWorkers"));
+TRACE_DECLARE_INT_COUNTER(RDM_MaxTotalWorkers, TEXT("RDMThreadManager/MaxTotalWorkers"));
 
 void URDMThreadManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -34,6 +39,171 @@ void URDMThreadManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection
 	if (const URDMSetting* Settings = URDMSetting::Get())
 	{
 		MaxTotalWorkers = Settings->GetEffectiveThreadCount();
+		WorkerPriority = Settings->WorkerPriority;
+		WorkerAffinityMask = static_cast<uint64>(Settings->WorkerAffinityMask);
+
+		BaseTotalWorkers = MaxTotalWorkers;
+		MaxDynamicWorkers = FMath::Max(MaxTotalWorkers, URDMSetting::GetDynamicThreadCountLimit());
+		TargetFrameTimeMs = Settings->TargetFrameTimeMs;
+
+		// 전용 풀: Boolean 작업이 엔진 태스크(애니메이션, 물리)와 task graph를 나눠 쓰지 않도록 분리
+		// 동적 스케일링 시에는 최대치만큼 스레드를 만들어두고 MaxTotalWorkers로 동시 실행 수를 제한
+		if (Settings->bUseDedicatedThreadPool)
+		{
+			CreateDedicatedPool(Settings->bEnableDynamicWorkerScaling ? MaxDynamicWorkers : MaxTotalWorkers);
+		}
+
+		if (Settings->bEnableDynamicWorkerScaling)
+		{
+			ScalingTickHandle = FTSTicker::GetCoreTicker().AddTicker(
+				FTickerDelegate::CreateUObject(this, &URDMThreadManagerSubsystem::TickWorkerScaling),
+				0.0f
+			);
+		}
+	}
+}
+
+bool URDMThreadManagerSubsystem::TickWorkerScaling(float DeltaTime)
+{
+	if (bIsShuttingDown.load())
+	{
+		return false;
+	}
+
+	// 게임/렌더 스레드 시간 중 큰 쪽을 매 프레임 누적 (한 프레임 샘플은 스파이크에 흔들림)
+	const float GameThreadMs = FPlatformTime::ToMilliseconds(GGameThreadTime);
+	const float RenderThreadMs = FPlatformTime::ToMilliseconds(GRenderThreadTime);
+	FrameMsSampleSum += FMath::Max(GameThreadMs, RenderThreadMs);
+	++FrameMsSampleCount;
+
+	// 판단은 1초에 한 번, 구간 평균으로
+	ScalingIntervalAccum += DeltaTime;
+	if (ScalingIntervalAccum < 1.0f)
+	{
+		return true;
+	}
+
+	const float FrameMs = static_cast<float>(FrameMsSampleSum / FMath::Max(1, FrameMsSampleCount));
+	ScalingIntervalAccum = 0.0f;
+	FrameMsSampleSum = 0.0;
+	FrameMsSampleCount = 0;
+
+	const float HeadroomMs = TargetFrameTimeMs - FrameMs;
+
+	// 매니저 대기 큐 + 요청자(Boolean processor)가 청크별로 쥐고 있는 op
+	const int32 Pending = PendingCount.load() + GetReportedPendingOps();
+	const int32 Active = ActiveWorkers.load();
+	const int32 Current = MaxTotalWorkers.load();
+	int32 Next = Current;
+
+	if (FrameMs > TargetFrameTimeMs * 0.95f)
+	{
+		// 프레임이 빠듯함 → 워커 축소
+		Next = Current - 1;
+	}
+	else if (Pending > 0 && HeadroomMs > TargetFrameTimeMs * 0.25f)
+	{
+		// 밀린 작업이 있고 CPU 여유 있음 → 워커 확장
+		Next = Current + 1;
+	}
+	else if (Pending == 0 && Active < Current / 2 && Current > BaseTotalWorkers)
+	{
+		// 한가함 → 설정값으로 천천히 복귀
+		Next = Current - 1;
+	}
+
+	Next = FMath::Clamp(Next, MinDynamicWorkers, MaxDynamicWorkers);
+	if (Next != Current)
+	{
+		SetMaxTotalWorkers(Next);
+		UE_LOG(LogTemp, Verbose, TEXT("[RDMThreadManager] Scaling workers %d -> %d (AvgFrame=%.2fms, Pending=%d)"),
+			Current, Next, FrameMs, Pending);
+
+		if (Next > Current)
+		{
+			TryDispatchPending();
+		}
+	}
+
+	TRACE_COUNTER_SET(RDM_MaxTotalWorkers, MaxTotalWorkers.load());
+	return true;
+}
+
+void URDMThreadManagerSubsystem::ReportPendingOps(UObject* Requester, int32 NumOps)
+{
+	check(IsInGameThread());
+
+	if (!Requester)
+	{
+		return;
+	}
+
+	if (NumOps > 0)
+	{
+		ReportedPendingOps.Add(Requester, NumOps);
+	}
+	else
+	{
+		ReportedPendingOps.Remove(Requester);
+	}
+}
+
+int32 URDMThreadManagerSubsystem::GetReportedPendingOps()
+{
+	int32 Total = 0;
+	for (auto It = ReportedPendingOps.CreateIterator(); It; ++It)
+	{
+		// 파괴된 컴포넌트가 남긴 값은 정리
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+		Total += It.Value();
+	}
+	return Total;
+}
+
+void URDMThreadManagerSubsystem::CreateDedicatedPool(int32 NumThreads)
+{
+	DestroyDedicatedPool();
+
+	EThreadPriority ThreadPriority = TPri_BelowNormal;
+	switch (WorkerPriority)
+	{
+	case ERDMWorkerPriority::Lowest:
+		ThreadPriority = TPri_Lowest;
+		break;
+	case ERDMWorkerPriority::Normal:
+		ThreadPriority = TPri_Normal;
+		break;
+	default:
+		ThreadPriority = TPri_BelowNormal;
+		break;
+	}
+
+	DedicatedPool = FQueuedThreadPool::Allocate();
+	// Boolean 연산은 재귀 깊이가 있으므로 기본 스택보다 넉넉하게
+	if (!DedicatedPool->Create(FMath::Max(1, NumThreads), 256 * 1024, ThreadPriority, TEXT("RDMBooleanPool")))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[RDMThreadManager] Failed to create dedicated pool, falling back to task graph"));
+		delete DedicatedPool;
+		DedicatedPool = nullptr;
+		return;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[RDMThreadManager] Dedicated pool created: %d threads, Priority=%d, Affinity=0x%llx"),
+		NumThreads, static_cast<int32>(ThreadPriority), WorkerAffinityMask);
+}
+
+void URDMThreadManagerSubsystem::DestroyDedicatedPool()
+{
+	if (DedicatedPool)
+	{
+		// 실행 중인 작업이 끝날 때까지 대기 후 스레드 종료
+		DedicatedPool->Destroy();
+		delete DedicatedPool;
+		DedicatedPool = nullptr;
 	}
 }
  
@@ -41,10 +211,20 @@ void URDMThreadManagerSubsystem::Deinitialize()
 {
 	bIsShuttingDown.store(true);
 
+	if (ScalingTickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ScalingTickHandle);
+		ScalingTickHandle.Reset();
+	}
+
 	// 대기 큐 비우기
-	TFunction<void()> Dummy;
-	while (PendingQueue.Dequeue(Dummy)) {}
-	PendingCount.store(0);
+	{
+		FScopeLock Lock(&DispatchLock);
+		TFunction<void()> Dummy;
+		while (PendingQueue.Dequeue(Dummy)) {}
+		PendingCount.store(0);
+	}
+	ReportedPendingOps.Empty();
 
 	// 활성 Worker 종료 대기 (최대 1초)
 	double StartTime = FPlatformTime::Seconds();
@@ -53,6 +233,8 @@ void URDMThreadManagerSubsystem::Deinitialize()
 		FPlatformProcess::Sleep(0.01f);
 	}
 
+	DestroyDedicatedPool();
+
 	Super::Deinitialize();
 }
 
@@ -83,7 +265,7 @@ void URDMThreadManagerSubsystem::RequestWork(TFunction<void()>&& WorkFunc, UObje
 	// Active Worker 수 체크
 	int32 CurrentActive = ActiveWorkers.load();
 
-	if (CurrentActive < MaxTotalWorkers)
+	if (CurrentActive < MaxTotalWorkers.load())
 	{
 		// 남는 worker가 있다면 실행
 		LaunchWork(MoveTemp(WorkFunc));
@@ -100,7 +282,7 @@ void URDMThreadManagerSubsystem::LogStatus() const
 {
 	UE_LOG(LogTemp, Warning, TEXT("[RDMThreadManager] Active: %d / %d, Pending: %d"),
 		ActiveWorkers.load(),
-		MaxTotalWorkers,
+		MaxTotalWorkers.load(),
 		PendingCount.load());
 }
 
@@ -110,8 +292,7 @@ void URDMThreadManagerSubsystem::LaunchWork(TFunction<void()>&& WorkFunc)
 	
 	TWeakObjectPtr<URDMThreadManagerSubsystem> WeakThis(this);
 
-	UE::Tasks::Launch(UE_SOURCE_LOCATION,
-		[WeakThis, Func = MoveTemp(WorkFunc)]() mutable
+	auto Job = [WeakThis, Func = MoveTemp(WorkFunc)]() mutable
 		{
 			// 작업 실행
 			Func();
@@ -129,7 +310,45 @@ void URDMThreadManagerSubsystem::LaunchWork(TFunction<void()>&& WorkFunc)
 			// 		Manager->OnWorkComplete();
 			// 	}
 			// });
+		};
+
+	if (DedicatedPool)
+	{
+		// 전용 풀 스레드는 처음 작업을 받을 때 한 번만 affinity 적용
+		AsyncPool(*DedicatedPool, [AffinityMask = WorkerAffinityMask, Job = MoveTemp(Job)]() mutable
+		{
+			static thread_local bool bAffinityApplied = false;
+			if (!bAffinityApplied)
+			{
+				bAffinityApplied = true;
+				if (AffinityMask != 0)
+				{
+					FPlatformProcess::SetThreadAffinityMask(AffinityMask);
+				}
+			}
+
+			Job();
 		});
+		return;
+	}
+
+	// 공유 task graph: 기본값은 Normal (Lowest/BelowNormal을 고르면 background로 실행해서 프레임 필수 작업을 선점하지 않도록)
+	UE::Tasks::ETaskPriority TaskPriority = UE::Tasks::ETaskPriority::Normal;
+	switch (WorkerPriority)
+	{
+	case ERDMWorkerPriority::Lowest:
+		TaskPriority = UE::Tasks::ETaskPriority::BackgroundLow;
+		break;
+	case ERDMWorkerPriority::BelowNormal:
+		TaskPriority = UE::Tasks::ETaskPriority::BackgroundNormal;
+		break;
+	case ERDMWorkerPriority::Default:
+	case ERDMWorkerPriority::Normal:
+		TaskPriority = UE::Tasks::ETaskPriority::Normal;
+		break;
+	}
+
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(Job), TaskPriority);
 }
 
 void URDMThreadManagerSubsystem::OnWorkComplete()
@@ -148,18 +367,21 @@ void URDMThreadManagerSubsystem::OnWorkComplete()
 void URDMThreadManagerSubsystem::TryDispatchPending()
 {
 	// worker가 있고 대기 작업이 있으면 실행
-	while (ActiveWorkers.load() < MaxTotalWorkers)
+	while (ActiveWorkers.load() < MaxTotalWorkers.load())
 	{
 		TFunction<void()> WorkFunc;
 
-		if (!PendingQueue.Dequeue(WorkFunc))
 		{
-			// 대기 큐 비었음
-			break;
+			// 완료된 여러 워커와 스케일러가 동시에 들어오므로 Dequeue는 한 번에 하나만
+			FScopeLock Lock(&DispatchLock);
+			if (!PendingQueue.Dequeue(WorkFunc))
+			{
+				// 대기 큐 비었음
+				break;
+			}
+			PendingCount.fetch_sub(1);
 		}
 
-		PendingCount.fetch_sub(1);
 		LaunchWork(MoveTemp(WorkFunc));
 	}
 }
-  
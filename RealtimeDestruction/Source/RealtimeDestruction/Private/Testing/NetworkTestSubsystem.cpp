@@ -10,10 +10,18 @@
 // NetworkTestSubsystem.cpp
 
 #include "Testing/NetworkTestSubsystem.h"
+#include "Components/RealtimeDestructibleMeshComponent.h"
+#include "Debug/DestructionDebugger.h"
+#include "Engine/Engine.h"
+#include "Engine/NetDriver.h"
 #include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/PlayerState.h"
 #include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectIterator.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogNetworkTest, Log, All);
 
@@ -26,7 +34,8 @@ void UNetworkTestSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 void UNetworkTestSubsystem::Deinitialize()
 {
-	// 정리 시 시뮬레이션 해제
+	// 정리 시 소크 테스트 중단 및 시뮬레이션 해제
+	StopSoakTest();
 	DisableSimulation();
 	Super::Deinitialize();
 	UE_LOG(LogNetworkTest, Log, TEXT("NetworkTestSubsystem: Deinitialized"));
@@ -199,3 +208,640 @@ void UNetworkTestSubsystem::PrintCurrentStatus() const
 	UE_LOG(LogNetworkTest, Log, TEXT("  Current Ping: %.0f ms"), GetCurrentPing());
 	UE_LOG(LogNetworkTest, Log, TEXT("========================================="));
 }
+
+//=============================================================================
+// Soak Test
+//=============================================================================
+
+namespace
+{
+	/** Sweep 패턴 격자 해상도 (면 당 N x N 지점) */
+	constexpr int32 SoakSweepGridSize = 8;
+
+	/** Cluster 패턴 반경 (면 크기 대비 비율) */
+	constexpr float SoakClusterSpread = 0.08f;
+
+	/** 월드 간 비교용 키 (PIE 접두사 제거) */
+	FString GetSoakComponentKey(const URealtimeDestructibleMeshComponent* Component)
+	{
+		return UWorld::RemovePIEPrefix(Component->GetPathName());
+	}
+
+	bool IsAuthorityWorld(const UWorld* World)
+	{
+		return World && World->GetNetMode() != NM_Client;
+	}
+}
+
+uint32 UNetworkTestSubsystem::ComputeCellStateHash(const URealtimeDestructibleMeshComponent* Component)
+{
+	if (!Component)
+	{
+		return 0;
+	}
+
+	// TSet 순회 순서는 삽입 이력에 따라 달라지므로 정렬 후 해시
+	TArray<int32> Cells = Component->GetCellState().DestroyedCells.Array();
+	Cells.Sort();
+	return FCrc::MemCrc32(Cells.GetData(), Cells.Num() * sizeof(int32), static_cast<uint32>(Cells.Num()));
+}
+
+void UNetworkTestSubsystem::GatherDestructibleComponents(UWorld* InWorld, TArray<URealtimeDestructibleMeshComponent*>& OutComponents) const
+{
+	OutComponents.Reset();
+	if (!InWorld)
+	{
+		return;
+	}
+
+	for (TObjectIterator<URealtimeDestructibleMeshComponent> It; It; ++It)
+	{
+		URealtimeDestructibleMeshComponent* Component = *It;
+		if (IsValid(Component) && Component->GetWorld() == InWorld && Component->GetOwner() && Component->IsGridCellLayoutValid())
+		{
+			OutComponents.Add(Component);
+		}
+	}
+}
+
+void UNetworkTestSubsystem::PrintCellStateHashes() const
+{
+	UWorld* World = GetWorld();
+	TArray<URealtimeDestructibleMeshComponent*> Components;
+	GatherDestructibleComponents(World, Components);
+
+	UE_LOG(LogNetworkTest, Log, TEXT(""));
+	UE_LOG(LogNetworkTest, Log, TEXT("========== Cell State Hashes (NetMode %d) =========="), World ? static_cast<int32>(World->GetNetMode()) : -1);
+	for (const URealtimeDestructibleMeshComponent* Component : Components)
+	{
+		UE_LOG(LogNetworkTest, Log, TEXT("  %08X  Destroyed:%6d  %s"),
+			ComputeCellStateHash(Component), Component->GetCellState().DestroyedCells.Num(), *GetSoakComponentKey(Component));
+	}
+	UE_LOG(LogNetworkTest, Log, TEXT("===================================================="));
+}
+
+bool UNetworkTestSubsystem::StartSoakTest(const FNetworkSoakConfig& Config)
+{
+	UWorld* World = GetWorld();
+	if (!IsAuthorityWorld(World))
+	{
+		UE_LOG(LogNetworkTest, Warning, TEXT("NetworkTestSubsystem: Soak test must be started on the server"));
+		return false;
+	}
+
+	if (bSoakRunning)
+	{
+		UE_LOG(LogNetworkTest, Warning, TEXT("NetworkTestSubsystem: Soak test already running"));
+		return false;
+	}
+
+	SoakConfig = Config;
+	SoakConfig.NumClients = FMath::Clamp(SoakConfig.NumClients, 1, 64);
+
+	SoakPresetQueue = SoakConfig.Presets;
+	if (SoakPresetQueue.Num() == 0)
+	{
+		SoakPresetQueue = { ENetworkTestPreset::Off, ENetworkTestPreset::Good, ENetworkTestPreset::Normal,
+			ENetworkTestPreset::Bad, ENetworkTestPreset::Worst };
+	}
+
+	SoakReports.Reset();
+	SoakPresetIndex = 0;
+	PresetBeforeSoak = CurrentPreset;
+
+	// 클라이언트별 결정적 스트림 (같은 설정이면 같은 탄착 순서)
+	SoakClientStreams.SetNum(SoakConfig.NumClients);
+	SoakClientClusterCenters.SetNum(SoakConfig.NumClients);
+	SoakClientShotIndex.Init(0, SoakConfig.NumClients);
+	for (int32 ClientIndex = 0; ClientIndex < SoakConfig.NumClients; ++ClientIndex)
+	{
+		SoakClientStreams[ClientIndex].Initialize(0x50A4 + ClientIndex * 7919);
+		SoakClientClusterCenters[ClientIndex] = FVector2D(
+			SoakClientStreams[ClientIndex].FRandRange(0.2f, 0.8f),
+			SoakClientStreams[ClientIndex].FRandRange(0.2f, 0.8f));
+	}
+
+	// 시작 시점에 이미 접속한 in-process 클라이언트는 late join 대상 아님
+	SoakKnownClientWorlds.Reset();
+	SoakLateJoinWorlds.Reset();
+	if (GEngine)
+	{
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			UWorld* ContextWorld = Context.World();
+			if (ContextWorld && ContextWorld->GetNetMode() == NM_Client)
+			{
+				SoakKnownClientWorlds.Add(ContextWorld);
+			}
+		}
+	}
+
+	// RPC 카운트는 디버거 통계를 사용하므로 테스트 동안 활성화
+	if (UDestructionDebugger* Debugger = World->GetSubsystem<UDestructionDebugger>())
+	{
+		bDebuggerWasEnabled = Debugger->IsEnabled();
+		Debugger->SetEnabled(true);
+	}
+
+	bSoakRunning = true;
+	BeginSoakPreset();
+
+	SoakTickHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UNetworkTestSubsystem::TickSoakTest), 0.0f);
+
+	UE_LOG(LogNetworkTest, Log, TEXT("NetworkTestSubsystem: Soak test started (Clients:%d, %.0fs/preset, %d presets, %.1f shots/s/client)"),
+		SoakConfig.NumClients, SoakConfig.SecondsPerPreset, SoakPresetQueue.Num(), SoakConfig.ShotsPerClientPerSecond);
+	return true;
+}
+
+void UNetworkTestSubsystem::StopSoakTest()
+{
+	if (!bSoakRunning)
+	{
+		return;
+	}
+
+	FinishSoakPreset();
+	bSoakRunning = false;
+
+	if (SoakTickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(SoakTickHandle);
+		SoakTickHandle.Reset();
+	}
+
+	if (UWorld* World = GetWorld())
+	{
+		if (UDestructionDebugger* Debugger = World->GetSubsystem<UDestructionDebugger>())
+		{
+			Debugger->SetEnabled(bDebuggerWasEnabled);
+		}
+	}
+
+	ApplyPreset(PresetBeforeSoak);
+	PrintSoakReport();
+	if (SoakConfig.bExportCSV)
+	{
+		ExportSoakReport();
+	}
+}
+
+void UNetworkTestSubsystem::BeginSoakPreset()
+{
+	ApplyPreset(SoakPresetQueue[SoakPresetIndex]);
+
+	FNetworkSoakPresetReport& Report = SoakReports.AddDefaulted_GetRef();
+	Report.PresetName = CurrentConfig.PresetName;
+
+	const double Now = FPlatformTime::Seconds();
+	SoakPhase = ESoakPhase::Firing;
+	SoakPhaseStartTime = Now;
+	SoakLastSampleTime = Now;
+	SoakShotBudget = 0.0;
+	SoakBandwidthSamples = 0;
+	SoakOutBytesSum = 0.0;
+	SoakInBytesSum = 0.0;
+
+	SoakServerRPCBase = 0;
+	SoakMulticastRPCBase = 0;
+	if (UDestructionDebugger* Debugger = GetWorld() ? GetWorld()->GetSubsystem<UDestructionDebugger>() : nullptr)
+	{
+		const FDestructionNetworkStats Stats = Debugger->GetNetworkStats();
+		SoakServerRPCBase = Stats.ServerRPCCount;
+		SoakMulticastRPCBase = Stats.MulticastRPCCount;
+	}
+}
+
+void UNetworkTestSubsystem::FinishSoakPreset()
+{
+	if (SoakReports.Num() == 0)
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	FNetworkSoakPresetReport& Report = SoakReports.Last();
+
+	if (SoakBandwidthSamples > 0)
+	{
+		Report.AvgOutBytesPerSec = static_cast<float>(SoakOutBytesSum / SoakBandwidthSamples);
+		Report.AvgInBytesPerSec = static_cast<float>(SoakInBytesSum / SoakBandwidthSamples);
+	}
+
+	if (UDestructionDebugger* Debugger = World ? World->GetSubsystem<UDestructionDebugger>() : nullptr)
+	{
+		const FDestructionNetworkStats Stats = Debugger->GetNetworkStats();
+		Report.ServerRPCCount = Stats.ServerRPCCount - SoakServerRPCBase;
+		Report.MulticastRPCCount = Stats.MulticastRPCCount - SoakMulticastRPCBase;
+	}
+
+	if (UNetDriver* NetDriver = World ? World->GetNetDriver() : nullptr)
+	{
+		Report.ConnectedClients = NetDriver->ClientConnections.Num();
+	}
+
+	CompareClientCellStates(Report);
+
+	UE_LOG(LogNetworkTest, Log, TEXT("NetworkTestSubsystem: Soak preset '%s' done - Shots:%d Out:%.0f B/s In:%.0f B/s Multicast:%d Agreement:%s (%d/%d)"),
+		*Report.PresetName, Report.ShotsFired, Report.AvgOutBytesPerSec, Report.AvgInBytesPerSec, Report.MulticastRPCCount,
+		Report.IsCellStateAgreed() ? TEXT("OK") : TEXT("MISMATCH"),
+		Report.ComparedViews - Report.MismatchedViews, Report.ComparedViews);
+}
+
+bool UNetworkTestSubsystem::TickSoakTest(float DeltaTime)
+{
+	UWorld* World = GetWorld();
+	if (!bSoakRunning || !World)
+	{
+		return true;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	const double PhaseElapsed = Now - SoakPhaseStartTime;
+
+	// 1초 단위 샘플링 (NetDriver 대역폭은 초당 갱신됨)
+	if (Now - SoakLastSampleTime >= 1.0)
+	{
+		SoakLastSampleTime = Now;
+		SampleSoakBandwidth();
+		UpdateLateJoinTracking(Now);
+	}
+
+	if (SoakPhase == ESoakPhase::Firing)
+	{
+		TArray<URealtimeDestructibleMeshComponent*> Targets;
+		GatherDestructibleComponents(World, Targets);
+
+		if (Targets.Num() > 0)
+		{
+			// 프레임 레이트와 무관하게 일정한 발사 속도 유지
+			SoakShotBudget += DeltaTime * SoakConfig.ShotsPerClientPerSecond;
+			while (SoakShotBudget >= 1.0)
+			{
+				SoakShotBudget -= 1.0;
+				for (int32 ClientIndex = 0; ClientIndex < SoakConfig.NumClients; ++ClientIndex)
+				{
+					FireSoakShot(ClientIndex, Targets);
+				}
+			}
+		}
+
+		if (PhaseElapsed >= SoakConfig.SecondsPerPreset)
+		{
+			SoakPhase = ESoakPhase::Settling;
+			SoakPhaseStartTime = Now;
+		}
+		return true;
+	}
+
+	// Settling: 배치/복제가 모두 반영될 때까지 대기 후 비교
+	if (PhaseElapsed >= SoakConfig.SettleSeconds)
+	{
+		++SoakPresetIndex;
+		if (SoakPresetIndex >= SoakPresetQueue.Num())
+		{
+			StopSoakTest();
+			return false;
+		}
+
+		FinishSoakPreset();
+		BeginSoakPreset();
+	}
+	return true;
+}
+
+void UNetworkTestSubsystem::FireSoakShot(int32 ClientIndex, const TArray<URealtimeDestructibleMeshComponent*>& Targets)
+{
+	UWorld* World = GetWorld();
+	FNetworkSoakPresetReport& Report = SoakReports.Last();
+
+	const int32 ShotIndex = SoakClientShotIndex[ClientIndex]++;
+	URealtimeDestructibleMeshComponent* Target = Targets[(ClientIndex + ShotIndex) % Targets.Num()];
+
+	const FBox Bounds = Target->GetOwner()->GetComponentsBoundingBox(true);
+	if (!Bounds.IsValid)
+	{
+		++Report.ShotsMissed;
+		return;
+	}
+
+	// 가장 얇은 축을 사격 방향으로 사용 (벽은 정면, 바닥은 위에서)
+	const FVector Extent = Bounds.GetExtent();
+	int32 Axis = 0;
+	if (Extent.Y < Extent[Axis]) { Axis = 1; }
+	if (Extent.Z < Extent[Axis]) { Axis = 2; }
+	const int32 AxisU = (Axis + 1) % 3;
+	const int32 AxisV = (Axis + 2) % 3;
+
+	FVector2D UV;
+	FRandomStream& Stream = SoakClientStreams[ClientIndex];
+	switch (SoakConfig.Pattern)
+	{
+	case ENetworkSoakPattern::Random:
+		UV = FVector2D(Stream.FRand(), Stream.FRand());
+		break;
+	case ENetworkSoakPattern::Cluster:
+		UV = SoakClientClusterCenters[ClientIndex] + FVector2D(
+			Stream.FRandRange(-SoakClusterSpread, SoakClusterSpread),
+			Stream.FRandRange(-SoakClusterSpread, SoakClusterSpread));
+		break;
+	default:
+		{
+			// 클라이언트끼리 격자 지점을 교차로 나눠 가짐
+			const int32 GridCell = (ShotIndex * SoakConfig.NumClients + ClientIndex) % (SoakSweepGridSize * SoakSweepGridSize);
+			UV = FVector2D(
+				(GridCell % SoakSweepGridSize + 0.5f) / SoakSweepGridSize,
+				(GridCell / SoakSweepGridSize + 0.5f) / SoakSweepGridSize);
+		}
+		break;
+	}
+
+	// 가장자리는 피함 (10% inset)
+	UV.X = FMath::Lerp(0.1f, 0.9f, FMath::Clamp(UV.X, 0.0f, 1.0f));
+	UV.Y = FMath::Lerp(0.1f, 0.9f, FMath::Clamp(UV.Y, 0.0f, 1.0f));
+
+	FVector AimPoint = Bounds.GetCenter();
+	AimPoint[AxisU] = FMath::Lerp(Bounds.Min[AxisU], Bounds.Max[AxisU], UV.X);
+	AimPoint[AxisV] = FMath::Lerp(Bounds.Min[AxisV], Bounds.Max[AxisV], UV.Y);
+
+	FVector ShotDir = FVector::ZeroVector;
+	ShotDir[Axis] = (Axis == 2 || (ClientIndex & 1) == 0) ? -1.0 : 1.0;
+
+	const double TraceLength = Extent.Size() * 2.0 + 100.0;
+	const FVector TraceStart = AimPoint - ShotDir * TraceLength;
+	const FVector TraceEnd = AimPoint + ShotDir * TraceLength;
+
+	FHitResult Hit;
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(DestructionSoakTrace), true);
+	if (!World->LineTraceSingleByChannel(Hit, TraceStart, TraceEnd, ECC_Visibility, QueryParams)
+		|| Hit.GetActor() != Target->GetOwner())
+	{
+		++Report.ShotsMissed;
+		return;
+	}
+
+	const int32 ChunkIndex = Target->GetChunkIndex(Hit.GetComponent());
+	if (ChunkIndex == INDEX_NONE)
+	{
+		++Report.ShotsMissed;
+		return;
+	}
+
+	FRealtimeDestructionRequest Request;
+	Request.ImpactPoint = Hit.ImpactPoint;
+	Request.ImpactNormal = Hit.ImpactNormal;
+	Request.ToolForwardVector = ShotDir;
+	Request.ToolShape = EDestructionToolShape::Cylinder;
+	Request.ShapeParams.Radius = SoakConfig.ToolRadius;
+	Request.Depth = Request.ShapeParams.Height;
+	Request.ToolOriginWorld = Request.ImpactPoint - (Request.ToolForwardVector * Request.ShapeParams.SurfaceMargin);
+	Request.ChunkIndex = ChunkIndex;
+	Request.bSpawnDecal = false;
+	Request.RandomSeed = ShotIndex;
+	Request.ShotId = URealtimeDestructibleMeshComponent::GenerateShotId();
+	Request.ToolMeshPtr = Target->CreateToolMeshPtrFromShapeParams(Request.ToolShape, Request.ShapeParams);
+
+	// 원격 클라이언트의 RPC가 서버에 도착한 이후 처리(DestructionNetworkComponent::ServerApplyDestruction)를 서버에서 재현
+	// 가상 클라이언트에는 PlayerController/연결이 없으므로 실제 Server RPC, _Validate, 플레이어별 연사 제한은 거치지 않음
+	// → 세부 검증은 RequestingPlayer 없이 수행하고, Server RPC 카운트는 샷당 1회로 기록하는 합성 값
+	EDestructionRejectReason RejectReason;
+	if (!Target->ValidateDestructionRequest(Request, nullptr, RejectReason))
+	{
+		++Report.ShotsMissed;
+		return;
+	}
+
+	if (UDestructionDebugger* Debugger = World->GetSubsystem<UDestructionDebugger>())
+	{
+		Debugger->RecordServerRPCWithSize(Target->bUseCompactMulticast);
+		Debugger->RecordClientRequest(-(ClientIndex + 1), FString::Printf(TEXT("SoakClient_%d"), ClientIndex), false);
+	}
+
+	// 셀 누적 데미지 판정 (실제 서버 경로와 동일하게 Op 전파 전에)
+	Target->ResolveCellDamage(Request);
+
+	const ENetMode NetMode = World->GetNetMode();
+	if (NetMode == NM_ListenServer || NetMode == NM_DedicatedServer || NetMode == NM_Standalone)
+	{
+		Target->RequestDestruction(Request);
+	}
+
+	if (NetMode != NM_Standalone)
+	{
+		FRealtimeDestructionOp Op;
+		Op.Request = Request;
+		if (Target->bUseServerBatching)
+		{
+			Target->EnqueueForServerBatch(Op);
+		}
+		else if (Target->bUseCompactMulticast)
+		{
+			if (UDestructionDebugger* Debugger = World->GetSubsystem<UDestructionDebugger>())
+			{
+				Debugger->RecordMulticastRPCWithSize(1, true);
+			}
+			TArray<FCompactDestructionOp> CompactOps;
+			CompactOps.Add(FCompactDestructionOp::Compress(Op.Request, 0));
+			Target->MulticastApplyOpsCompact(CompactOps);
+		}
+		else
+		{
+			if (UDestructionDebugger* Debugger = World->GetSubsystem<UDestructionDebugger>())
+			{
+				Debugger->RecordMulticastRPCWithSize(1, false);
+			}
+			TArray<FRealtimeDestructionOp> Ops;
+			Ops.Add(Op);
+			Target->MulticastApplyOps(Ops);
+		}
+	}
+
+	++Report.ShotsFired;
+}
+
+void UNetworkTestSubsystem::SampleSoakBandwidth()
+{
+	UWorld* World = GetWorld();
+	UNetDriver* NetDriver = World ? World->GetNetDriver() : nullptr;
+	if (!NetDriver || SoakReports.Num() == 0)
+	{
+		return;
+	}
+
+	const double OutBytes = NetDriver->OutBytesPerSecond;
+	const double InBytes = NetDriver->InBytesPerSecond;
+
+	SoakOutBytesSum += OutBytes;
+	SoakInBytesSum += InBytes;
+	++SoakBandwidthSamples;
+
+	FNetworkSoakPresetReport& Report = SoakReports.Last();
+	Report.PeakOutBytesPerSec = FMath::Max(Report.PeakOutBytesPerSec, static_cast<float>(OutBytes));
+}
+
+void UNetworkTestSubsystem::UpdateLateJoinTracking(double Now)
+{
+	if (!GEngine || SoakReports.Num() == 0)
+	{
+		return;
+	}
+
+	// 새로 나타난 클라이언트 월드 = late join
+	for (const FWorldContext& Context : GEngine->GetWorldContexts())
+	{
+		UWorld* ContextWorld = Context.World();
+		if (ContextWorld && ContextWorld->GetNetMode() == NM_Client && !SoakKnownClientWorlds.Contains(ContextWorld))
+		{
+			SoakKnownClientWorlds.Add(ContextWorld);
+			SoakLateJoinWorlds.Add(ContextWorld, Now);
+		}
+	}
+
+	if (SoakLateJoinWorlds.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<URealtimeDestructibleMeshComponent*> ServerComponents;
+	GatherDestructibleComponents(GetWorld(), ServerComponents);
+
+	TMap<FString, uint32> ServerHashes;
+	for (const URealtimeDestructibleMeshComponent* Component : ServerComponents)
+	{
+		ServerHashes.Add(GetSoakComponentKey(Component), ComputeCellStateHash(Component));
+	}
+
+	FNetworkSoakPresetReport& Report = SoakReports.Last();
+	TArray<URealtimeDestructibleMeshComponent*> ClientComponents;
+	for (auto It = SoakLateJoinWorlds.CreateIterator(); It; ++It)
+	{
+		UWorld* ClientWorld = It.Key().Get();
+		if (!ClientWorld)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		// 모든 컴포넌트 해시가 서버와 같아지면 동기화 완료
+		GatherDestructibleComponents(ClientWorld, ClientComponents);
+		int32 Matched = 0;
+		for (const URealtimeDestructibleMeshComponent* Component : ClientComponents)
+		{
+			const uint32* ServerHash = ServerHashes.Find(GetSoakComponentKey(Component));
+			if (ServerHash && *ServerHash == ComputeCellStateHash(Component))
+			{
+				++Matched;
+			}
+		}
+
+		if (Matched > 0 && Matched == ServerHashes.Num())
+		{
+			const float SyncMs = static_cast<float>((Now - It.Value()) * 1000.0);
+			Report.LateJoinSyncMs = FMath::Max(Report.LateJoinSyncMs, SyncMs);
+			UE_LOG(LogNetworkTest, Log, TEXT("NetworkTestSubsystem: Late-join client synced in %.0f ms"), SyncMs);
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UNetworkTestSubsystem::CompareClientCellStates(FNetworkSoakPresetReport& Report) const
+{
+	TArray<URealtimeDestructibleMeshComponent*> ServerComponents;
+	GatherDestructibleComponents(GetWorld(), ServerComponents);
+
+	TMap<FString, const URealtimeDestructibleMeshComponent*> ServerByKey;
+	for (const URealtimeDestructibleMeshComponent* Component : ServerComponents)
+	{
+		ServerByKey.Add(GetSoakComponentKey(Component), Component);
+	}
+
+	Report.ComparedViews = 0;
+	Report.MismatchedViews = 0;
+
+	if (!GEngine)
+	{
+		return;
+	}
+
+	// in-process 클라이언트 월드만 직접 비교 가능 (별도 프로세스는 Destruction.SoakHash로 확인)
+	TArray<URealtimeDestructibleMeshComponent*> ClientComponents;
+	for (const FWorldContext& Context : GEngine->GetWorldContexts())
+	{
+		UWorld* ClientWorld = Context.World();
+		if (!ClientWorld || ClientWorld->GetNetMode() != NM_Client)
+		{
+			continue;
+		}
+
+		GatherDestructibleComponents(ClientWorld, ClientComponents);
+		for (const URealtimeDestructibleMeshComponent* Component : ClientComponents)
+		{
+			const FString Key = GetSoakComponentKey(Component);
+			const URealtimeDestructibleMeshComponent* const* ServerComponent = ServerByKey.Find(Key);
+			if (!ServerComponent)
+			{
+				continue;
+			}
+
+			++Report.ComparedViews;
+			if (ComputeCellStateHash(*ServerComponent) != ComputeCellStateHash(Component))
+			{
+				++Report.MismatchedViews;
+				UE_LOG(LogNetworkTest, Warning, TEXT("NetworkTestSubsystem: Cell state mismatch on %s (Server:%d cells, Client:%d cells)"),
+					*Key, (*ServerComponent)->GetCellState().DestroyedCells.Num(), Component->GetCellState().DestroyedCells.Num());
+			}
+		}
+	}
+
+	if (Report.ComparedViews == 0)
+	{
+		// 비교 대상이 없으면 서버 해시를 로그로 남겨 클라이언트 로그와 대조
+		PrintCellStateHashes();
+	}
+}
+
+void UNetworkTestSubsystem::PrintSoakReport() const
+{
+	UE_LOG(LogNetworkTest, Log, TEXT(""));
+	UE_LOG(LogNetworkTest, Log, TEXT("========== Destruction Soak Report (%d clients, %s) =========="),
+		SoakConfig.NumClients, *UEnum::GetDisplayValueAsText(SoakConfig.Pattern).ToString());
+	UE_LOG(LogNetworkTest, Log, TEXT("  %-8s %6s %6s %10s %10s %10s %8s %8s %6s %10s %s"),
+		TEXT("Preset"), TEXT("Shots"), TEXT("Miss"), TEXT("AvgOut/s"), TEXT("PeakOut/s"), TEXT("AvgIn/s"),
+		TEXT("SrvRPC*"), TEXT("Mcast"), TEXT("Conns"), TEXT("LateJoin"), TEXT("Agreement"));
+	for (const FNetworkSoakPresetReport& Report : SoakReports)
+	{
+		UE_LOG(LogNetworkTest, Log, TEXT("  %-8s %6d %6d %10.0f %10.0f %10.0f %8d %8d %6d %10s %s (%d/%d)"),
+			*Report.PresetName, Report.ShotsFired, Report.ShotsMissed,
+			Report.AvgOutBytesPerSec, Report.PeakOutBytesPerSec, Report.AvgInBytesPerSec,
+			Report.ServerRPCCount, Report.MulticastRPCCount, Report.ConnectedClients,
+			Report.LateJoinSyncMs >= 0.0f ? *FString::Printf(TEXT("%.0fms"), Report.LateJoinSyncMs) : TEXT("-"),
+			Report.IsCellStateAgreed() ? TEXT("OK") : TEXT("MISMATCH"),
+			Report.ComparedViews - Report.MismatchedViews, Report.ComparedViews);
+	}
+	UE_LOG(LogNetworkTest, Log, TEXT("=============================================================="));
+}
+
+void UNetworkTestSubsystem::ExportSoakReport() const
+{
+	FString CSVContent = TEXT("Preset,ShotsFired,ShotsMissed,AvgOutBytesPerSec,PeakOutBytesPerSec,AvgInBytesPerSec,SyntheticServerRPCCount,MulticastRPCCount,ConnectedClients,LateJoinSyncMs,ComparedViews,MismatchedViews\n");
+	for (const FNetworkSoakPresetReport& Report : SoakReports)
+	{
+		CSVContent += FString::Printf(TEXT("%s,%d,%d,%.1f,%.1f,%.1f,%d,%d,%d,%.1f,%d,%d\n"),
+			*Report.PresetName, Report.ShotsFired, Report.ShotsMissed,
+			Report.AvgOutBytesPerSec, Report.PeakOutBytesPerSec, Report.AvgInBytesPerSec,
+			Report.ServerRPCCount, Report.MulticastRPCCount, Report.ConnectedClients,
+			Report.LateJoinSyncMs, Report.ComparedViews, Report.MismatchedViews);
+	}
+
+	const FString FullPath = FPaths::ProjectSavedDir() / TEXT("Destruction") /
+		FString::Printf(TEXT("Soak_%s.csv"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+
+	if (FFileHelper::SaveStringToFile(CSVContent, *FullPath))
+	{
+		UE_LOG(LogNetworkTest, Log, TEXT("NetworkTestSubsystem: Soak report exported to %s"), *FullPath);
+	}
+	else
+	{
+		UE_LOG(LogNetworkTest, Warning, TEXT("NetworkTestSubsystem: Failed to export soak report to %s"), *FullPath);
+	}
+}
@@ -17,7 +17,9 @@
 namespace UE { namespace Geometry { class FDynamicMesh3; } }
 class UProceduralMeshComponent;
 class URealtimeDestructibleMeshComponent;
-class UBoxComponent;
+class UDebrisCollisionComponent;
+struct FKBoxElem;
+struct FCellDestructionShape;
 
 UCLASS()
 class REALTIMEDESTRUCTION_API ADebrisActor : public AActor
@@ -28,10 +30,10 @@ public:
 	ADebrisActor();
 
 	// Components
-	// Root: BoxComponent (handles physics)
+	// Root: DebrisCollisionComponent (box, or compound boxes on the server; handles physics)
 	// ProceduralMesh handles rendering only
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Debris")
-	TObjectPtr<UBoxComponent> CollisionBox;
+	TObjectPtr<UDebrisCollisionComponent> CollisionBox;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Debris")
 	TObjectPtr<UProceduralMeshComponent> DebrisMesh;
@@ -70,25 +72,117 @@ public:
 	UPROPERTY(Replicated)
 	TObjectPtr<UMaterialInterface> DebrisMaterial;
 
+	/** Mesh is built from the cell bitmap only (secondary debris; the source mesh no longer holds this geometry) */
+	UPROPERTY(Replicated)
+	bool bCellMeshOnly;
+
+	/** Detach event this debris was spawned by (INDEX_NONE: not grouped) */
+	UPROPERTY(Replicated)
+	int32 DetachEventId;
+
+	/** Number of debris spawned by the same detach event (clients wait for all of them to extract in one batch) */
+	UPROPERTY(Replicated)
+	int32 DetachEventSize;
+
+	/**
+	 * The debris came to rest on the server. The actor then goes dormant instead of being torn off,
+	 * so clients that join later or only become relevant later still receive it and bake their own rubble.
+	 * The dormant actor is destroyed when its lifetime ends (at least long enough for clients to bake).
+	 */
+	UPROPERTY(ReplicatedUsing = OnRep_Settled)
+	bool bSettled;
+
 	// Settings
 	UPROPERTY(EditDefaultsOnly, Category = "Debris")
 	float DebrisLifetime;
 
+	/** Bake the debris into static rubble once it comes to rest (see UDebrisManagerSubsystem) */
+	UPROPERTY(EditDefaultsOnly, Category = "Debris|Settle")
+	bool bConsolidateWhenSettled;
+
+	/** Linear speed (cm/s) below which the debris counts as resting */
+	UPROPERTY(EditDefaultsOnly, Category = "Debris|Settle", meta = (ClampMin = "0.0"))
+	float SettleLinearSpeed;
+
+	/** Angular speed (deg/s) below which the debris counts as resting */
+	UPROPERTY(EditDefaultsOnly, Category = "Debris|Settle", meta = (ClampMin = "0.0"))
+	float SettleAngularSpeed;
+
+	/** Time (s) the debris must stay at rest before it is consolidated */
+	UPROPERTY(EditDefaultsOnly, Category = "Debris|Settle", meta = (ClampMin = "0.0"))
+	float SettleTime;
+
+	/** Accept destruction requests against the debris' own cells */
+	UPROPERTY(EditDefaultsOnly, Category = "Debris|Secondary")
+	bool bAllowSecondaryDestruction;
+
+	/** Pieces left with fewer cells than this vanish instead of becoming new debris */
+	UPROPERTY(EditDefaultsOnly, Category = "Debris|Secondary", meta = (ClampMin = "1"))
+	int32 MinSecondaryDebrisCells;
 
 	// public Methods
 	
 	/** Server-only: Initialize debris */
 	void InitializeDebris(int32 InDebrisId, const TArray<int32>& InCellIds, int32 InChunkIndex, URealtimeDestructibleMeshComponent* InSourcMesh, UMaterialInterface* InMaterial);
 
+	/** Server-only: tag the detach event this debris belongs to (see URealtimeDestructibleMeshComponent::AssignDetachEvent) */
+	void SetDetachEvent(int32 InEventId, int32 InEventSize);
+
 	/** Server-only: Enable physics */
 	void EnablePhysics();
 
 	/** Apply local mesh data (called from client) */
 	void ApplyLocalMesh(UProceduralMeshComponent* LocalMesh);
 
+	/**
+	 * Server-only: remove the debris cells inside a sphere and split the rest into connected pieces.
+	 * Pieces below MinSecondaryDebrisCells vanish; the others respawn as cell-built debris.
+	 * Cell-level only: no boolean work on the source mesh.
+	 *
+	 * @param WorldCenter - center of the destruction sphere
+	 * @param WorldRadius - radius of the destruction sphere
+	 * @return True if at least one cell was removed (this actor is destroyed)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Debris")
+	bool ApplyDestruction(const FVector& WorldCenter, float WorldRadius);
+
+	/**
+	 * Server-only: ApplyDestruction for any tool shape (world space).
+	 * Sphere removes cells overlapping the sphere; Line (cylinder tools) removes cells within
+	 * LineThickness of the segment; other types test the cell center.
+	 */
+	bool ApplyDestructionShape(const FCellDestructionShape& WorldShape);
+
+	/**
+	 * Server-only: cells of this debris and where they sit in actor local space.
+	 * Actor local = Cell local (source component space) * InCellScale + InCellOffset.
+	 */
+	void SetCellFrame(const TArray<int32>& InCellIds, float InCellScale, const FVector& InCellOffset);
+
+	/** Server-only: build the visual mesh from CellIds (clients follow through bCellMeshOnly) */
+	void BuildCellMesh();
+
+	/** Server-only: consolidate into rubble now, even if the debris has not come to rest (debris budget downgrade) */
+	void ForceSettle();
+
+	/**
+	 * Client-only: drop this debris from local rendering and physics for the client debris budget.
+	 * The replicated actor cannot be destroyed on a client, so it is baked into rubble or hidden instead.
+	 *
+	 * @param bBakeIntoRubble - bake the mesh into local rubble (falls back to hiding it if the rubble refuses)
+	 */
+	void CullLocally(bool bBakeIntoRubble);
+
 	/** Set box collision extent */
 	void SetCollisionBoxExtent(const FVector& Extent);
 
+	/**
+	 * Server-only: Replace the physics body of CollisionBox with a compound of boxes (actor local space).
+	 * The body setup is owned by CollisionBox, so physics state rebuilds keep the compound; no mesh is built.
+	 * Pass CollisionBox->GetBodyVolume() to the mass computation so mass matches this geometry.
+	 */
+	void SetCompoundCollision(const TArray<FKBoxElem>& Boxes);
+
 	/** Server-only: Set mesh directly using pre-generated mesh data */
 	void SetMeshDirectly(const TArray<FVector>& Vertices,
 		const TArray<int32>& Triangles,
@@ -101,6 +195,10 @@ protected:
 
 	UFUNCTION()
 	void OnRep_DebrisParams();
+
+	/** Client: the debris settled on the server; stop it and bake it into local rubble */
+	UFUNCTION()
+	void OnRep_Settled();
 	
 private:
 	/** Find local mesh by DebrisId */
@@ -115,6 +213,21 @@ private:
 	/** Lifetime expiration callback */
 	void OnLifetimeExpired();
 
+	/** Server-only: periodic rest check */
+	void OnSettleCheck();
+
+	/** Server-only: stop physics, bake into rubble and let the actor go dormant */
+	void Settle();
+
+	/** Client: bake once the mesh exists (it may still be extracting right after a late join) */
+	void TryConsolidateSettled();
+
+	/**
+	 * Hand the visual mesh over to the rubble of this area.
+	 * @return True if the rubble took the mesh; false without a mesh or when the rubble refused it (the piece stays as is)
+	 */
+	bool ConsolidateIntoRubble();
+
 	/** Encode CellIds to bitmap (called from server) */
 	void EncodeCellsToBitmap(const TArray<int32>& InCellIds, const struct FGridCellLayout& GridLayout);
 
@@ -122,4 +235,23 @@ private:
 	void DecodeBitmapToCells(const struct FGridCellLayout& GridLayout);
 
 	bool bMeshReady;
+
+	/** Cell local -> actor local scale (see SetCellFrame) */
+	float CellToLocalScale;
+
+	/** Cell local -> actor local offset (see SetCellFrame) */
+	FVector CellToLocalOffset;
+
+	/** Accumulated time at rest */
+	float SettledTime;
+
+	bool bConsolidated;
+
+	/** Client: removed by the local debris budget (ignores a later settle) */
+	bool bLocallyCulled;
+
+	FTimerHandle SettleTimerHandle;
+
+	/** Server: DebrisLifetime, and after settling the time the dormant actor is kept for clients to bake */
+	FTimerHandle LifetimeTimerHandle;
 };
\ No newline at end of file
@@ -16,6 +16,7 @@
 #include "DynamicMesh/MeshTangents.h"
 #include "DynamicMesh/DynamicMesh3.h"
 #include "HAL/CriticalSection.h"
+#include "Misc/ScopeLock.h"
 
 ////////////////////////////////////////
 /******** forward declaration ********/
@@ -26,6 +27,8 @@ namespace UE::Geometry
 class UDynamicMeshComponent;
 class UPrimitiveComponent;
 struct FRealtimeDestructionOp;
+struct FRealtimeDestructionBulkRequest;
+enum class EDestructionToolShape : uint8;
 struct FGeometryScriptMeshBooleanOptions;
 struct FGeometryScriptPlanarSimplifyOptions;
 enum class EGeometryScriptBooleanOperation : uint8;
@@ -56,6 +59,15 @@ struct FIslandRemovalContext
 
 	/** For cleanup: Disconnected cell IDs (passed to CleanupSmallFragments when all tasks complete) */
 	TSet<int32> DisconnectedCellsForCleanup;
+
+	/** Grid cells of this piece (kept on the spawned debris for secondary destruction) */
+	TArray<int32> PieceCellIds;
+
+	/** For client batch extraction: debris actors of one detach event (the result is split between them) */
+	TArray<TWeakObjectPtr<ADebrisActor>> BatchDebrisActors;
+
+	/** Grid cells of each batched debris actor (same order as BatchDebrisActors) */
+	TArray<TArray<int32>> BatchPieceCellIds;
 };
 
 /** Union result payload for a chunk, including the combined tool mesh and decals. */
@@ -134,6 +146,12 @@ struct FBulletHoleBatch
 	FBulletHoleBatch() = default;
 	~FBulletHoleBatch() = default;
 
+	// The declared destructor suppresses implicit moves; spell them out so queue hand-offs and pooling move buffers instead of copying.
+	FBulletHoleBatch(const FBulletHoleBatch&) = default;
+	FBulletHoleBatch(FBulletHoleBatch&&) = default;
+	FBulletHoleBatch& operator=(const FBulletHoleBatch&) = default;
+	FBulletHoleBatch& operator=(FBulletHoleBatch&&) = default;
+
 	void Reserve(int32 Capacity)
 	{
 		ToolTransforms.Reserve(Capacity);
@@ -144,6 +162,13 @@ struct FBulletHoleBatch
 		CompletionBatchIds.Reserve(Capacity);
 	}
 
+	/** Heap bytes of the per-item arrays (tool meshes are shared and not included). */
+	SIZE_T GetAllocatedSize() const
+	{
+		return ToolTransforms.GetAllocatedSize() + Attempts.GetAllocatedSize() + bIsPenetrations.GetAllocatedSize()
+			+ TemporaryDecals.GetAllocatedSize() + ToolMeshPtrs.GetAllocatedSize() + CompletionBatchIds.GetAllocatedSize();
+	}
+
 	void Reset()
 	{
 		Count = 0;
@@ -185,6 +210,22 @@ struct FBulletHoleBatch
 		Count++;
 	}
 
+	/** Appends a single entry without going through FBulletHole (bulk ingestion path). */
+	void Add(const FTransform& ToolTransform, bool bIsPenetration,
+		const TSharedPtr<UE::Geometry::FDynamicMesh3, ESPMode::ThreadSafe>& ToolMeshPtr, int32 BatchId = INDEX_NONE)
+	{
+		ToolTransforms.Add(ToolTransform);
+		Attempts.Add(0);
+		bIsPenetrations.Add(bIsPenetration);
+		TemporaryDecals.AddDefaulted();
+		ToolMeshPtrs.Add(ToolMeshPtr);
+		if (BatchId != INDEX_NONE)
+		{
+			CompletionBatchIds.AddUnique(BatchId);
+		}
+		Count++;
+	}
+
 	bool Get(FBulletHole& OutOp, int32 Index)
 	{
 		if (Index >= Count)
@@ -208,6 +249,88 @@ struct FBulletHoleBatch
 	int32 Num() const { return Count; }
 };
 
+/**
+ * FIFO of pending ops for one chunk and priority.
+ * Taking ops advances Head instead of shifting the array; the consumed prefix is dropped when the list
+ * drains or once it outgrows the live part, so each op is moved at most a constant number of times.
+ */
+struct FPendingOpList
+{
+	/** Appends an op at the tail. */
+	void Add(FBulletHole&& Op)
+	{
+		Ops.Add(MoveTemp(Op));
+	}
+
+	/** Live op at Index (0 = oldest). */
+	FBulletHole& operator[](int32 Index)
+	{
+		return Ops[Head + Index];
+	}
+
+	/** Live ops, oldest first. */
+	TConstArrayView<FBulletHole> GetOps() const
+	{
+		return TConstArrayView<FBulletHole>(Ops.GetData() + Head, Ops.Num() - Head);
+	}
+
+	/** Drops the Count oldest ops (already moved out by the caller). */
+	void Consume(int32 Count)
+	{
+		check(Count >= 0 && Count <= Num());
+		Head += Count;
+		if (Head == Ops.Num())
+		{
+			Reset();
+		}
+		else if (Head > Ops.Num() - Head)
+		{
+			// Consumed prefix is larger than the live part: compact once (amortized O(1) per op)
+			Ops.RemoveAt(0, Head, EAllowShrinking::No);
+			Head = 0;
+		}
+	}
+
+	bool IsEmpty() const { return Head == Ops.Num(); }
+	int32 Num() const { return Ops.Num() - Head; }
+
+	void Reset()
+	{
+		Ops.Reset();
+		Head = 0;
+	}
+
+	SIZE_T GetAllocatedSize() const { return Ops.GetAllocatedSize(); }
+
+private:
+	TArray<FBulletHole> Ops;
+	/** Index of the oldest live op; entries before it were moved out. */
+	int32 Head = 0;
+};
+
+/**
+ * Ops waiting to be batched for one chunk, split by priority.
+ * Ops past the union limit (or for a busy chunk) simply wait here for a later tick.
+ */
+struct FChunkPendingOps
+{
+	FPendingOpList HighPriority;
+	FPendingOpList NormalPriority;
+
+	/** Whether the chunk is listed in DirtyPendingChunks. */
+	bool bDirty = false;
+
+	bool IsEmpty() const { return HighPriority.IsEmpty() && NormalPriority.IsEmpty(); }
+	int32 Num() const { return HighPriority.Num() + NormalPriority.Num(); }
+
+	void Reset()
+	{
+		HighPriority.Reset();
+		NormalPriority.Reset();
+		bDirty = false;
+	}
+};
+
 /** Per-chunk counters used for simplify scheduling and cost accumulation. */
 struct FChunkState
 {
@@ -254,6 +377,89 @@ struct FChunkProcessState
 	}
 };
 
+/**
+ * Thread-safe free list for transient boolean buffers.
+ * Pooled items keep their heap allocations, so steady-state workers stop round-tripping
+ * through the global allocator. Callers reset item contents before releasing.
+ */
+template<typename ItemType>
+class TBooleanScratchPool
+{
+public:
+	explicit TBooleanScratchPool(int32 InMaxFreeItems = 8)
+		: MaxFreeItems(InMaxFreeItems)
+	{
+	}
+
+	/** Pops a pooled item, or default-constructs one when the pool is empty. */
+	ItemType Acquire()
+	{
+		FScopeLock Lock(&PoolLock);
+		return FreeItems.Num() > 0 ? FreeItems.Pop(EAllowShrinking::No) : ItemType();
+	}
+
+	/** Returns an item to the pool; items beyond MaxFreeItems are freed. */
+	void Release(ItemType&& Item)
+	{
+		FScopeLock Lock(&PoolLock);
+		if (FreeItems.Num() < MaxFreeItems)
+		{
+			FreeItems.Add(MoveTemp(Item));
+		}
+	}
+
+	void Empty()
+	{
+		FScopeLock Lock(&PoolLock);
+		FreeItems.Empty();
+	}
+
+	/** Heap bytes held by pooled items (ItemType must provide GetAllocatedSize). */
+	SIZE_T GetAllocatedSize() const
+	{
+		FScopeLock Lock(&PoolLock);
+		SIZE_T Size = FreeItems.GetAllocatedSize();
+		for (const ItemType& Item : FreeItems)
+		{
+			Size += Item.GetAllocatedSize();
+		}
+		return Size;
+	}
+
+private:
+	mutable FCriticalSection PoolLock;
+	TArray<ItemType> FreeItems;
+	int32 MaxFreeItems = 8;
+};
+
+/** Per-worker scratch meshes reused across union/subtract jobs. */
+struct FBooleanWorkerScratch
+{
+	/** Transformed copy of the current tool mesh. */
+	UE::Geometry::FDynamicMesh3 ToolMesh;
+	/** Output of the pairwise union; swapped with the combined mesh after each step. */
+	UE::Geometry::FDynamicMesh3 UnionMesh;
+	/** Copy of the chunk mesh used as the subtract target. */
+	UE::Geometry::FDynamicMesh3 WorkMesh;
+
+	/** WorkMesh copies above this size are freed on release instead of being kept in the pool. */
+	static constexpr SIZE_T MaxPooledWorkMeshBytes = 2 * 1024 * 1024;
+
+	/** Call before returning to the pool: drops the chunk data, keeping small WorkMesh buffers for reuse. */
+	void ResetForPool()
+	{
+		if (WorkMesh.GetByteCount() > MaxPooledWorkMeshBytes)
+		{
+			WorkMesh.Clear();
+		}
+	}
+
+	SIZE_T GetAllocatedSize() const
+	{
+		return ToolMesh.GetByteCount() + UnionMesh.GetByteCount() + WorkMesh.GetByteCount();
+	}
+};
+
 /**
  * Schedules realtime boolean operations across chunks with batching and async workers.
  * Tracks per-chunk metrics to adapt union size and simplify intervals,
@@ -297,12 +503,19 @@ public:
 	void EnqueueOp(FRealtimeDestructionOp&& Operation, UDecalComponent* TemporaryDecal, UDynamicMeshComponent* ChunkMesh = nullptr, int32 BatchId = -1);
 	/** Re-enqueues remaining requests (including retries). */
 	void EnqueueRemaining(FBulletHole&& Operation);
+	/**
+	 * Enqueues SoA bulk impacts straight into per-chunk batches in a single pass,
+	 * bypassing the per-op priority queues. ShapeToolMeshes is indexed by Bulk.ShapeIds.
+	 * @return Number of items routed to a chunk.
+	 */
+	int32 EnqueueBulk(const FRealtimeDestructionBulkRequest& Bulk,
+		TConstArrayView<TSharedPtr<UE::Geometry::FDynamicMesh3, ESPMode::ThreadSafe>> ShapeToolMeshes);
 	void EnqueueIslandRemoval(int32 ChunkIndex, TSharedPtr<UE::Geometry::FDynamicMesh3> ToolMesh, TSharedPtr<UE::Geometry::FDynamicMesh3> DebrisToolMesh, TSharedPtr<FIslandRemovalContext> Context);
 
 	/**
-	 * Builds per-chunk batches from queued ops and starts workers when work is available.
-	 * Work is available when at least one batch is formed; in single-worker mode it starts only
-	 * if the chunk is not busy, otherwise the batch is re-queued for a later tick.
+	 * Moves queued ops into per-chunk pending lists and starts workers for dirty chunks.
+	 * Each dispatch takes at most MaxUnionCount ops; the rest stay pending. In single-worker mode
+	 * a busy chunk keeps its ops pending for a later tick. A tick with no new work returns immediately.
 	 */
 	void KickProcessIfNeededPerChunk();
 
@@ -317,6 +530,17 @@ public:
 	/** Resolves the chunk index from the component and returns its hole count. */
 	int32 GetChunkHoleCount(const UPrimitiveComponent* ChunkComponent) const;
 
+	/**
+	 * Heap memory held by the processor (bytes): cached chunk mesh copies, pending ops and their tool meshes,
+	 * bulk batches, the batch and worker scratch pools, and per-chunk bookkeeping.
+	 *
+	 * Not counted: results waiting in the MPSC union/subtract queues (a TQueue cannot be walked without
+	 * draining it) and batches or meshes currently owned by worker tasks.
+	 *
+	 * @param ExternallyCountedMeshes - tool meshes the caller already counts (e.g. a shared tool mesh cache)
+	 */
+	SIZE_T GetAllocatedSize(const TSet<const UE::Geometry::FDynamicMesh3*>& ExternallyCountedMeshes = TSet<const UE::Geometry::FDynamicMesh3*>()) const;
+
 	/** Runs a mesh boolean and writes the result into OutputMesh. */
 	static bool ApplyMeshBooleanAsync(const UE::Geometry::FDynamicMesh3* TargetMesh,
 		const UE::Geometry::FDynamicMesh3* ToolMesh,
@@ -344,13 +568,29 @@ public:
 	 */
 	static void ApplyUniformRemesh(UE::Geometry::FDynamicMesh3* TargetMesh, double TargetEdgeLength, int32 NumPasses = 5);
 
+	/**
+	 * Converts a world-space tool placement into the chunk's local space.
+	 * Cylinders are rotated to face ToolForwardWorld; both shapes cancel out the component scale.
+	 */
+	static FTransform MakeLocalToolTransform(const FTransform& ComponentToWorld, EDestructionToolShape ToolShape,
+		const FVector& ToolOriginWorld, const FVector& ToolForwardWorld);
+
 private:	
 	// ===============================================================
 	// Processing Pipeline
 	// ===============================================================
 	void StartBooleanWorkerAsyncForChunk(FBulletHoleBatch&& InBatch, int32 Gen);	
-	void EnqueueRetryOps(TQueue<FBulletHole, EQueueMode::Mpsc>& Queue, FBulletHoleBatch&& InBatch,
-		UDynamicMeshComponent* TargetMesh, int32 ChunkIndex, int32& DebugCount);
+	/** Moves the ops of an undispatched batch back into the chunk's pending list. */
+	void EnqueuePendingOps(FBulletHoleBatch&& InBatch, UDynamicMeshComponent* TargetMesh, int32 ChunkIndex, bool bHighPriority);
+	/** Appends a single op to its chunk's pending list and marks the chunk dirty. */
+	void AddPendingOp(FBulletHole&& Op, int32 ChunkIndex);
+	/**
+	 * Hands a formed chunk batch to a union slot (multi-worker) or a chunk worker (single-worker).
+	 * Busy chunks in single-worker mode keep the ops pending for a later tick.
+	 */
+	void DispatchChunkBatch(FBulletHoleBatch&& Batch, UDynamicMeshComponent* TargetMesh, int32 ChunkIndex, bool bHighPriority);
+	/** Tells the thread manager how many ops wait in ChunkPendingOps, so dynamic scaling sees the real backlog. */
+	void ReportPendingOpsToThreadManager();
 	int32& GetChunkInterval(int32 ChunkIndex);	
 	
 	// ===============================================================
@@ -388,6 +628,14 @@ private:
 
 	void BooleanOpSync(FBulletHole&& Op);
 
+	/**
+	 * Scratch pool for the given slot (single-worker mode uses slot 0).
+	 * Workers hold the returned pointer for the whole job so ShutdownSlots cannot free it underneath them.
+	 */
+	TSharedPtr<TBooleanScratchPool<FBooleanWorkerScratch>, ESPMode::ThreadSafe> GetScratchPool(int32 SlotIndex) const;
+	/** Resets a consumed batch and returns its arrays to BatchPool. */
+	void ReleaseBatch(FBulletHoleBatch&& Batch);
+
 private:
 	// ===============================================================
 	// Processing Pipeline
@@ -425,6 +673,21 @@ private:
 
 	TArray<TSharedPtr<UE::Geometry::FDynamicMesh3, ESPMode::ThreadSafe>> CachedChunkMeshes;
 
+	/** Recycled FBulletHoleBatch storage (acquired on the game thread, released by workers). */
+	TBooleanScratchPool<FBulletHoleBatch> BatchPool{ 32 };
+
+	/** Per-chunk pending ops indexed by ChunkIndex (game thread only). */
+	TArray<FChunkPendingOps> ChunkPendingOps;
+	/** Chunks with pending ops, in first-touched order. */
+	TArray<int32> DirtyPendingChunks;
+	/** Last count sent through ReportPendingOpsToThreadManager (skips redundant reports). */
+	int32 LastReportedPendingOps = 0;
+
+	/** Per-chunk scratch batches for EnqueueBulk (indexed by ChunkIndex, game thread only). */
+	TArray<FBulletHoleBatch> BulkChunkBatches;
+	/** Chunks touched by the current EnqueueBulk call, in first-hit order. */
+	TArray<int32> BulkDirtyChunks;
+
 	// ===============================================================
 	// Simplification & Adaptive Tuning
 	// ===============================================================
@@ -462,6 +725,9 @@ private:
 
 	// Per-slot subtract queues.
 	TArray<TUniquePtr<TQueue<FUnionResult, EQueueMode::Mpsc>>> SlotSubtractQueues;
+
+	// Per-slot scratch pools (only workers of the same slot share a lock).
+	TArray<TSharedPtr<TBooleanScratchPool<FBooleanWorkerScratch>, ESPMode::ThreadSafe>> SlotScratchPools;
 	
 	FCriticalSection MapLock; 
 	
@@ -0,0 +1,57 @@
+﻿// Copyright (c) 2026 LazyDevelopers <lazydeveloper24@gmail.com>. All rights reserved.
+// This plugin is distributed under the Fab Standard License.
+//
+// This product was independently developed by us while participating in the Epic Project, a developer-support
+// program of the KRAFTON JUNGLE GameTech Lab. All rights, title, and interest in and to the product are exclusively
+// vested in us. Krafton, Inc. was not involved in its development and distribution and disclaims all representations
+// and warranties, express or implied, and assumes no responsibility or liability for any consequences arising from
+// the use of this product.
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/BoxComponent.h"
+#include "DebrisCollisionComponent.generated.h"
+
+class UBodySetup;
+struct FKBoxElem;
+
+/**
+ * Box collision root of ADebrisActor that can own a compound body.
+ *
+ * By default it behaves like a UBoxComponent. After SetCompoundBoxes the component returns its own
+ * UBodySetup from GetBodySetup, so every physics state rebuild keeps the compound shape.
+ * BoxExtent stays the bounding box used for bounds and queries.
+ */
+UCLASS(ClassGroup=(RealtimeDestruction))
+class REALTIMEDESTRUCTION_API UDebrisCollisionComponent : public UBoxComponent
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Replace the simple box body with a compound of boxes (component local space) and rebuild the physics state.
+	 * An empty array goes back to the simple box.
+	 */
+	void SetCompoundBoxes(const TArray<FKBoxElem>& Boxes);
+
+	/** True while the compound body is in use */
+	bool HasCompoundBody() const { return CompoundBodySetup != nullptr; }
+
+	/** Volume of the current body geometry in world space (cm^3), component scale applied */
+	float GetBodyVolume() const;
+
+	//~ Begin UPrimitiveComponent Interface
+	virtual UBodySetup* GetBodySetup() override;
+	//~ End UPrimitiveComponent Interface
+
+	//~ Begin UShapeComponent Interface
+	virtual void UpdateBodySetup() override;
+	//~ End UShapeComponent Interface
+
+private:
+	/** Compound body owned by this component (null = simple box) */
+	UPROPERTY(Transient)
+	TObjectPtr<UBodySetup> CompoundBodySetup;
+};
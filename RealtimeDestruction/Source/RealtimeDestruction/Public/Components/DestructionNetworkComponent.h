@@ -14,6 +14,8 @@
 #include "RealtimeDestructibleMeshComponent.h"
 #include "DestructionNetworkComponent.generated.h"
 
+class ADebrisActor;
+
 /**
  * Network component that forwards destruction requests to the server.
  *
@@ -43,6 +45,23 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Destruction")
 	void RequestDestruction(URealtimeDestructibleMeshComponent* DestructComp, const FRealtimeDestructionRequest& Request);
 
+	/**
+	 * Forwards secondary destruction of a debris actor to the server.
+	 * Applied directly with authority; clients send it via ServerApplyDebrisDestruction.
+	 *
+	 * @param Debris - The replicated debris actor that was hit
+	 * @param WorldShape - World-space tool shape of the hit
+	 * @return True if applied (authority) or sent to the server (client)
+	 */
+	bool RequestDebrisDestruction(ADebrisActor* Debris, const FCellDestructionShape& WorldShape);
+
+	/**
+	 * Request authoritative cell state for regions whose checksum diverged (Server RPC)
+	 * Called by RealtimeDestructibleMeshComponent on clients after MulticastCellStateChecksum
+	 */
+	UFUNCTION(Server, Reliable)
+	void ServerRequestCellResync(URealtimeDestructibleMeshComponent* DestructComp, const TArray<int32>& RegionIds);
+
 protected:
 	virtual void BeginPlay() override;
 
@@ -60,6 +79,19 @@ protected:
 	UFUNCTION(Server, Reliable)
 	void ServerApplyDestructionCompact(URealtimeDestructibleMeshComponent* DestructComp, const FCompactDestructionOp& CompactOp);
 
+	/**
+	 * Secondary destruction of a debris actor on server (Server RPC)
+	 * New debris and removal of the hit actor reach clients through replication
+	 */
+	UFUNCTION(Server, Reliable)
+	void ServerApplyDebrisDestruction(ADebrisActor* Debris, const FCellDestructionShape& WorldShape);
+
+	/**
+	 * Deliver authoritative cell state of the requested regions to the requesting client (Client RPC)
+	 */
+	UFUNCTION(Client, Reliable)
+	void ClientApplyCellResync(URealtimeDestructibleMeshComponent* DestructComp, const TArray<int32>& RegionIds, const TArray<FReplicatedDetachedGroup>& RegionCells);
+
 	/**
 	 * Validate destruction request (called on server)
 	 * Calls RealtimeDestructibleMeshComponent's ValidateDestructionRequest
@@ -69,6 +101,12 @@ protected:
 		const FRealtimeDestructionRequest& Request,
 		EDestructionRejectReason& OutReason) const;
 
+	/**
+	 * Validate debris destruction request (called on server)
+	 * Rejects oversized shapes and shapes that do not reach the debris bounds
+	 */
+	bool ValidateDebrisDestructionRequest(ADebrisActor* Debris, const FCellDestructionShape& WorldShape) const;
+
 protected:
 	/** Maximum allowed destruction radius (anti-cheat) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Destruction|Validation")
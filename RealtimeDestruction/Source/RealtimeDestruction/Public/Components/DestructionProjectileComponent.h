@@ -81,6 +81,13 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Destruction")
 	float HoleRadius = 10.0f;
 
+	/**
+	 * Damage added to the cells under the tool shape when the target uses the cell damage model.
+	 * The hit only cuts once a cell reaches its health; 0 always cuts (heavy weapons).
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Destruction", meta = (ClampMin = "0.0"))
+	float CellDamage = 0.0f;
+
 	// Variable for changing Tool Shape
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Destruction|Shape")
 	EDestructionToolShape ToolShape = EDestructionToolShape::Cylinder;
@@ -277,6 +284,12 @@ protected:
 
 private:
 	bool ProcessDestructionRequestForChunk(URealtimeDestructibleMeshComponent* DestructComp, const FHitResult& Hit);
+
+	/** Secondary destruction when the hit actor is debris (clients forward it to the server); false if not debris or nothing removed */
+	bool ProcessDestructionRequestForDebris(AActor* HitActor, const FCellDestructionShape& WorldShape);
+
+	/** World-space cell shape of this projectile's tool at the hit (same shape the source mesh request uses) */
+	FCellDestructionShape MakeDebrisDestructionShape(const FHitResult& Hit) const;
 	
 	bool EnsureToolMesh();
 
@@ -67,6 +67,33 @@ struct REALTIMEDESTRUCTION_API FDestructionToolShapeParams
     // Added UPROPERTY for network serialization
     UPROPERTY()
     float SurfaceMargin = 0.0f;
+
+    /** Exact field-wise comparison (cache keys must not collide on hash alone) */
+    bool operator==(const FDestructionToolShapeParams& Other) const
+    {
+        return Radius == Other.Radius && Height == Other.Height
+            && RadiusSteps == Other.RadiusSteps && HeightSubdivisions == Other.HeightSubdivisions
+            && bCapped == Other.bCapped && StepsPhi == Other.StepsPhi && StepsTheta == Other.StepsTheta
+            && BoxSize == Other.BoxSize && SurfaceMargin == Other.SurfaceMargin;
+    }
+
+    bool operator!=(const FDestructionToolShapeParams& Other) const
+    {
+        return !(*this == Other);
+    }
+
+    friend uint32 GetTypeHash(const FDestructionToolShapeParams& Params)
+    {
+        uint32 Hash = ::GetTypeHash(Params.Radius);
+        Hash = HashCombine(Hash, ::GetTypeHash(Params.Height));
+        Hash = HashCombine(Hash, ::GetTypeHash(Params.RadiusSteps));
+        Hash = HashCombine(Hash, ::GetTypeHash(Params.HeightSubdivisions));
+        Hash = HashCombine(Hash, ::GetTypeHash(Params.bCapped));
+        Hash = HashCombine(Hash, ::GetTypeHash(Params.StepsPhi));
+        Hash = HashCombine(Hash, ::GetTypeHash(Params.StepsTheta));
+        Hash = HashCombine(Hash, ::GetTypeHash(Params.BoxSize));
+        return HashCombine(Hash, ::GetTypeHash(Params.SurfaceMargin));
+    }
 };
 
 USTRUCT(BlueprintType)
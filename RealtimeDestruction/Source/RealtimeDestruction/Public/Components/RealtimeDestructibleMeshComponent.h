@@ -14,6 +14,7 @@
 #include "GeometryScript/MeshBooleanFunctions.h"
 #include "DestructionTypes.h"
 #include "StructuralIntegrity/GridCellTypes.h"
+#include "StructuralIntegrity/StructuralLoadSolver.h"
 #include "PhysicsEngine/BodySetup.h"
 #include "PhysicsEngine/BodyInstance.h"
 #include "RealtimeDestructibleMeshComponent.generated.h"
@@ -29,6 +30,7 @@ class FRealtimeBooleanProcessor;
 class UBulletClusterComponent;
 class UImpactProfileDataAsset;
 class ADebrisActor;
+struct FIslandRemovalContext;
 
 //////////////////////////////////////////////////////////////////////////
 // Destruction Types
@@ -107,6 +109,25 @@ struct REALTIMEDESTRUCTION_API FRealtimeDestructionRequest
 	/** Decal config lookup ID (for network transmission) */
 	UPROPERTY()
 	FName DecalConfigID = FName("Default");
+
+	/**
+	 * Damage added to the cells under the tool shape (cell damage model only).
+	 * 0: cut immediately, as without the damage model.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh", meta = (ClampMin = "0.0"))
+	float Damage = 0.0f;
+
+	/** No cell crossed its health: spawn the decal only (set by the server, replicated with the op) */
+	UPROPERTY()
+	bool bDecalOnly = false;
+
+	/**
+	 * Originating hit (see URealtimeDestructibleMeshComponent::GenerateShotId).
+	 * The per-chunk requests of one hit share it, so the hit's damage is added once.
+	 * 0: every request is a separate hit.
+	 */
+	UPROPERTY()
+	uint32 ShotId = 0;
 	
 };
 
@@ -188,6 +209,18 @@ struct REALTIMEDESTRUCTION_API FCompactDestructionOp
 	UPROPERTY()
 	FName SurfaceType = FName("Default");
 
+	// Cell damage: whole points, 0-65535 (2 bytes)
+	UPROPERTY()
+	uint16 Damage = 0;
+
+	// Decal only, no boolean (1 bit)
+	UPROPERTY()
+	bool bDecalOnly = false;
+
+	// Originating hit, low 16 bits (2 bytes)
+	UPROPERTY()
+	uint16 ShotId = 0;
+
 	// Compress
 	static FCompactDestructionOp Compress(const FRealtimeDestructionRequest& Request, int32 Seq);
 
@@ -195,6 +228,183 @@ struct REALTIMEDESTRUCTION_API FCompactDestructionOp
 	FRealtimeDestructionRequest Decompress() const;
 };
 
+/**
+ * Server-computed detached cell group, run-length encoded for replication.
+ *
+ * Flood-filled groups are mostly contiguous along the X axis of the grid,
+ * so sorted cell IDs collapse into a handful of (Start, Length) runs.
+ */
+USTRUCT()
+struct REALTIMEDESTRUCTION_API FReplicatedDetachedGroup
+{
+	GENERATED_BODY()
+
+	// First cell ID of each run
+	UPROPERTY()
+	TArray<int32> RangeStarts;
+
+	// Number of consecutive cell IDs in each run
+	UPROPERTY()
+	TArray<uint16> RangeLengths;
+
+	// Encode
+	static FReplicatedDetachedGroup Encode(const TArray<int32>& CellIds);
+
+	// Decode
+	void Decode(TArray<int32>& OutCellIds) const;
+
+	int32 NumCells() const;
+};
+
+/**
+ * Rolling hash of one cell-state sync region (Server → Client)
+ * Only regions that contain destroyed/detached cells are sent.
+ */
+USTRUCT()
+struct REALTIMEDESTRUCTION_API FCellRegionChecksum
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 RegionId = INDEX_NONE;
+
+	UPROPERTY()
+	uint32 Hash = 0;
+};
+
+/** Key of the tool mesh cache: shape plus full parameters, compared field by field. */
+struct FToolMeshCacheKey
+{
+	EDestructionToolShape ToolShape = EDestructionToolShape::Cylinder;
+	FDestructionToolShapeParams ShapeParams;
+
+	bool operator==(const FToolMeshCacheKey& Other) const
+	{
+		return ToolShape == Other.ToolShape && ShapeParams == Other.ShapeParams;
+	}
+
+	friend uint32 GetTypeHash(const FToolMeshCacheKey& Key)
+	{
+		return HashCombine(::GetTypeHash(static_cast<uint8>(Key.ToolShape)), GetTypeHash(Key.ShapeParams));
+	}
+};
+
+/**
+ * Structure-of-arrays destruction input for high-volume callers (shotgun spreads, area weapons).
+ *
+ * Per-item data lives in parallel arrays and tool shapes are referenced through a small palette,
+ * so each tool mesh is built once per palette entry instead of once per request.
+ * Decals, clustering and network replication are not handled on this path.
+ */
+struct REALTIMEDESTRUCTION_API FRealtimeDestructionBulkRequest
+{
+	/** Shape palette referenced by ShapeIds. */
+	TArray<EDestructionToolShape> ToolShapes;
+	TArray<FDestructionToolShapeParams> ShapeParams;
+
+	/** Per-item impact points (world space). */
+	TArray<FVector> ImpactPoints;
+	/** Per-item tool directions (world space, normalized). */
+	TArray<FVector> ToolForwardVectors;
+	/** Per-item index into the shape palette. */
+	TArray<uint8> ShapeIds;
+	/** Per-item cell damage (cell damage model). Empty: every item cuts immediately. */
+	TArray<float> Damages;
+
+	/** Routes every item through the high priority queue path. */
+	bool bIsPenetration = false;
+
+	/** Registers a palette entry and returns its ShapeId. */
+	uint8 AddShape(EDestructionToolShape ToolShape, const FDestructionToolShapeParams& Params)
+	{
+		check(ToolShapes.Num() < MAX_uint8);
+		ToolShapes.Add(ToolShape);
+		ShapeParams.Add(Params);
+		return static_cast<uint8>(ToolShapes.Num() - 1);
+	}
+
+	void Add(const FVector& ImpactPoint, const FVector& ToolForwardVector, uint8 ShapeId)
+	{
+		ImpactPoints.Add(ImpactPoint);
+		ToolForwardVectors.Add(ToolForwardVector);
+		ShapeIds.Add(ShapeId);
+	}
+
+	/** Adds an item resolved against the cell damage model (use either overload for a whole bulk). */
+	void Add(const FVector& ImpactPoint, const FVector& ToolForwardVector, uint8 ShapeId, float Damage)
+	{
+		Add(ImpactPoint, ToolForwardVector, ShapeId);
+		Damages.Add(Damage);
+	}
+
+	void Reserve(int32 Capacity)
+	{
+		ImpactPoints.Reserve(Capacity);
+		ToolForwardVectors.Reserve(Capacity);
+		ShapeIds.Reserve(Capacity);
+		Damages.Reserve(Capacity);
+	}
+
+	/** Clears per-item data but keeps the palette and allocations for reuse. */
+	void Reset()
+	{
+		ImpactPoints.Reset();
+		ToolForwardVectors.Reset();
+		ShapeIds.Reset();
+		Damages.Reset();
+	}
+
+	int32 Num() const { return ImpactPoints.Num(); }
+
+	/** Returns whether the parallel arrays are consistent and every ShapeId references the palette. */
+	bool IsValid() const
+	{
+		if (ToolShapes.Num() != ShapeParams.Num()
+			|| ToolForwardVectors.Num() != ImpactPoints.Num()
+			|| ShapeIds.Num() != ImpactPoints.Num()
+			|| (Damages.Num() != 0 && Damages.Num() != ImpactPoints.Num()))
+		{
+			return false;
+		}
+
+		for (const uint8 ShapeId : ShapeIds)
+		{
+			if (!ToolShapes.IsValidIndex(ShapeId))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+};
+
+/**
+ * Impact response of one material slot of the source mesh.
+ * Cells are baked to the slot covering most of them (BuildGridCells), so impacts
+ * resolve their attributes from the hit cell without physical material traces.
+ */
+USTRUCT(BlueprintType)
+struct REALTIMEDESTRUCTION_API FCellMaterialAttributes
+{
+	GENERATED_BODY()
+
+	/** Material slot of the source static mesh */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh")
+	FName MaterialSlotName;
+
+	/** Surface type for impact profile / decal lookup (None: component SurfaceType) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh")
+	FName SurfaceType;
+
+	/** Cell health multiplier (cell damage model) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh", meta = (ClampMin = "0.01"))
+	float Strength = 1.0f;
+
+	/** Tool radius multiplier for impacts on these cells */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh", meta = (ClampMin = "0.1", ClampMax = "10.0"))
+	float ToolSizeScale = 1.0f;
+};
+
 USTRUCT(BlueprintType)
 struct REALTIMEDESTRUCTION_API FRealtimeMeshSnapshot
 {
@@ -207,6 +417,57 @@ struct REALTIMEDESTRUCTION_API FRealtimeMeshSnapshot
 	TArray<uint8> Payload;
 };
 
+/**
+ * Heap memory held by one destructible mesh component, per subsystem (bytes).
+ * Container sizes come from GetAllocatedSize (reserved capacity, not element count);
+ * UObjects owned elsewhere (decal components, debris actors, body setups) are not included.
+ */
+USTRUCT(BlueprintType)
+struct REALTIMEDESTRUCTION_API FRealtimeDestructionMemoryStats
+{
+	GENERATED_BODY()
+
+	/** FDynamicMesh3 data of this component and its ChunkMeshComponents */
+	UPROPERTY(BlueprintReadOnly, Category = "RealtimeDestructibleMesh|Memory")
+	int64 ChunkMeshBytes = 0;
+
+	/** Boolean processor: cached chunk mesh copies, pending ops, per-chunk bookkeeping */
+	UPROPERTY(BlueprintReadOnly, Category = "RealtimeDestructibleMesh|Memory")
+	int64 BooleanProcessorBytes = 0;
+
+	/** GridCellLayout (bitfields, sparse cell arrays, cached source triangles) */
+	UPROPERTY(BlueprintReadOnly, Category = "RealtimeDestructibleMesh|Memory")
+	int64 GridLayoutBytes = 0;
+
+	/** CellState, SupercellState and removal templates */
+	UPROPERTY(BlueprintReadOnly, Category = "RealtimeDestructibleMesh|Memory")
+	int64 CellStateBytes = 0;
+
+	/** Connectivity scratch, load solver and support contacts */
+	UPROPERTY(BlueprintReadOnly, Category = "RealtimeDestructibleMesh|Memory")
+	int64 StructuralBytes = 0;
+
+	/** Server cell collision chunks */
+	UPROPERTY(BlueprintReadOnly, Category = "RealtimeDestructibleMesh|Memory")
+	int64 CollisionBytes = 0;
+
+	/** Op history, late join snapshot, server batches, pending results and tool mesh cache */
+	UPROPERTY(BlueprintReadOnly, Category = "RealtimeDestructibleMesh|Memory")
+	int64 OpHistoryBytes = 0;
+
+	/** Decal bookkeeping */
+	UPROPERTY(BlueprintReadOnly, Category = "RealtimeDestructibleMesh|Memory")
+	int64 DecalBytes = 0;
+
+	/** Debris bookkeeping maps */
+	UPROPERTY(BlueprintReadOnly, Category = "RealtimeDestructibleMesh|Memory")
+	int64 DebrisBytes = 0;
+
+	/** Sum of all categories */
+	UPROPERTY(BlueprintReadOnly, Category = "RealtimeDestructibleMesh|Memory")
+	int64 TotalBytes = 0;
+};
+
 USTRUCT()
 struct FRealtimeDestructibleMeshComponentInstanceData : public FActorComponentInstanceData
 {
@@ -342,11 +603,36 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "RealtimeDestructibleMesh")
 	int32 EnqueueBatch(const TArray<FRealtimeDestructionRequest>& Requests);
 
+	/**
+	 * Enqueues many impacts in one call without building per-item request/op structs.
+	 * Updates cell state for every item and feeds per-chunk boolean batches directly.
+	 * With the cell damage model, items below CellHealth are dropped (Bulk.Damages).
+	 * Standalone only: bulk items bypass the server batch (multicast, op history, late join),
+	 * so networked games must use RequestDestruction.
+	 * @return Number of items routed to a chunk (0 if the bulk is invalid or the game is networked).
+	 */
+	int32 EnqueueBulk(const FRealtimeDestructionBulkRequest& Bulk);
+
 	UFUNCTION(BlueprintCallable, Category = "RealtimeDestructibleMesh")
 	bool RequestDestruction(const FRealtimeDestructionRequest& Request);
 
 	UFUNCTION(BlueprintCallable, Category = "RealtimeDestructibleMesh")
 	bool ExecuteDestructionInternal(const FRealtimeDestructionRequest& Request);
+
+	/**
+	 * Cell damage model (authority only, no-op elsewhere): add Request.Damage to the cells under the tool shape.
+	 * The damage is consumed (set to 0) and bDecalOnly is set when no cell reached CellHealth,
+	 * so resolving a request twice is harmless and the decision replicates with the op.
+	 * Requests sharing a ShotId (per-chunk fan-out of one hit) add the damage once.
+	 */
+	void ResolveCellDamage(FRealtimeDestructionRequest& InOutRequest);
+
+	/** New ShotId for the requests of one hit (never 0, differs between machines) */
+	static uint32 GenerateShotId();
+
+	/** Accumulated damage of a cell (0 if never hit) */
+	UFUNCTION(BlueprintCallable, Category = "RealtimeDestructibleMesh|CellDamage")
+	float GetCellDamage(int32 CellId) const { return CellState.GetCellDamage(CellId); }
 	
 	UFUNCTION(Server, Reliable, WithValidation)
 	void ServerEnqueueOps(const TArray<FRealtimeDestructionRequest>& Requests);
@@ -368,10 +654,22 @@ public:
 
 	/**
 	 * Detach signal RPC (Server → Client)
-	 * Clients run their own BFS to calculate detached cells
+	 * Carries the detached groups computed by the server; clients apply them directly without running BFS
+	 * @param DetachedGroups - Groups detached since the last flush (may be empty)
 	 */
 	UFUNCTION(NetMulticast, Reliable)
-	void MulticastDetachSignal();
+	void MulticastDetachSignal(const TArray<FReplicatedDetachedGroup>& DetachedGroups);
+
+	/**
+	 * Cell state checksum RPC (Server → Client, periodic)
+	 * Clients compare against their own region hashes and request a resync for regions that stay diverged.
+	 * Each call covers one slice of region IDs so the payload stays bounded (MaxCellChecksumRegionsPerRPC).
+	 * @param RegionRangeBegin - First region ID covered by this call
+	 * @param RegionRangeEnd - One past the last region ID covered (MAX_int32 = through the end)
+	 * @param RegionChecksums - Hashes of the covered regions with destroyed/detached cells
+	 */
+	UFUNCTION(NetMulticast, Unreliable)
+	void MulticastCellStateChecksum(int32 RegionRangeBegin, int32 RegionRangeEnd, const TArray<FCellRegionChecksum>& RegionChecksums);
 
 	/** Destruction request rejection RPC (Server → Requesting client) */
 	UFUNCTION(Client, Reliable)
@@ -468,6 +766,47 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|ServerBatching")
 	bool bUseCompactMulticast = true;
 
+	//////////////////////////////////////////////////////////////////////////
+	// Cell State Checksum / Region Resync
+	//////////////////////////////////////////////////////////////////////////
+
+	/** Whether the server periodically broadcasts region hashes so clients can detect and repair drift */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|Replication")
+	bool bEnableCellStateChecksum = false;
+
+	/** Checksum broadcast interval (seconds) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|Replication", meta = (ClampMin = "0.5", ClampMax = "60.0", EditCondition = "bEnableCellStateChecksum"))
+	float CellStateChecksumInterval = 5.0f;
+
+	/** Sync region edge length in cells (region = RegionSize^3 cells) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|Replication", meta = (ClampMin = "2", ClampMax = "32", EditCondition = "bEnableCellStateChecksum"))
+	int32 CellStateRegionSize = 8;
+
+	/** Max regions per resync request */
+	static constexpr int32 MaxCellResyncRegionsPerRequest = 32;
+
+	/** Max region hashes per MulticastCellStateChecksum (~1 KB); more damaged regions are covered over several intervals */
+	static constexpr int32 MaxCellChecksumRegionsPerRPC = 128;
+
+	/**
+	 * Server: Collect authoritative destroyed/detached cells of the given regions
+	 * @param RegionIds - Requested region IDs (invalid IDs yield empty entries)
+	 * @param OutRegionCells - One encoded cell list per RegionIds entry
+	 */
+	void BuildCellRegionResync(const TArray<int32>& RegionIds, TArray<FReplicatedDetachedGroup>& OutRegionCells) const;
+
+	/**
+	 * Client: Replace local cell state of the given regions with the server's
+	 * Missing cells are removed from the mesh like late join; cells destroyed only locally are restored in CellState
+	 */
+	void ApplyCellRegionResync(const TArray<int32>& RegionIds, const TArray<FReplicatedDetachedGroup>& RegionCells);
+
+	/** Per-player time of the last accepted resync request (server only) */
+	TMap<TWeakObjectPtr<APlayerController>, double> PlayerCellResyncTimes;
+
+	/** Resync cooldown check (called on server); rejects requests within CellStateChecksumInterval of the last one */
+	bool CheckCellResyncCooldown(APlayerController* Player);
+
 	//////////////////////////////////////////////////////////////////////////
 	// Late Join: Op History-based Synchronization
 	//////////////////////////////////////////////////////////////////////////
@@ -535,6 +874,36 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|HoleDecal")
 	FName SurfaceType = FName("Default");
 
+	/**
+	 * Impact response per material slot (surface type, strength, tool size).
+	 * Slots not listed use SurfaceType with no scaling. Requires BuildGridCells after slot changes.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|CellMaterial")
+	TArray<FCellMaterialAttributes> CellMaterialAttributes;
+
+	/**
+	 * Material attributes of the cell hit at a surface point (nullptr: slot not listed or not baked).
+	 * The point is pushed against the normal so a surface hit resolves to the cell behind the face.
+	 */
+	const FCellMaterialAttributes* FindCellMaterialAttributes(const FVector& WorldPoint, const FVector& WorldNormal) const;
+
+	/** Material attributes of a cell (nullptr: slot not listed or not baked) */
+	const FCellMaterialAttributes* FindCellMaterialAttributesForCell(int32 CellId) const;
+
+	/** Surface type at an impact point (SurfaceType if the cell has none) */
+	UFUNCTION(BlueprintCallable, Category = "RealtimeDestructibleMesh|CellMaterial")
+	FName GetSurfaceTypeAt(const FVector& WorldPoint, const FVector& WorldNormal) const;
+
+	/** Cell health multiplier of a cell (1 if its slot is not listed) */
+	UFUNCTION(BlueprintCallable, Category = "RealtimeDestructibleMesh|CellMaterial")
+	float GetCellStrength(int32 CellId) const;
+
+	/**
+	 * Apply the impact cell's material to a request: surface type and tool size.
+	 * A scaled tool gets its mesh from the shape cache; ShapeParams carry the scale over the network.
+	 */
+	void ApplyCellMaterialAttributes(FRealtimeDestructionRequest& InOutRequest);
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|Advanced|StructuralIntegrity")
 	bool bEnableSubcell = true;
 
@@ -560,6 +929,11 @@ public:
 	TSharedPtr<FDynamicMesh3, ESPMode::ThreadSafe> CreateToolMeshPtrFromShapeParams(
 		EDestructionToolShape ToolShape,
 		const FDestructionToolShapeParams& ShapeParams);
+
+	/** Tool mesh for a shape, built once per distinct ShapeParams (BulkToolMeshCache) */
+	TSharedPtr<FDynamicMesh3, ESPMode::ThreadSafe> GetCachedToolMesh(
+		EDestructionToolShape ToolShape,
+		const FDestructionToolShapeParams& ShapeParams);
 	float GetAngleThreshold() const { return AngleThreshold; }
 	double GetSubtractDurationLimit() const { return SubtractDurationLimit; }
 	int32 GetInitInterval() const { return InitInterval; }
@@ -730,6 +1104,60 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|StructuralIntegrity")
 	bool bEnableStructuralIntegrity = true;
 
+	/**
+	 * Load-aware collapse (server only), solved on the supercell graph.
+	 * Supercells carry the weight of the cells they support; when the cell links under an
+	 * overloaded supercell fail, whatever it supported detaches, even if a thin anchor path still exists.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|StructuralIntegrity")
+	bool bEnableLoadCollapse = false;
+
+	/** Material density for cell mass (kg/m^3, concrete ~2400) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|StructuralIntegrity", meta = (EditCondition = "bEnableLoadCollapse", ClampMin = "1.0"))
+	float LoadCellDensity = 2400.0f;
+
+	/** Load (kg) one cell link pointing down (world gravity) can carry */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|StructuralIntegrity", meta = (EditCondition = "bEnableLoadCollapse", ClampMin = "0.0"))
+	float LoadVerticalLinkCapacity = 50000.0f;
+
+	/** Load (kg) one cell link to a side or upper neighbor can carry (overhangs, cantilevers) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|StructuralIntegrity", meta = (EditCondition = "bEnableLoadCollapse", ClampMin = "0.0"))
+	float LoadLateralLinkCapacity = 5000.0f;
+
+	/** Time budget per frame for the load solve (ms) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|StructuralIntegrity", meta = (EditCondition = "bEnableLoadCollapse", ClampMin = "0.05", ClampMax = "10.0"))
+	float LoadSolverBudgetMs = 0.5f;
+
+	/**
+	 * Destructible actors this mesh rests on (server only).
+	 * Boundary cells touching a supporter's boundary cells act as anchors while those supporter
+	 * cells are alive; when the supporter loses them, only the affected contact cells are re-checked.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|StructuralIntegrity")
+	TArray<TObjectPtr<AActor>> SupportingActors;
+
+	/** Gap (cm) still treated as contact when matching cells against a supporter */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|StructuralIntegrity", meta = (ClampMin = "0.0"))
+	float SupportContactTolerance = 1.0f;
+
+	//=========================================================================
+	// Cell Damage (cumulative per-cell health)
+	//=========================================================================
+
+	/**
+	 * Accumulate impact damage per cell (server authoritative).
+	 * A hit only cuts geometry once a cell under its tool shape reaches CellHealth;
+	 * weaker hits leave a decal only. Requests with Damage 0 always cut.
+	 * A breaking hit cuts its whole tool shape (one boolean per hit), so cells under it
+	 * that were still below CellHealth are removed along with the broken ones.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|CellDamage")
+	bool bEnableCellDamage = false;
+
+	/** Damage a cell absorbs before it breaks */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|CellDamage", meta = (EditCondition = "bEnableCellDamage", ClampMin = "1.0"))
+	float CellHealth = 100.0f;
+
 	/** Quantized destruction input history (for NarrowPhase) */
 	UPROPERTY()
 	TArray<FQuantizedDestructionInput> DestructionInputHistory;
@@ -806,6 +1234,46 @@ public:
 	UFUNCTION(BlueprintPure, Category = "RealtimeDestructibleMesh|GridCell")
 	bool IsGridCellLayoutValid() const { return GridCellLayout.IsValid(); }
 
+	/**
+	 * Recompute support contacts with SupportingActors (server only).
+	 * Runs once automatically the tick after BeginPlay; call again after moving either mesh.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RealtimeDestructibleMesh|StructuralIntegrity")
+	void RebuildSupportContacts();
+
+	/**
+	 * Add or remove the anchor flag on cells at runtime (server only).
+	 * Removing anchors re-checks only the cells that lost their flag; whatever can no longer
+	 * reach an anchor detaches and is replicated like any other detach. Adding anchors never
+	 * detaches anything and only refreshes the load solve.
+	 *
+	 * @param CellIds - grid cell IDs (destroyed or empty cells are ignored)
+	 * @param bAnchored - true to add anchors, false to remove them
+	 * @return Number of cells whose anchor flag changed
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RealtimeDestructibleMesh|StructuralIntegrity")
+	int32 SetCellsAnchored(const TArray<int32>& CellIds, bool bAnchored);
+
+	/** Anchor every cell whose center lies in the box (server only, same test as AAnchorVolumeActor) */
+	UFUNCTION(BlueprintCallable, Category = "RealtimeDestructibleMesh|StructuralIntegrity")
+	int32 AddAnchorsInBox(const FTransform& BoxTransform, FVector BoxExtent);
+
+	/** Release every anchor whose cell center lies in the box (server only) */
+	UFUNCTION(BlueprintCallable, Category = "RealtimeDestructibleMesh|StructuralIntegrity")
+	int32 RemoveAnchorsInBox(const FTransform& BoxTransform, FVector BoxExtent);
+
+	/** Anchor every cell whose center lies in the sphere (server only) */
+	UFUNCTION(BlueprintCallable, Category = "RealtimeDestructibleMesh|StructuralIntegrity")
+	int32 AddAnchorsInSphere(FVector Center, float Radius);
+
+	/** Release every anchor whose cell center lies in the sphere (server only) */
+	UFUNCTION(BlueprintCallable, Category = "RealtimeDestructibleMesh|StructuralIntegrity")
+	int32 RemoveAnchorsInSphere(FVector Center, float Radius);
+
+	/** Heap memory held by this component, per subsystem (for memory budgets and regression tracking) */
+	UFUNCTION(BlueprintCallable, Category = "RealtimeDestructibleMesh|Memory")
+	FRealtimeDestructionMemoryStats GetMemoryStats() const;
+
 private:
 	/**
 	 * Extract DynamicMesh from GeometryCollection (actual implementation)
@@ -842,14 +1310,100 @@ public:
 	 */
 	void UpdateCellStateFromDestruction(const FRealtimeDestructionRequest& Request);
 	FDestructionResult DestructionLogic(const FRealtimeDestructionRequest& Request);
+	FDestructionResult DestructionLogic(const FCellDestructionShape& Shape);
 	void DisconnectedCellStateLogic(const TArray< FDestructionResult>& AllResults, bool bForceRun = false);
 
+	/** Group disconnected cells, spawn debris / remove triangles, and move them to destroyed */
+	void HandleDisconnectedCells(const TSet<int32>& DisconnectedCells);
+
+	/** Advance LoadSolver and crack the overloaded supercell off its supports */
+	void TickLoadCollapse();
+
+	/** Contact between this mesh and one supporting mesh */
+	struct FStructuralSupportLink
+	{
+		TWeakObjectPtr<URealtimeDestructibleMeshComponent> Supporter;
+
+		/** Supporter cell -> contact cells of this mesh resting on it */
+		TMap<int32, TArray<int32>> SupporterToContactCells;
+
+		/** Contact cell -> supporter cells still alive under it */
+		TMap<int32, int32> ContactSupportCount;
+	};
+
+	/** Match boundary cells against one supporter and anchor the contact cells */
+	void AddSupportContacts(URealtimeDestructibleMeshComponent* Supporter);
+
+	/** Drop every support link and restore the anchor flags they added */
+	void ClearSupportContacts();
+
+	/** Called by a supporter when cells this mesh may rest on are destroyed or detached */
+	void OnSupporterCellsLost(const URealtimeDestructibleMeshComponent* Supporter, const TArray<int32>& LostCellIds);
+
+	/** Forward lost cells that something rests on to the supported meshes */
+	void NotifySupportedComponents(const TArray<int32>& LostCellIds);
+
+	/**
+	 * Connectivity search seeded from cells that just lost their anchor flag; detaches and
+	 * replicates whatever no longer reaches an anchor.
+	 * @return Number of detached cells
+	 */
+	int32 DetachCellsFromReleasedAnchors(const TArray<int32>& ReleasedCells);
+
+	/** Existing cells whose center lies in the oriented box */
+	void CollectCellsInWorldBox(const FTransform& BoxTransform, const FVector& BoxExtent, TArray<int32>& OutCellIds) const;
+
+	/** Existing cells whose center lies in the sphere */
+	void CollectCellsInWorldSphere(const FVector& Center, float Radius, TArray<int32>& OutCellIds) const;
+
+	/** Visit only the cells overlapping WorldBounds and keep those whose world center passes ContainsWorldPoint */
+	void CollectCellsInWorldBounds(const FBox& WorldBounds, TFunctionRef<bool(const FVector&)> ContainsWorldPoint, TArray<int32>& OutCellIds) const;
+
+	/** Links to the meshes this mesh rests on */
+	TArray<FStructuralSupportLink> SupportLinks;
+
+	/** Contact cell -> links anchoring it (cells that were anchors on their own are not listed) */
+	TMap<int32, int32> SupportAnchorRefs;
+
+	/** Meshes resting on this mesh */
+	TArray<TWeakObjectPtr<URealtimeDestructibleMeshComponent>> SupportedComponents;
+
+	/** Own cells some supported mesh rests on (filter for NotifySupportedComponents) */
+	TSet<int32> SupportWatchedCells;
+
 	float CalculateDebrisBoundsExtent(const TArray<int32>& CellIds) const;
 
 	/**
 	 * Function used for arbitrary destruction (currently called based on bullet count in Supercell)
 	 */
 	void ForceRemoveSupercell(int32 SuperCellId);
+
+	/**
+	 * Cached removal geometry for one supercell shape (cell existence mask).
+	 * Meshes and piece cell coords are stored relative to the supercell min corner and shared read-only.
+	 */
+	struct FSupercellRemovalTemplate
+	{
+		TArray<TSharedPtr<FDynamicMesh3>> ToolMeshes;
+		TArray<TSharedPtr<FDynamicMesh3>> DebrisToolMeshes;
+		TArray<TArray<FIntVector>> PieceCellCoords;
+
+		/** Build parameters; the template is rebuilt when any of them changes. */
+		FVector CellSize = FVector::ZeroVector;
+		float ExpandRatio = 0.0f;
+		float ScaleRatio = 0.0f;
+		int32 SplitCount = 0;
+	};
+
+	/** Returns the removal template for the supercell's shape, building it on first use (nullptr if not cacheable). */
+	const FSupercellRemovalTemplate* FindOrBuildSupercellRemovalTemplate(int32 SuperCellId, const TArray<int32>& CellsInSupercell);
+
+	/** Places the template at the supercell, collects overlapping cells and optionally enqueues the island removal. */
+	void ApplySupercellRemovalTemplate(const FSupercellRemovalTemplate& Template, int32 SuperCellId, const TArray<int32>& CellsInSupercell,
+		bool bEnqueueRemoval, TArray<int32>* OutToolMeshOverlappingCellIds);
+
+	/** Removal templates keyed by supercell cell existence mask. */
+	TMap<uint64, FSupercellRemovalTemplate> SupercellRemovalTemplates;
 	
 	UFUNCTION(NetMulticast, Reliable)  
 	void MulticastForceRemoveSupercell(int32 SuperCellId);
@@ -861,6 +1415,13 @@ public:
 	 */
 	int32 GridCellIdToChunkId(int32 GridCellId) const;
 
+	/**
+	 * Convert a component-local position to ChunkId
+	 * @param LocalPosition - Position in component space
+	 * @return Corresponding ChunkId, INDEX_NONE if not found
+	 */
+	int32 LocalPositionToChunkId(const FVector& LocalPosition) const;
+
 	/**
 	 * Remove mesh of detached cells via Boolean Subtract
 	 * @param DetachedCellIds - Array of detached cell IDs
@@ -882,7 +1443,18 @@ public:
 	/** Build ToolMesh from sorted voxel piece (GreedyMesh + FillHoles + HC Laplacian Smoothing). */
 	FDynamicMesh3 BuildSmoothedToolMesh(TArray<FIntVector>& SortedPiece);
 
-	/** Collect grid cell IDs that overlap with the given mesh using SAT triangle-AABB intersection. */
+	/** Split detached cells into voxel pieces (DebrisSplitCount), or a single piece if bSinglePiece. */
+	void BuildDetachedPieces(const TArray<int32>& DetachedCellIds, bool bSinglePiece, TArray<TArray<FIntVector>>& OutPieces) const;
+
+	/** Build subtract (expanded) and debris (scaled, smoothed) tool meshes for one piece, oriented for boolean. */
+	bool BuildPieceToolMeshes(TArray<FIntVector>& Piece, FDynamicMesh3& OutToolMesh, FDynamicMesh3& OutDebrisToolMesh);
+
+	/** Enqueue island removal of one piece on every chunk its tool mesh overlaps. */
+	void EnqueuePieceRemoval(const TSharedPtr<FDynamicMesh3>& SharedToolMesh, const TSharedPtr<FDynamicMesh3>& SharedDebrisToolMesh,
+		const TArray<int32>& DetachedCellIds, ADebrisActor* TargetDebrisActor, int32 PieceIndex, int32 NumPieces, int32 PieceCellCount,
+		TArray<int32>&& PieceCellIds = TArray<int32>());
+
+	/** Collect grid cell IDs that overlap with the given mesh (conservative rasterization, confirmed by SAT triangle-AABB test). */
 	void CollectCellsOverlappingMesh(const FDynamicMesh3& Mesh, TArray<int32>& OutCellIds);
 
 	FDynamicMesh3 GenerateGreedyMeshFromVoxels(const TArray<FIntVector>& InVoxels, FVector InCellOrigin, FVector InCellSize, double InBoxExpand = 1.0f );
@@ -926,10 +1498,35 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|Debris", meta = (ClampMin = "0", ClampMax = "1.0"))
 	float DebrisScaleRatio = 0.7f;
 
-	void SpawnDebrisActor(FDynamicMesh3&& Source, const TArray<UMaterialInterface*>& Materials, ADebrisActor* TargetActgor = nullptr);
+	/** PieceCellIds: grid cells of the piece (server keeps them on the debris for secondary destruction) */
+	void SpawnDebrisActor(FDynamicMesh3&& Source, const TArray<UMaterialInterface*>& Materials, ADebrisActor* TargetActgor = nullptr,
+		const TArray<int32>* PieceCellIds = nullptr);
+
+	/**
+	 * Spawn Debris for dedicated server (mesh-free proxy: merged cell boxes, no boolean work)
+	 *
+	 * @param OutEventActors - if set, spawned actors are appended and the caller tags the detach event;
+	 *                         otherwise the pieces of this call form their own detach event
+	 */
+	void SpawnDebrisActorForDedicatedServer(const TArray<int32>& DetachedCellIds, TArray<ADebrisActor*>* OutEventActors = nullptr);
+
+	/** Server-only: tag debris spawned by one detach event so clients extract them in one batch */
+	void AssignDetachEvent(const TArray<ADebrisActor*>& EventActors);
+
+	/**
+	 * Server-only: spawn a debris piece split off an existing debris actor (secondary destruction).
+	 * Mesh and collision are built from the cells only (greedy cell mesh + merged boxes), no boolean work.
+	 *
+	 * @param PieceCellIds - cells of the new piece (grid of this component)
+	 * @param CellToWorld - maps this component's local cell space to world space through the parent debris
+	 * @param LinearVelocity - velocity inherited from the parent debris
+	 * @param AngularVelocity - angular velocity (deg/s) inherited from the parent debris
+	 */
+	void SpawnSecondaryDebris(const TArray<int32>& PieceCellIds, const FTransform& CellToWorld,
+		const FVector& LinearVelocity, const FVector& AngularVelocity);
 
-	/** Spawn Debris for dedicated server */
-	void SpawnDebrisActorForDedicatedServer(const TArray<int32>& DetachedCellIds);
+	/** Greedily merge a voxel piece into axis-aligned boxes (component local space). */
+	void BuildMergedCellBoxes(const TArray<FIntVector>& Piece, TArray<FBox>& OutLocalBoxes) const;
 
 	/** Check if debris extraction via Boolean Intersection is possible
 	 *  Requires valid BooleanProcessor and ChunkMesh
@@ -944,6 +1541,16 @@ public:
 	
 	/** Register to pending queue when Actor arrives first */
 	void RegisterPendingDebrisActor(int32 InDebrisId, ADebrisActor* Actor);
+
+	/**
+	 * Client: extract the mesh of a replicated debris actor from this mesh.
+	 * Debris of the same detach event is collected (until the whole event arrived or a short window passed)
+	 * and extracted in one job: one subtract + one intersection per overlapping chunk for every piece.
+	 */
+	void QueueClientDebrisExtraction(ADebrisActor* Actor);
+
+	/** Split the intersection result of a batched extraction between the debris actors of its context */
+	void DistributeBatchedDebris(FDynamicMesh3&& Source, const TArray<UMaterialInterface*>& Materials, const FIslandRemovalContext& Context);
 	
 	/** Find and remove local debris (client) */
 	UProceduralMeshComponent* FindAndRemoveLocalDebris(int32 InDebrisId);
@@ -1000,6 +1607,12 @@ public:
  */
 	void ApplyHCLaplacianSmoothing(FDynamicMesh3& Mesh);
 private:
+	/** Incremental, time-sliced load solve on the supercell graph (server, bEnableLoadCollapse) */
+	FStructuralLoadSolver LoadSolver;
+
+	/** Reusable per-cell dedupe bits for CollectCellsOverlappingMesh (all false between calls). */
+	TBitArray<> OverlapCellBits;
+
 	/** Create mesh sections on ProceduralMeshComponent */
 	void CreateDebrisMeshSections(
 		UProceduralMeshComponent* Mesh,
@@ -1015,11 +1628,12 @@ private:
 		const TArray<UMaterialInterface*>& InMaterials
 	);
 	
-	/** Apply physics and initial velocity to Debris */
+	/** Apply physics and initial velocity to Debris (SolidVolume > 0 overrides the box volume used for mass) */
 	void ApplyDebrisPhysics(
 		 UBoxComponent* CollisionBox,
 		 const FVector& SpawnLocation,
-		 const FVector& BoxExtent
+		 const FVector& BoxExtent,
+		 float SolidVolume = 0.0f
 	 );
 
 #if WITH_EDITOR
@@ -1145,6 +1759,27 @@ private:
 	float ServerBatchTimer = 0.0f;
 	int32 ServerBatchSequence = 0;  // For compression sequence
 
+	/** Detached groups computed on the server, sent with the next MulticastDetachSignal */
+	TArray<FReplicatedDetachedGroup> PendingReplicatedDetachGroups;
+
+	/** Server: time since last MulticastCellStateChecksum */
+	float CellStateChecksumTimer = 0.0f;
+
+	/** Server: first region ID of the next checksum slice */
+	int32 CellStateChecksumCursor = 0;
+
+	/** Client: missing DestructionNetworkComponent already reported (warn once) */
+	bool bWarnedMissingResyncNetComponent = false;
+
+	/** Client: regions that mismatched on the previous checksum (resync only if they mismatch twice, to skip in-flight ops) */
+	TSet<int32> SuspectCellRegions;
+
+	/** Client: last resync request time (one request per checksum interval) */
+	double LastCellResyncRequestTime = 0.0;
+
+	/** Server: broadcast region hashes */
+	void BroadcastCellStateChecksum();
+
 	//////////////////////////////////////////////////////////////////////////
 	// Batch Completion Tracking (for determining Boolean operation completion time)
 	//////////////////////////////////////////////////////////////////////////
@@ -1196,6 +1831,9 @@ private:
 
 	TArray<FDestructionResult> PendingDestructionResults;
 
+	/** Tool meshes built for EnqueueBulk palettes and scaled impacts, keyed by shape + params. Shared read-only with workers. */
+	TMap<FToolMeshCacheKey, TSharedPtr<FDynamicMesh3, ESPMode::ThreadSafe>> BulkToolMeshCache;
+
 	/** Max Op history size (memory limit) */
 	static constexpr int32 MaxOpHistorySize = 10000;
 
@@ -1217,6 +1855,61 @@ private:
 	/** Debris ID counter (increments identically on server/client) */
 	int32 NextDebrisId = 0;
 
+	/** Secondary debris IDs live in their own range so they never shift the deterministic NextDebrisId */
+	static constexpr int32 SecondaryDebrisIdBase = 1 << 30;
+
+	/** Secondary debris ID counter (server only) */
+	int32 NextSecondaryDebrisId = SecondaryDebrisIdBase;
+
+	/** Detach event ID counter (server only, see AssignDetachEvent) */
+	int32 NextDetachEventId = 0;
+
+	/** Client: replicated debris of one detach event waiting for batched extraction */
+	struct FPendingDebrisExtraction
+	{
+		TArray<TWeakObjectPtr<ADebrisActor>> Actors;
+		int32 ExpectedCount = 0;
+		double FirstArrivalTime = 0.0;
+	};
+
+	/** Detach event ID -> debris collected so far */
+	TMap<int32, FPendingDebrisExtraction> PendingDebrisExtractions;
+
+	FTimerHandle DebrisExtractionTimerHandle;
+
+	/** Time (s) a detach event waits for its missing debris before extracting what arrived */
+	static constexpr float DebrisExtractionGroupWindow = 0.1f;
+
+	/** Timer: extract events whose group window elapsed */
+	void FlushPendingDebrisExtractions();
+
+	/** Client: build the pieces' tool meshes and combine them into one removal job */
+	void ExtractClientDebrisBatch(const TArray<ADebrisActor*>& Actors);
+
+	/** Enqueue one island removal for the combined tool meshes of a batch */
+	void EnqueueBatchedRemoval(const TSharedPtr<FDynamicMesh3>& SharedToolMesh, const TSharedPtr<FDynamicMesh3>& SharedDebrisToolMesh,
+		const TSharedPtr<FIslandRemovalContext>& Context);
+
+	/** Union of piece tool meshes (inside-out, as built by BuildPieceToolMeshes); thread safe */
+	static FDynamicMesh3 UnionToolMeshes(TArray<FDynamicMesh3>&& ToolMeshes);
+
+	/**
+	 * Add Damage to the alive cells under Shape (authority).
+	 * @return True if the hit should cut: no cell was under the shape, or a cell reached its health
+	 */
+	bool ApplyCellDamage(const FCellDestructionShape& Shape, float Damage);
+
+	/** Hit resolved by ResolveCellDamage, shared by the per-chunk requests of the same shot */
+	struct FResolvedCellDamageShot
+	{
+		uint32 ShotId = 0;
+		FVector ImpactPoint = FVector::ZeroVector;
+		bool bDecalOnly = false;
+	};
+
+	/** Recently resolved shots (oldest first) */
+	TArray<FResolvedCellDamageShot, TInlineAllocator<16>> RecentCellDamageShots;
+
 	/** Active Debris Actor tracking (DebrisID → Actor) */
 	TMap<int32, TWeakObjectPtr<AActor>> ActiveDebrisActors;
 
@@ -1260,5 +1953,6 @@ private:
 	virtual void BeginDestroy() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
 
 };
@@ -19,6 +19,7 @@
 // - Filtering (actor/radius)
 // - Frame drop detection
 // - CSV export
+// - Event timeline (fixed-size ring buffer, freeze-on-threshold, CSV/JSON export)
 // - Console command support
 // - On-screen HUD display
 
@@ -30,6 +31,7 @@
 #include "DestructionDebugger.generated.h"
 
 class URealtimeDestructibleMeshComponent;
+class UActorComponent;
 class APlayerController;
 
 /**
@@ -271,6 +273,48 @@ struct FDestructionPerformanceStats
 	int32 BooleanSampleCount = 0;
 };
 
+/**
+ * Source of an event timeline record
+ */
+enum class EDestructionEventSource : uint8
+{
+	Request,	// Cells destroyed by a destruction request on this machine
+	Boolean,	// Boolean subtract applied to a chunk
+	Detach,		// Disconnected cells detached as debris
+	ServerRPC,	// Destruction request sent to the server
+	Multicast	// Server batch multicast to clients
+};
+
+/**
+ * Event timeline record
+ * Plain data only, so writing one into the ring buffer never allocates.
+ */
+struct FDestructionEventRecord
+{
+	/** World time (s) */
+	double Time = 0.0;
+
+	/** Engine frame counter */
+	uint64 Frame = 0;
+
+	/** Owning actor of the component */
+	FName ActorName;
+
+	/** Component that produced the event */
+	FName ComponentName;
+
+	/** Cells affected by the event */
+	int32 CellCount = 0;
+
+	/** Boolean operation time (ms) */
+	float BooleanTimeMs = 0.0f;
+
+	/** Bytes sent (estimated) */
+	int32 BytesSent = 0;
+
+	EDestructionEventSource Source = EDestructionEventSource::Request;
+};
+
 /**
  * Destruction system debugger
  *
@@ -472,6 +516,52 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Destruction|Debug|Export")
 	bool ExportStatsToCSV(const FString& FilePath);
 
+	//-------------------------------------------------------------------
+	// Event Timeline (ring buffer)
+	//-------------------------------------------------------------------
+
+	/**
+	 * Record a timeline event. Overwrites the oldest record once the buffer is full.
+	 * No-op while the debugger is disabled or the timeline is frozen.
+	 */
+	void RecordEvent(EDestructionEventSource Source, const UActorComponent* Component, int32 CellCount, float BooleanTimeMs = 0.0f, int32 BytesSent = 0);
+
+	/** Estimated RPC payload size (bytes) for OpCount destruction ops */
+	static int32 EstimateRPCBytes(int32 OpCount, bool bIsCompact);
+
+	static const TCHAR* GetEventSourceName(EDestructionEventSource Source);
+
+	/** Resize the ring buffer (clears recorded events) */
+	void SetEventCapacity(int32 NewCapacity);
+
+	int32 GetEventCapacity() const { return EventRing.Num(); }
+
+	int32 GetEventCount() const { return EventCount; }
+
+	/**
+	 * Freeze the timeline when an event's boolean time reaches ThresholdMs (0 disables).
+	 * PostTriggerEvents more events are kept after the trigger so the aftermath is visible too.
+	 */
+	void SetEventFreezeThreshold(float ThresholdMs, int32 PostTriggerEvents = 32);
+
+	float GetEventFreezeThreshold() const { return EventFreezeThresholdMs; }
+
+	void FreezeEvents();
+
+	/** Resume recording and re-arm the freeze trigger */
+	void UnfreezeEvents();
+
+	bool AreEventsFrozen() const { return bEventsFrozen; }
+
+	/** Copy recorded events, oldest first */
+	void GetEvents(TArray<FDestructionEventRecord>& OutEvents) const;
+
+	void ClearEvents();
+
+	bool ExportEventsToCSV(const FString& FilePath) const;
+
+	bool ExportEventsToJSON(const FString& FilePath) const;
+
 	//-------------------------------------------------------------------
 	// Console Command Functions
 	//-------------------------------------------------------------------
@@ -533,6 +623,10 @@ protected:
 	UPROPERTY()
 	int32 MaxHistorySize = 100;
 
+	/** Event timeline capacity (records) */
+	UPROPERTY()
+	int32 EventCapacity = 4096;
+
 	UPROPERTY()
 	float VisualizationDuration = 3.0f;
 
@@ -622,6 +716,30 @@ protected:
 	/** FTSTicker handle */
 	FTSTicker::FDelegateHandle TickHandle;
 
+	//-------------------------------------------------------------------
+	// Event Timeline
+	//-------------------------------------------------------------------
+
+	/** Fixed-size ring buffer (allocated once in Initialize / SetEventCapacity) */
+	TArray<FDestructionEventRecord> EventRing;
+
+	/** Next write index */
+	int32 EventHead = 0;
+
+	/** Valid records in EventRing */
+	int32 EventCount = 0;
+
+	/** Boolean time (ms) that triggers a freeze (0 = disabled) */
+	float EventFreezeThresholdMs = 0.0f;
+
+	/** Events still recorded after the trigger */
+	int32 EventPostTriggerCount = 32;
+
+	/** Remaining post-trigger events (INDEX_NONE = not triggered) */
+	int32 EventPostTriggerRemaining = INDEX_NONE;
+
+	bool bEventsFrozen = false;
+
 	//-------------------------------------------------------------------
 	// Batching/Sequence State (for HUD display)
 	//-------------------------------------------------------------------
@@ -21,6 +21,16 @@ enum class ERDMThreadMode : uint8
 	Percentage	UMETA(DisplayName = "Percentage (%)")
 };
 
+UENUM(BlueprintType)
+enum class ERDMWorkerPriority : uint8
+{
+	// Normal on the shared task graph, Below Normal on the dedicated pool
+	Default		UMETA(DisplayName = "Default"),
+	Lowest		UMETA(DisplayName = "Lowest"),
+	BelowNormal	UMETA(DisplayName = "Below Normal"),
+	Normal		UMETA(DisplayName = "Normal")
+};
+
 USTRUCT()
 struct FImpactProfileDataAssetEntry
 {
@@ -68,12 +78,86 @@ public:
 		EditCondition = "ThreadMode == ERDMThreadMode::Percentage", EditConditionHides))
 	int32 ThreadPercentage = 50;
 
+	// Run boolean workers on a dedicated thread pool instead of the shared task graph
+	UPROPERTY(config, EditAnywhere, Category = "Thread Settings", meta = (DisplayName = "Use Dedicated Thread Pool"))
+	bool bUseDedicatedThreadPool = false;
+
+	// Scheduling priority of boolean workers (thread priority for the dedicated pool, task priority otherwise)
+	UPROPERTY(config, EditAnywhere, Category = "Thread Settings", meta = (DisplayName = "Worker Priority"))
+	ERDMWorkerPriority WorkerPriority = ERDMWorkerPriority::Default;
+
+	// Core affinity mask for dedicated pool threads (0 = no restriction)
+	UPROPERTY(config, EditAnywhere, Category = "Thread Settings", meta = (DisplayName = "Worker Core Affinity Mask",
+		EditCondition = "bUseDedicatedThreadPool"))
+	int64 WorkerAffinityMask = 0;
+
+	// Adjust the worker limit every second from frame headroom and destruction backlog
+	UPROPERTY(config, EditAnywhere, Category = "Thread Settings", meta = (DisplayName = "Dynamic Worker Scaling"))
+	bool bEnableDynamicWorkerScaling = false;
+
+	// Frame time budget used to measure game/render thread headroom
+	UPROPERTY(config, EditAnywhere, Category = "Thread Settings", meta = (DisplayName = "Target Frame Time (ms)", ClampMin = "4.0", ClampMax = "100.0",
+		EditCondition = "bEnableDynamicWorkerScaling"))
+	float TargetFrameTimeMs = 16.6f;
+
 	// Returns calculated available threads depends on thread mode
 	int32 GetEffectiveThreadCount() const ;
+
+	// Upper bound for dynamic scaling (system threads minus game/render thread)
+	static int32 GetDynamicThreadCountLimit();
 	
 	// Returns system total threads
 	static int32 GetSystemThreadCount();
 
+public:
+	// Bake debris that came to rest into static per-area rubble meshes (no physics, no replication)
+	UPROPERTY(config, EditAnywhere, Category = "Debris Settings", meta = (DisplayName = "Consolidate Settled Debris"))
+	bool bConsolidateSettledDebris = true;
+
+	// Edge length of one rubble area; settled debris inside the same area share one mesh
+	UPROPERTY(config, EditAnywhere, Category = "Debris Settings", meta = (DisplayName = "Rubble Area Size", ClampMin = "100.0",
+		EditCondition = "bConsolidateSettledDebris"))
+	float RubbleAreaSize = 2000.0f;
+
+	// Triangle cap of one rubble area; debris settling in a full area stays unbaked until its lifetime or the debris budget removes it
+	UPROPERTY(config, EditAnywhere, Category = "Debris Settings", meta = (DisplayName = "Max Rubble Triangles Per Area", ClampMin = "0",
+		EditCondition = "bConsolidateSettledDebris"))
+	int32 MaxRubbleTrianglesPerArea = 50000;
+
+	// Settled debris is buffered and merged into the rubble meshes at this interval
+	UPROPERTY(config, EditAnywhere, Category = "Debris Settings", meta = (DisplayName = "Rubble Merge Interval (s)", ClampMin = "0.0",
+		EditCondition = "bConsolidateSettledDebris"))
+	float RubbleMergeInterval = 0.5f;
+
+	// Cap total debris across all destructible meshes and evict the least important pieces first
+	UPROPERTY(config, EditAnywhere, Category = "Debris Settings", meta = (DisplayName = "Enable Debris Budget"))
+	bool bEnableDebrisBudget = true;
+
+	// Maximum number of debris actors alive at once (0 = unlimited)
+	UPROPERTY(config, EditAnywhere, Category = "Debris Settings", meta = (DisplayName = "Max Debris Count", ClampMin = "0",
+		EditCondition = "bEnableDebrisBudget"))
+	int32 MaxDebrisCount = 200;
+
+	// Maximum number of debris triangles rendered at once (0 = unlimited)
+	UPROPERTY(config, EditAnywhere, Category = "Debris Settings", meta = (DisplayName = "Max Debris Triangles", ClampMin = "0",
+		EditCondition = "bEnableDebrisBudget"))
+	int32 MaxDebrisTriangles = 200000;
+
+	// Maximum number of simulating debris bodies (0 = unlimited); slow pieces over the cap are baked into rubble
+	UPROPERTY(config, EditAnywhere, Category = "Debris Settings", meta = (DisplayName = "Max Debris Bodies", ClampMin = "0",
+		EditCondition = "bEnableDebrisBudget"))
+	int32 MaxDebrisBodies = 100;
+
+	// Distance to the nearest player at which debris importance halves
+	UPROPERTY(config, EditAnywhere, Category = "Debris Settings", meta = (DisplayName = "Importance Half Distance", ClampMin = "1.0",
+		EditCondition = "bEnableDebrisBudget"))
+	float DebrisImportanceHalfDistance = 3000.0f;
+
+	// Debris age (s) at which importance halves
+	UPROPERTY(config, EditAnywhere, Category = "Debris Settings", meta = (DisplayName = "Importance Half Age (s)", ClampMin = "0.1",
+		EditCondition = "bEnableDebrisBudget"))
+	float DebrisImportanceHalfAge = 5.0f;
+
 public:
 	UPROPERTY(config, EditAnywhere, Category = "Impact Profile Settings")
 	TArray<FImpactProfileDataAssetEntry> ImpactProfiles;
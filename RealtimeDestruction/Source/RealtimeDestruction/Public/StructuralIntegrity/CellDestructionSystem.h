@@ -12,6 +12,21 @@
 #include "CoreMinimal.h"
 #include "StructuralIntegrity/GridCellTypes.h"
 
+/**
+ * Connected group of detached cells produced by LabelDetachedCells.
+ */
+struct REALTIMEDESTRUCTION_API FDetachedCellGroup
+{
+	/** Cell IDs in ascending order. */
+	TArray<int32> CellIds;
+
+	/** Inclusive grid coordinate bounds. */
+	FIntVector MinCoord = FIntVector(MAX_int32);
+	FIntVector MaxCoord = FIntVector(MIN_int32);
+
+	int32 Num() const { return CellIds.Num(); }
+};
+
 /**
  * Cell destruction evaluation system.
  * BFS-based structural integrity checks and destruction evaluation.
@@ -197,6 +212,20 @@ public:
 		const FGridCellLayout& Cache,
 		const TSet<int32>& DisconnectedCells,
 		const TSet<int32>& DestroyedCells);
+
+	/**
+	 * Single-pass connected-component labeling of detached cells.
+	 * Union-find over a flat grid-index lookup (no per-neighbor hashing).
+	 * Groups are ordered by their smallest cell ID, so server and client produce the same order.
+	 *
+	 * @param Cache - grid layout (neighbor data)
+	 * @param DisconnectedCells - detached cells
+	 * @param OutGroups - groups with sorted cell IDs, bounds and counts
+	 */
+	static void LabelDetachedCells(
+		const FGridCellLayout& Cache,
+		const TSet<int32>& DisconnectedCells,
+		TArray<FDetachedCellGroup>& OutGroups);
 	
 	//=========================================================================
 	// Utilities
@@ -68,6 +68,21 @@ public:
 		const FVector& BoxMin, const FVector& BoxMax
 	);
 
+	/**
+	 * Conservative triangle rasterization over the cell grid.
+	 * Walks only the cells the triangle plane crosses (per column along the dominant normal axis)
+	 * and confirms each with TriangleIntersectsAABB.
+	 *
+	 * @param V0, V1, V2 - Triangle vertices (grid local space)
+	 * @param Layout - Grid layout (only existing cells are visited)
+	 * @param Visit - Called once per overlapping cell ID
+	 */
+	static void RasterizeTriangleConservative(
+		const FVector& V0, const FVector& V1, const FVector& V2,
+		const FGridCellLayout& Layout,
+		TFunctionRef<void(int32 CellId)> Visit
+	);
+
 	/**
 	* Mark subcells as alive if they intersect with the given triangle.
 	*
@@ -132,6 +147,20 @@ private:
 	static void DetermineAnchors(
 		FGridCellLayout& OutLayout,
 		float HeightThreshold);
+
+	/**
+	 * Capture the material slot of every cached triangle (same order as CachedIndices).
+	 * Reads the MeshDescription; leaves the cache empty if it is unavailable or does not match.
+	 */
+	static void CacheTriangleMaterialSlots(
+		const UStaticMesh* SourceMesh,
+		FGridCellLayout& OutLayout);
+
+	/**
+	 * Bake the dominant material slot of every valid cell from the cached triangle data.
+	 * Requires neighbors (interior cells inherit from the nearest surface cell).
+	 */
+	static void BakeCellMaterialSlots(FGridCellLayout& OutLayout);
 	
 	/**
 	 * Voxelize mesh (fill interior cells) - DynamicMesh version.
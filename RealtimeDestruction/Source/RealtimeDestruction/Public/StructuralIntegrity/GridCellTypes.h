@@ -17,6 +17,8 @@
 
 // Forward declaration
 struct FRealtimeDestructionRequest;
+struct FDestructionToolShapeParams;
+enum class EDestructionToolShape : uint8;
 
 //=========================================================================
 // SubCell configuration constants
@@ -211,6 +213,13 @@ struct REALTIMEDESTRUCTION_API FCellDestructionShape
 	 * Converts ToolShape to Sphere/Line and maps Cylinder to a Line along ToolForwardVector.
 	 */
 	static FCellDestructionShape CreateFromRequest(const FRealtimeDestructionRequest& Request);
+
+	/** Build a FCellDestructionShape from raw tool data (used by bulk ingestion, which has no request struct). */
+	static FCellDestructionShape CreateFromToolShape(EDestructionToolShape ToolShape,
+		const FDestructionToolShapeParams& ShapeParams, const FVector& ImpactPoint, const FVector& ToolForwardVector);
+
+	/** World-space AABB enclosing the shape (conservative for rotated box/cylinder). */
+	FBox GetBounds() const;
 };
 
 USTRUCT(BlueprintType)
@@ -338,6 +347,10 @@ struct REALTIMEDESTRUCTION_API FGridCellLayout
 	UPROPERTY()
 	TArray<uint32> CachedIndices;
 
+	/** Cached material slot per triangle, parallel to CachedIndices / 3 (editor-time capture). */
+	UPROPERTY()
+	TArray<uint8> CachedTriangleMaterialSlots;
+
 	/** Check if cached triangle data is available. */
 	bool HasCachedTriangleData() const
 	{
@@ -349,6 +362,26 @@ struct REALTIMEDESTRUCTION_API FGridCellLayout
 	{
 		CachedVertices.Empty();
 		CachedIndices.Empty();
+		CachedTriangleMaterialSlots.Empty();
+	}
+
+	//=========================================================================
+	// Per-cell material (baked from mesh material sections)
+	//=========================================================================
+
+	/**
+	 * Dominant material slot per cell (dense, indexed by cell ID).
+	 * Surface cells take the slot with the most triangle area touching them;
+	 * interior cells take the slot of the nearest surface cell.
+	 * Empty if no per-triangle material data was available at build time.
+	 */
+	UPROPERTY()
+	TArray<uint8> CellMaterialSlots;
+
+	/** Material slot of a cell (INDEX_NONE if not baked). */
+	int32 GetCellMaterialSlot(int32 CellId) const
+	{
+		return CellMaterialSlots.IsValidIndex(CellId) ? CellMaterialSlots[CellId] : INDEX_NONE;
 	}
 
 	//=========================================================================
@@ -654,6 +687,9 @@ struct REALTIMEDESTRUCTION_API FGridCellLayout
 
 	/** Get cell IDs inside an AABB. */
 	TArray<int32> GetCellsInAABB(const FBox& WorldAABB, const FTransform& MeshTransform) const;
+
+	/** Heap memory held by the layout (bytes, excludes sizeof(*this)). */
+	SIZE_T GetAllocatedSize() const;
 };
 
 USTRUCT()
@@ -771,12 +807,45 @@ struct REALTIMEDESTRUCTION_API FCellState
 	UPROPERTY()
 	TMap<int32, FSubCell> SubCellStates;
 
+	/**
+	 * Accumulated impact damage per cell (cell damage model).
+	 * Dense, indexed by cell ID; empty until the first damaging hit.
+	 */
+	UPROPERTY()
+	TArray<float> CellDamage;
+
+	/**
+	 * Per-region XOR of HashCellForRegion over DestroyedCells, kept up to date by DestroyCell/RestoreCell
+	 * once EnsureRegionHashes has been called. Regions whose hash is 0 (no destroyed cells) are not stored.
+	 */
+	TMap<int32, uint32> DestroyedRegionHashes;
+
+	/** Grid size and region size DestroyedRegionHashes was built for (RegionHashSize 0 = not tracked). */
+	FIntVector RegionHashGridSize = FIntVector::ZeroValue;
+	int32 RegionHashSize = 0;
+
 	/** Check if a cell is destroyed. */
 	bool IsCellDestroyed(int32 CellId) const
 	{
 		return DestroyedCells.Contains(CellId);
 	}
 
+	/** Heap memory held by the cell state (bytes, excludes sizeof(*this)). */
+	SIZE_T GetAllocatedSize() const
+	{
+		SIZE_T Size = DestroyedCells.GetAllocatedSize() + DetachedGroups.GetAllocatedSize() + SubCellStates.GetAllocatedSize()
+			+ CellDamage.GetAllocatedSize() + DestroyedRegionHashes.GetAllocatedSize();
+		for (const FDetachedGroupWithSubCell& Group : DetachedGroups)
+		{
+			Size += Group.DetachedCellIds.GetAllocatedSize() + Group.IncludedSubCells.GetAllocatedSize();
+			for (const TPair<int32, FIntArray>& Pair : Group.IncludedSubCells)
+			{
+				Size += Pair.Value.Values.GetAllocatedSize();
+			}
+		}
+		return Size;
+	}
+
 	/** Check if a subcell is alive. */
 	bool IsSubCellAlive(int32 CellId, int32 SubCellId) const
 	{
@@ -808,12 +877,61 @@ struct REALTIMEDESTRUCTION_API FCellState
 		return false;
 	}
 
+	/** Add damage to a cell and return its accumulated damage. */
+	float AddCellDamage(int32 CellId, float Damage, int32 TotalCellCount)
+	{
+		if (CellDamage.Num() < TotalCellCount)
+		{
+			CellDamage.SetNumZeroed(TotalCellCount);
+		}
+		if (!CellDamage.IsValidIndex(CellId))
+		{
+			return 0.0f;
+		}
+		return CellDamage[CellId] += Damage;
+	}
+
+	/** Accumulated damage of a cell (0 if never hit). */
+	float GetCellDamage(int32 CellId) const
+	{
+		return CellDamage.IsValidIndex(CellId) ? CellDamage[CellId] : 0.0f;
+	}
+
+	/**
+	 * Mark a cell destroyed. All writes to DestroyedCells should go through here (or RestoreCell)
+	 * so the region hashes stay in sync. Returns true if the cell was not destroyed before.
+	 */
+	bool DestroyCell(int32 CellId)
+	{
+		bool bAlreadyDestroyed = false;
+		DestroyedCells.Add(CellId, &bAlreadyDestroyed);
+		if (!bAlreadyDestroyed && RegionHashSize > 0)
+		{
+			ToggleRegionHash(CellId);
+		}
+		return !bAlreadyDestroyed;
+	}
+
+	/** Clear a cell's destroyed flag (resync only). Returns true if it was destroyed. */
+	bool RestoreCell(int32 CellId)
+	{
+		if (DestroyedCells.Remove(CellId) == 0)
+		{
+			return false;
+		}
+		if (RegionHashSize > 0)
+		{
+			ToggleRegionHash(CellId);
+		}
+		return true;
+	}
+
 	/** Mark cells destroyed. */
 	void DestroyCells(const TArray<int32>& CellIds)
 	{
 		for (int32 CellId : CellIds)
 		{
-			DestroyedCells.Add(CellId);
+			DestroyCell(CellId);
 		}
 	}
 
@@ -847,7 +965,7 @@ struct REALTIMEDESTRUCTION_API FCellState
 			// DetachedCellIds -> DestroyedCells
 			for (int32 CellId : Group.DetachedCellIds)
 			{
-				DestroyedCells.Add(CellId);
+				DestroyCell(CellId);
 			}
 
 			// IncludedSubCells -> mark dead in SubCellStates
@@ -873,7 +991,7 @@ struct REALTIMEDESTRUCTION_API FCellState
 			// DetachedCellIds -> DestroyedCells
 			for (int32 CellId : Group.DetachedCellIds)
 			{
-				DestroyedCells.Add(CellId);
+				DestroyCell(CellId);
 			}
 
 			// IncludedSubCells -> mark dead in SubCellStates
@@ -895,6 +1013,103 @@ struct REALTIMEDESTRUCTION_API FCellState
 	{
 		DestroyedCells.Empty();
 		DetachedGroups.Empty();
+		CellDamage.Empty();
+		DestroyedRegionHashes.Empty();
+	}
+
+	/**
+	 * Sync region (cube of RegionSize^3 cells) containing a cell.
+	 * Regions are a fixed partition of the grid, identical on server and clients.
+	 */
+	static int32 GetRegionId(const FGridCellLayout& Layout, int32 CellId, int32 RegionSize)
+	{
+		return GetRegionId(Layout.GridSize, CellId, RegionSize);
+	}
+
+	static int32 GetRegionId(const FIntVector& GridSize, int32 CellId, int32 RegionSize)
+	{
+		const int32 XY = GridSize.X * GridSize.Y;
+		const int32 Z = CellId / XY;
+		const int32 Y = (CellId % XY) / GridSize.X;
+		const int32 X = CellId % GridSize.X;
+		const int32 RegionsX = FMath::DivideAndRoundUp(GridSize.X, RegionSize);
+		const int32 RegionsY = FMath::DivideAndRoundUp(GridSize.Y, RegionSize);
+		return (Z / RegionSize) * RegionsX * RegionsY + (Y / RegionSize) * RegionsX + (X / RegionSize);
+	}
+
+	/** Per-cell contribution to a region hash. */
+	static uint32 HashCellForRegion(int32 CellId)
+	{
+		uint32 H = static_cast<uint32>(CellId) * 0x9E3779B1u;
+		H ^= H >> 16;
+		H *= 0x85EBCA6Bu;
+		H ^= H >> 13;
+		return H;
+	}
+
+	/**
+	 * Start (or retarget) incremental region hashing. Rebuilds DestroyedRegionHashes from scratch only
+	 * when the grid or region size changed; afterwards DestroyCell/RestoreCell update it in O(1).
+	 */
+	void EnsureRegionHashes(const FGridCellLayout& Layout, int32 RegionSize)
+	{
+		if (RegionSize <= 0 || (RegionHashSize == RegionSize && RegionHashGridSize == Layout.GridSize))
+		{
+			return;
+		}
+
+		RegionHashSize = RegionSize;
+		RegionHashGridSize = Layout.GridSize;
+		DestroyedRegionHashes.Reset();
+		for (int32 CellId : DestroyedCells)
+		{
+			ToggleRegionHash(CellId);
+		}
+	}
+
+	/**
+	 * Hash of destroyed + detached cells per region (regions without any are omitted).
+	 * Destroyed cells come from the incrementally kept DestroyedRegionHashes (call EnsureRegionHashes first);
+	 * only the few cells of pending detached groups are hashed here. A cell counts once even if it is
+	 * both destroyed and detached. Subcell state is not included (not replicated).
+	 */
+	void ComputeRegionHashes(const FGridCellLayout& Layout, int32 RegionSize, TMap<int32, uint32>& OutHashes) const
+	{
+		if (RegionHashSize == RegionSize && RegionHashGridSize == Layout.GridSize)
+		{
+			OutHashes = DestroyedRegionHashes;
+		}
+		else
+		{
+			OutHashes.Reset();
+			for (int32 CellId : DestroyedCells)
+			{
+				OutHashes.FindOrAdd(GetRegionId(Layout, CellId, RegionSize)) ^= HashCellForRegion(CellId);
+			}
+		}
+
+		for (const FDetachedGroupWithSubCell& Group : DetachedGroups)
+		{
+			for (int32 CellId : Group.DetachedCellIds)
+			{
+				if (!DestroyedCells.Contains(CellId))
+				{
+					OutHashes.FindOrAdd(GetRegionId(Layout, CellId, RegionSize)) ^= HashCellForRegion(CellId);
+				}
+			}
+		}
+	}
+
+private:
+	void ToggleRegionHash(int32 CellId)
+	{
+		const int32 RegionId = GetRegionId(RegionHashGridSize, CellId, RegionHashSize);
+		uint32& Hash = DestroyedRegionHashes.FindOrAdd(RegionId);
+		Hash ^= HashCellForRegion(CellId);
+		if (Hash == 0)
+		{
+			DestroyedRegionHashes.Remove(RegionId);
+		}
 	}
 };
 
@@ -1037,6 +1252,13 @@ struct REALTIMEDESTRUCTION_API FSuperCellState
 	UPROPERTY()
 	TArray<int32> DestroyedCellCounts;
 
+	/** Heap memory held by the supercell state (bytes, excludes sizeof(*this)). */
+	SIZE_T GetAllocatedSize() const
+	{
+		return IntactBits.GetAllocatedSize() + CellToSupercell.GetAllocatedSize() + OrphanCellIds.GetAllocatedSize()
+			+ InitialValidCellCounts.GetAllocatedSize() + DestroyedCellCounts.GetAllocatedSize();
+	}
+
 	//=========================================================================
 	// SuperCell coord <-> ID conversion
 	//=========================================================================
@@ -1243,6 +1465,13 @@ struct FConnectivityContext
 	TArray<FCellNode> WorkStack = {};
 
 	FConnectivityContext() = default;
+
+	/** Heap memory held by the scratch buffers (bytes). */
+	SIZE_T GetAllocatedSize() const
+	{
+		return ConnectedCellBits.GetAllocatedSize() + VisitedSuperCellBits.GetAllocatedSize()
+			+ ConnectedCellIds.GetAllocatedSize() + WorkStack.GetAllocatedSize();
+	}
 	~FConnectivityContext()
 	{
 		ConnectedCellBits.Empty();
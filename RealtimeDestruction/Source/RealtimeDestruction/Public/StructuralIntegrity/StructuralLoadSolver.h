@@ -0,0 +1,250 @@
+// Copyright (c) 2026 LazyDevelopers <lazydeveloper24@gmail.com>. All rights reserved.
+// This plugin is distributed under the Fab Standard License.
+//
+// This product was independently developed by us while participating in the Epic Project, a developer-support
+// program of the KRAFTON JUNGLE GameTech Lab. All rights, title, and interest in and to the product are exclusively
+// vested in us. Krafton, Inc. was not involved in its development and distribution and disclaims all representations
+// and warranties, express or implied, and assumes no responsibility or liability for any consequences arising from
+// the use of this product.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StructuralIntegrity/GridCellTypes.h"
+
+/**
+ * Load model parameters.
+ * Masses and capacities share one unit (kg); only their ratio matters.
+ */
+struct REALTIMEDESTRUCTION_API FStructuralLoadSettings
+{
+	/** Mass of one intact cell. */
+	float CellMass = 20.0f;
+
+	/** Load one cell link pointing along gravity can carry (compression). */
+	float VerticalLinkCapacity = 5000.0f;
+
+	/** Load one cell link across gravity or against it can carry (shear / tension). */
+	float LateralLinkCapacity = 500.0f;
+
+	/**
+	 * Gravity seen from the grid: dot(world direction of the +X/+Y/+Z grid axis, world down).
+	 * (0, 0, -1) for an upright mesh, where links toward -Z carry vertical load.
+	 */
+	FVector AxisGravityAlignment = FVector(0.0, 0.0, -1.0);
+
+	/** Capacity of one cell link in a grid direction (0:-X, 1:+X, 2:-Y, 3:+Y, 4:-Z, 5:+Z). */
+	float GetLinkCapacity(int32 Direction) const;
+
+	bool operator==(const FStructuralLoadSettings& Other) const
+	{
+		return CellMass == Other.CellMass
+			&& VerticalLinkCapacity == Other.VerticalLinkCapacity
+			&& LateralLinkCapacity == Other.LateralLinkCapacity
+			&& AxisGravityAlignment.Equals(Other.AxisGravityAlignment, 1.0e-3);
+	}
+};
+
+/** Supercell whose supporting links carry more than their capacity. */
+struct REALTIMEDESTRUCTION_API FStructuralLoadFailure
+{
+	int32 SupercellId = INDEX_NONE;
+
+	/** Directions (bit per 0:-X .. 5:+Z) of the links that carry its load toward an anchor. */
+	uint8 SupportDirectionMask = 0;
+
+	/** Load / capacity of its supporting links. */
+	float StressRatio = 0.0f;
+};
+
+/**
+ * Load-aware collapse solver on the supercell graph.
+ *
+ * Every alive supercell carries the mass of its alive cells plus the load of the supercells it
+ * supports. Load flows toward anchors: each supercell hands its load to the neighbors one step
+ * closer to an anchor, split by the capacity of the cell links across the shared face.
+ * A supercell fails when its load exceeds the summed capacity of those links.
+ *
+ * Changes are incremental: changed cells mark their supercell dirty, the supercell is
+ * re-measured, and the mass / capacity difference is pushed toward the anchors through the
+ * supercells below it only. A full solve runs only when the graph shape changes (a supercell
+ * empties, a face loses its last link, anchors or settings change). Cell changes during a full
+ * solve are deferred until it finishes, so sustained damage never starves it.
+ *
+ * All work is time-sliced: Step() resumes where the previous call stopped and returns once the
+ * budget is spent.
+ */
+class REALTIMEDESTRUCTION_API FStructuralLoadSolver
+{
+public:
+	/** Drop all state (grid rebuilt). */
+	void Reset();
+
+	/** Queue the supercells of changed cells (destroyed, detached, subcells lost, anchor flag). */
+	void MarkCellsDirty(const FGridCellLayout& Layout, const FSuperCellState& Supercells, TConstArrayView<int32> CellIds);
+
+	/** Re-solve the whole graph (anchor set rebuilt). */
+	void MarkAllDirty() { bFullSolveRequested = true; }
+
+	/** True while any work is pending or in progress. */
+	bool IsBusy() const;
+
+	/**
+	 * Advance the solve.
+	 *
+	 * @param Layout - grid layout (cells, anchors)
+	 * @param CellState - current cell state (destroyed cells, subcells)
+	 * @param Supercells - supercell grid the load graph is built on
+	 * @param Settings - load model parameters
+	 * @param BudgetSeconds - time budget for this call
+	 * @param OutFailure - [out] most overloaded supercell once the pending work has drained
+	 * @return True if OutFailure is valid
+	 */
+	bool Step(
+		const FGridCellLayout& Layout,
+		const FCellState& CellState,
+		const FSuperCellState& Supercells,
+		const FStructuralLoadSettings& Settings,
+		double BudgetSeconds,
+		FStructuralLoadFailure& OutFailure);
+
+	/** Load (kg) carried by a supercell in the current solution (0 if unknown). */
+	float GetSupercellLoad(int32 SupercellId) const;
+
+	/** Load / capacity of a supercell in the current solution (0 if unknown). */
+	float GetSupercellStressRatio(int32 SupercellId) const;
+
+	/** Heap memory held by the solver buffers (bytes). */
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	enum class EPhase : uint8
+	{
+		Idle,		// incremental mode: refresh dirty supercells, push load differences
+		Gather,		// full solve: measure every supercell, seed anchored ones
+		Distance,	// full solve: multi-source BFS from anchors (order by distance)
+		Load		// full solve: accumulate load from the farthest supercells back to anchors
+	};
+
+	/** Load graph node (one per supercell) */
+	struct FLoadNode
+	{
+		/** Alive cells, scaled by alive subcells (multiply by CellMass for kg) */
+		float Mass = 0.0f;
+
+		/** Alive anchor cells */
+		int32 AnchorCount = 0;
+
+		/** Alive cell pairs across the +X / +Y / +Z face (-X / -Y / -Z are stored on the neighbor) */
+		uint16 FaceLinks[3] = {};
+
+		/** Supporting link counts the current load split was made with, per direction */
+		uint16 SplitLinks[6] = {};
+
+		/** Hop distance to the nearest anchored supercell (INDEX_NONE = unreached / empty) */
+		int32 Distance = INDEX_NONE;
+
+		/** Carried load (cell units) */
+		float Load = 0.0f;
+
+		/** Load difference not yet pushed to the supporters (cell units) */
+		float PendingLoad = 0.0f;
+
+		/** Load / capacity of the supporting links */
+		float StressRatio = 0.0f;
+
+		bool bDirty = false;
+		bool bQueued = false;
+	};
+
+	/** Measured cell content of a supercell */
+	struct FNodeMeasure
+	{
+		float Mass = 0.0f;
+		int32 AnchorCount = 0;
+		uint16 FaceLinks[3] = {};
+		uint16 NegativeFaceLinks[3] = {};
+	};
+
+	/** Size the node array for the supercell grid (once per grid) */
+	void InitNodes(const FSuperCellState& Supercells);
+
+	/** Count alive cells, anchors and face links of a supercell */
+	FNodeMeasure MeasureNode(int32 NodeId, const FGridCellLayout& Layout, const FCellState& CellState) const;
+
+	/** Alive cell pairs across the +Axis face of a supercell */
+	uint16 CountFaceLinks(const FIntVector& NodeCoord, int32 Axis, const FGridCellLayout& Layout, const FCellState& CellState) const;
+
+	/** Re-measure a dirty supercell; returns false if the graph shape changed (full solve needed) */
+	bool RefreshNode(int32 NodeId, const FGridCellLayout& Layout, const FCellState& CellState);
+
+	/** Push a node's load difference / new split to its supporters */
+	void PropagateNode(int32 NodeId);
+
+	FIntVector GetNodeCoord(int32 NodeId) const
+	{
+		return FIntVector(NodeId % NodeCount.X, (NodeId / NodeCount.X) % NodeCount.Y, NodeId / (NodeCount.X * NodeCount.Y));
+	}
+
+	int32 GetNodeId(const FIntVector& Coord) const
+	{
+		return (Coord.Z * NodeCount.Y + Coord.Y) * NodeCount.X + Coord.X;
+	}
+
+	/** Neighbor supercell in a direction (INDEX_NONE at the grid edge) */
+	int32 GetNeighborNode(int32 NodeId, int32 Direction) const;
+
+	/** Alive cell links between a supercell and its neighbor in a direction */
+	uint16 GetLinkCount(int32 NodeId, int32 Direction) const;
+
+	/** Queue a node for load propagation (bucketed by distance) */
+	void QueueNode(int32 NodeId);
+
+	/** Current link counts toward the neighbors one step closer to an anchor, per direction */
+	void GetSupportLinks(int32 NodeId, uint16 (&OutLinks)[6]) const;
+
+	/** Split a load over supporting links; fills per-direction shares, returns the summed capacity (kg) */
+	float ComputeSplit(float InLoad, const uint16 (&Links)[6], float (&OutShares)[6]) const;
+
+	/** Pick the worst overloaded candidate (clears the candidate list) */
+	bool CollectFailure(FStructuralLoadFailure& OutFailure);
+
+	void BeginFullSolve(const FStructuralLoadSettings& Settings);
+
+	static float GetCellMass(const FCellState& CellState, int32 CellId);
+
+	static bool IsCellAlive(const FGridCellLayout& Layout, const FCellState& CellState, int32 CellId)
+	{
+		return Layout.GetCellExists(CellId) && !CellState.DestroyedCells.Contains(CellId);
+	}
+
+	EPhase Phase = EPhase::Idle;
+	bool bFullSolveRequested = true;
+
+	/** Supercell grid the nodes were built for */
+	FIntVector NodeCount = FIntVector::ZeroValue;
+	FIntVector NodeSize = FIntVector::ZeroValue;
+	FIntVector GridSize = FIntVector::ZeroValue;
+
+	/** Settings the current solution was made with (change -> full solve) */
+	FStructuralLoadSettings SolvedSettings;
+	float LinkCapacity[6] = {};
+
+	TArray<FLoadNode> Nodes;
+
+	/** Supercells changed since they were last measured */
+	TArray<int32> DirtyNodes;
+
+	/** Full solve: gather cursor, BFS order (non-decreasing distance) and cursors */
+	int32 GatherCursor = 0;
+	TArray<int32> Ordered;
+	int32 BfsCursor = 0;
+	int32 LoadCursor = INDEX_NONE;
+
+	/** Incremental: nodes with a pending load difference, bucketed by distance */
+	TArray<TArray<int32>> DistanceBuckets;
+	int32 TopBucket = INDEX_NONE;
+
+	/** Nodes seen overloaded since the last report */
+	TArray<int32> OverloadCandidates;
+};
@@ -0,0 +1,165 @@
+// Copyright (c) 2026 LazyDevelopers <lazydeveloper24@gmail.com>. All rights reserved.
+// This plugin is distributed under the Fab Standard License.
+//
+// This product was independently developed by us while participating in the Epic Project, a developer-support
+// program of the KRAFTON JUNGLE GameTech Lab. All rights, title, and interest in and to the product are exclusively
+// vested in us. Krafton, Inc. was not involved in its development and distribution and disclaims all representations
+// and warranties, express or implied, and assumes no responsibility or liability for any consequences arising from
+// the use of this product.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ProceduralMeshComponent.h"
+#include "DebrisManagerSubsystem.generated.h"
+
+class UMaterialInterface;
+class UPrimitiveComponent;
+
+/**
+ * World Subsystem for debris that outlives its physics body.
+ *
+ * Debris that came to rest is baked into a static rubble mesh shared by every piece
+ * settling in the same area (one section per material). Rubble has no collision,
+ * no physics and is never replicated itself: the settled debris actor stays replicated
+ * but dormant, and each machine bakes its own copy when it receives the settled state
+ * (including late joiners and clients for which the debris only becomes relevant later).
+ * An area's open rubble mesh is sealed once it grows large, so a flush only rebuilds
+ * the small open mesh instead of everything already baked in the area.
+ *
+ * It also enforces a global debris budget (count, triangles, simulating bodies) over every
+ * destructible mesh in the world. Debris is ranked by size, distance to the nearest player
+ * and age; the least important pieces are downgraded (baked into rubble) or evicted first.
+ * Every machine that simulates or renders debris registers it, so clients enforce the caps
+ * locally as well. Replicated debris cannot be destroyed on a client; it is baked or hidden
+ * there instead (ADebrisActor::CullLocally), while the server evicts it for everyone.
+ */
+UCLASS(ClassGroup = (RealtimeDestruction))
+class REALTIMEDESTRUCTION_API UDebrisManagerSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override { return true; }
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * Copy the sections of a settled debris mesh into the rubble of its area.
+	 * The copy is buffered and merged on the next flush; the source mesh can be destroyed right away.
+	 *
+	 * @param DebrisMesh - settled debris mesh (world transform is baked into the rubble)
+	 * @return True if the debris was accepted, false if consolidation is disabled or the area is full
+	 */
+	bool ConsolidateDebris(UProceduralMeshComponent* DebrisMesh);
+
+	/** Remove all rubble in this world */
+	UFUNCTION(BlueprintCallable, Category = "Destruction")
+	void ClearRubble();
+
+	/** Number of rubble areas */
+	UFUNCTION(BlueprintCallable, Category = "Destruction")
+	int32 GetRubbleAreaCount() const { return RubbleAreas.Num(); }
+
+	/** Triangles held by all rubble areas (including buffered debris) */
+	UFUNCTION(BlueprintCallable, Category = "Destruction")
+	int32 GetRubbleTriangleCount() const;
+
+	/**
+	 * Put a debris actor under the global budget.
+	 *
+	 * @param DebrisActor - debris present on this machine (destroyed on eviction; client copies of replicated debris are culled locally)
+	 * @param Body - simulating root body (size, speed and body count)
+	 * @param Mesh - visual mesh (triangle count, rubble downgrade); may be filled later
+	 */
+	void RegisterDebris(AActor* DebrisActor, UPrimitiveComponent* Body, UProceduralMeshComponent* Mesh);
+
+	/** Remove a debris actor from the budget (settled, destroyed) */
+	void UnregisterDebris(AActor* DebrisActor);
+
+	/** Number of debris under the budget (as of the last budget pass) */
+	UFUNCTION(BlueprintCallable, Category = "Destruction")
+	int32 GetDebrisCount() const { return TrackedDebris.Num(); }
+
+	/** Debris totals measured by the last budget pass */
+	void GetDebrisBudgetUsage(int32& OutCount, int32& OutTriangles, int32& OutBodies) const;
+
+private:
+	/** Rubble of one area */
+	struct FRubbleArea
+	{
+		/** Open rubble mesh receiving new geometry (sealed meshes stay on the same transient, non-replicated actor) */
+		TWeakObjectPtr<UProceduralMeshComponent> Mesh;
+
+		/** Material -> section index of Mesh */
+		TMap<TWeakObjectPtr<UMaterialInterface>, int32> SectionByMaterial;
+
+		/** Geometry waiting for the next flush (section index -> appended data, area local space) */
+		TMap<int32, FProcMeshSection> PendingSections;
+
+		/** Triangles merged + pending, all meshes of the area */
+		int32 NumTriangles = 0;
+
+		/** Triangles merged into the open Mesh */
+		int32 OpenMeshTriangles = 0;
+	};
+
+	/** Debris under the budget */
+	struct FTrackedDebris
+	{
+		TWeakObjectPtr<AActor> Actor;
+		TWeakObjectPtr<UPrimitiveComponent> Body;
+		TWeakObjectPtr<UProceduralMeshComponent> Mesh;
+		double SpawnTime = 0.0;
+
+		/** Cached once the mesh has geometry */
+		int32 NumTriangles = 0;
+
+		/** Scratch for the budget pass */
+		float Importance = 0.0f;
+		bool bSimulating = false;
+	};
+
+	/** Find or create the rubble area containing WorldLocation */
+	FRubbleArea* FindOrAddArea(const FVector& WorldLocation, FIntVector& OutAreaKey);
+
+	/** Add an empty rubble mesh to RubbleActor at the area center */
+	UProceduralMeshComponent* CreateRubbleMesh(AActor* RubbleActor, const FVector& AreaCenter);
+
+	/** Merge buffered geometry into the rubble meshes */
+	void FlushPendingRubble();
+
+	/** Rank tracked debris and downgrade / evict until every cap holds */
+	void EnforceDebrisBudget();
+
+	/** Bake a debris piece into rubble in place, or destroy it if it cannot be baked */
+	void DowngradeDebris(const FTrackedDebris& Debris);
+
+	/** Area key -> rubble */
+	TMap<FIntVector, FRubbleArea> RubbleAreas;
+
+	/** Areas with pending geometry */
+	TSet<FIntVector> DirtyAreas;
+
+	FTimerHandle FlushTimerHandle;
+
+	TArray<FTrackedDebris> TrackedDebris;
+
+	FTimerHandle BudgetTimerHandle;
+
+	int32 LastDebrisTriangles = 0;
+	int32 LastDebrisBodies = 0;
+
+	float AreaSize = 2000.0f;
+	int32 MaxTrianglesPerArea = 50000;
+	float MergeInterval = 0.5f;
+	bool bConsolidationEnabled = true;
+
+	bool bBudgetEnabled = true;
+	int32 MaxDebrisCount = 200;
+	int32 MaxDebrisTriangles = 200000;
+	int32 MaxDebrisBodies = 100;
+	float ImportanceHalfDistance = 3000.0f;
+	float ImportanceHalfAge = 5.0f;
+};
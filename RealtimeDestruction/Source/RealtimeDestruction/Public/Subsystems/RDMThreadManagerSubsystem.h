@@ -11,9 +11,14 @@
 
 #include "CoreMinimal.h"
 #include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "HAL/CriticalSection.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Settings/RDMSetting.h"
 #include "RDMThreadManagerSubsystem.generated.h"
 
+class FQueuedThreadPool;
+
 struct FRDMWorkerRequest
 {
 	TFunction<void()> WorkFunc;
@@ -38,13 +43,28 @@ public:
 	// Thread Request Interface
 	void RequestWork(TFunction<void()>&& WorkFunc, UObject* Requester);
 
+	/**
+	 * Report ops a requester is holding back before they reach RequestWork (e.g. per-chunk pending ops
+	 * of a boolean processor). Game thread only; the dynamic scaler adds these to its backlog.
+	 */
+	void ReportPendingOps(UObject* Requester, int32 NumOps);
+
 	// Settings
-	void SetMaxTotalWorkers(int32 Max) { MaxTotalWorkers = FMath::Max(1, Max); }
-	int32 GetMaxTotalWorkers() const { return MaxTotalWorkers; }
+	void SetMaxTotalWorkers(int32 Max) { MaxTotalWorkers.store(FMath::Max(1, Max)); }
+	int32 GetMaxTotalWorkers() const { return MaxTotalWorkers.load(); }
 	int32 GetActiveWorkerCount() const { return ActiveWorkers.load(); }
 	int32 GetPendingCount() const { return PendingCount.load(); }
 
-	int32 GetSlotCount () const {return (MaxTotalWorkers >= 8) ? 2 : 1; }
+	// Slots usable at the current worker limit (gates dispatch)
+	int32 GetSlotCount () const { return GetSlotCountForWorkers(MaxTotalWorkers.load()); }
+	// Slots needed at the highest limit dynamic scaling can reach (sizes slot storage once)
+	int32 GetMaxSlotCount() const
+	{
+		const int32 UpperWorkers = ScalingTickHandle.IsValid() ? MaxDynamicWorkers : BaseTotalWorkers;
+		return GetSlotCountForWorkers(FMath::Max(MaxTotalWorkers.load(), UpperWorkers));
+	}
+	static int32 GetSlotCountForWorkers(int32 NumWorkers) { return (NumWorkers >= 8) ? 2 : 1; }
+	bool IsUsingDedicatedPool() const { return DedicatedPool != nullptr; }
 	// Logging
 	void LogStatus() const;
 private:
@@ -56,10 +76,20 @@ private:
 
 	// Execute next task from pending queue
 	void TryDispatchPending();
+
+	// Dynamic worker scaling (samples every frame, decides once per second)
+	bool TickWorkerScaling(float DeltaTime);
+
+	// Sum of ReportPendingOps entries, dropping requesters that are gone
+	int32 GetReportedPendingOps();
+
+	// Dedicated pool lifecycle
+	void CreateDedicatedPool(int32 NumThreads);
+	void DestroyDedicatedPool();
 	
 private:
-	// Global thread limit
-	int32 MaxTotalWorkers = 4;  // Maximum 4 workers for the entire game
+	// Global thread limit (read by worker threads in TryDispatchPending)
+	std::atomic<int32> MaxTotalWorkers{ 4 };  // Maximum 4 workers for the entire game
 
 	// Current active worker count
 	std::atomic<int32> ActiveWorkers{ 0 };
@@ -68,9 +98,32 @@ private:
 	TQueue<TFunction<void()>, EQueueMode::Mpsc> PendingQueue;
 	std::atomic<int32> PendingCount{ 0 };
 
+	// Mpsc queue allows one consumer at a time; completions on several workers and the scaler all dequeue
+	FCriticalSection DispatchLock;
+
 	// Shutdown flag
 	std::atomic<bool> bIsShuttingDown{ false };
 
+	// Optional dedicated low-priority pool (nullptr = shared task graph)
+	FQueuedThreadPool* DedicatedPool = nullptr;
+
+	// Dynamic scaling state
+	FTSTicker::FDelegateHandle ScalingTickHandle;
+	int32 BaseTotalWorkers = 4;
+	int32 MinDynamicWorkers = 1;
+	int32 MaxDynamicWorkers = 4;
+	float TargetFrameTimeMs = 16.6f;
+	float ScalingIntervalAccum = 0.0f;
+	double FrameMsSampleSum = 0.0;
+	int32 FrameMsSampleCount = 0;
+
+	// Ops held by requesters outside PendingQueue (game thread only)
+	TMap<TWeakObjectPtr<UObject>, int32> ReportedPendingOps;
+
+	// Worker scheduling options (from URDMSetting)
+	ERDMWorkerPriority WorkerPriority = ERDMWorkerPriority::Default;
+	uint64 WorkerAffinityMask = 0;
+
 	
 	
 };
@@ -14,15 +14,19 @@
 // - Preset-based network latency/loss simulation
 // - Console command: Destruction.NetPreset [off|good|normal|bad|worst]
 // - Current ping query
+// - Soak test: Destruction.Soak [clients] [seconds] [preset|all] [sweep|random|cluster]
 // - Reusable in other projects like Lyra
 
 #pragma once
 
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "Containers/Ticker.h"
 #include "NetworkTestTypes.h"
 #include "NetworkTestSubsystem.generated.h"
 
+class URealtimeDestructibleMeshComponent;
+
 /**
  * Network Test Subsystem
  *
@@ -36,6 +40,14 @@
  * Usage:
  * - Console: Destruction.NetPreset bad
  * - Blueprint: GetSubsystem<UNetworkTestSubsystem>()->ApplyPreset(ENetworkTestPreset::Bad)
+ *
+ * Soak test (authority only, works with -nullrhi):
+ * - Simulated clients fire scripted patterns under each preset; shots are injected into the
+ *   server-side request handling, so the client->server RPC, _Validate and rate limiting are skipped
+ * - Reports bandwidth/s, RPC counts (server RPC count is synthetic), late-join sync time
+ *   and final cell-state agreement
+ * - Client worlds in the same process (PIE multi-client) are compared directly;
+ *   separate client processes can print their hashes with Destruction.SoakHash
  */
 UCLASS(ClassGroup = (RealtimeDestruction))
 class REALTIMEDESTRUCTION_API UNetworkTestSubsystem : public UWorldSubsystem
@@ -132,6 +144,34 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Destruction|NetworkTest")
 	FNetworkTestPresetConfig GetPresetConfig(ENetworkTestPreset Preset) const;
 
+	//-------------------------------------------------------------------
+	// Soak Test
+	//-------------------------------------------------------------------
+
+	/**
+	 * Start the multi-client soak test (authority worlds only)
+	 * @return false if not authority or a test is already running
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Destruction|NetworkTest")
+	bool StartSoakTest(const FNetworkSoakConfig& Config);
+
+	/** Stop the soak test; the preset in progress is reported as-is */
+	UFUNCTION(BlueprintCallable, Category = "Destruction|NetworkTest")
+	void StopSoakTest();
+
+	UFUNCTION(BlueprintPure, Category = "Destruction|NetworkTest")
+	bool IsSoakTestRunning() const { return bSoakRunning; }
+
+	/** Reports of the last (or current) soak run */
+	UFUNCTION(BlueprintPure, Category = "Destruction|NetworkTest")
+	const TArray<FNetworkSoakPresetReport>& GetSoakReports() const { return SoakReports; }
+
+	/** Order-independent hash of a component's destroyed cell set */
+	static uint32 ComputeCellStateHash(const URealtimeDestructibleMeshComponent* Component);
+
+	/** Print the cell state hash of every destructible component in this world */
+	void PrintCellStateHashes() const;
+
 protected:
 	/** Initialize default configurations for each preset */
 	void InitializePresetConfigs();
@@ -150,4 +190,50 @@ protected:
 
 	/** Configuration map for each preset */
 	TMap<ENetworkTestPreset, FNetworkTestPresetConfig> PresetConfigs;
+
+private:
+	enum class ESoakPhase : uint8
+	{
+		Firing,
+		Settling
+	};
+
+	bool TickSoakTest(float DeltaTime);
+	void BeginSoakPreset();
+	void FinishSoakPreset();
+	void FireSoakShot(int32 ClientIndex, const TArray<URealtimeDestructibleMeshComponent*>& Targets);
+	void SampleSoakBandwidth();
+	void UpdateLateJoinTracking(double Now);
+	void CompareClientCellStates(FNetworkSoakPresetReport& Report) const;
+	void PrintSoakReport() const;
+	void ExportSoakReport() const;
+	void GatherDestructibleComponents(UWorld* InWorld, TArray<URealtimeDestructibleMeshComponent*>& OutComponents) const;
+
+	FTSTicker::FDelegateHandle SoakTickHandle;
+	FNetworkSoakConfig SoakConfig;
+	TArray<ENetworkTestPreset> SoakPresetQueue;
+	TArray<FNetworkSoakPresetReport> SoakReports;
+	ENetworkTestPreset PresetBeforeSoak = ENetworkTestPreset::Off;
+
+	bool bSoakRunning = false;
+	bool bDebuggerWasEnabled = false;
+	ESoakPhase SoakPhase = ESoakPhase::Firing;
+	int32 SoakPresetIndex = 0;
+	double SoakPhaseStartTime = 0.0;
+	double SoakLastSampleTime = 0.0;
+	double SoakShotBudget = 0.0;
+	int32 SoakBandwidthSamples = 0;
+	double SoakOutBytesSum = 0.0;
+	double SoakInBytesSum = 0.0;
+	int32 SoakServerRPCBase = 0;
+	int32 SoakMulticastRPCBase = 0;
+
+	/** Per simulated client: deterministic stream and shot counter */
+	TArray<FRandomStream> SoakClientStreams;
+	TArray<FVector2D> SoakClientClusterCenters;
+	TArray<int32> SoakClientShotIndex;
+
+	/** In-process client worlds that appeared after the run started (late join), keyed to first-seen time */
+	TMap<TWeakObjectPtr<UWorld>, double> SoakLateJoinWorlds;
+	TSet<TWeakObjectPtr<UWorld>> SoakKnownClientWorlds;
 };
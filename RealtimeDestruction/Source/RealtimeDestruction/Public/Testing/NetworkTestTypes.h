@@ -94,3 +94,126 @@ struct REALTIMEDESTRUCTION_API FNetworkTestPresetConfig
 			*PresetName, PktLag, PktLagVariance, PktLoss);
 	}
 };
+
+/**
+ * Scripted impact pattern used by the soak test
+ */
+UENUM(BlueprintType)
+enum class ENetworkSoakPattern : uint8
+{
+	/** Each client walks its own lane across a fixed grid on the target face */
+	Sweep	UMETA(DisplayName = "Sweep"),
+
+	/** Uniformly random points (seeded per client, reproducible) */
+	Random	UMETA(DisplayName = "Random"),
+
+	/** Each client hammers a small area around its own random center */
+	Cluster	UMETA(DisplayName = "Cluster")
+};
+
+/**
+ * Soak Test Configuration
+ *
+ * Simulated clients are virtual request sources on the authority. Their shots are injected
+ * into the server-side handling a remote request gets once its RPC has arrived (validation,
+ * cell damage, local apply, multicast). The client->server RPC itself, its _Validate and the
+ * per-player rate limit are not exercised, since simulated clients have no connection.
+ */
+USTRUCT(BlueprintType)
+struct REALTIMEDESTRUCTION_API FNetworkSoakConfig
+{
+	GENERATED_BODY()
+
+	/** Number of simulated clients firing requests */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NetworkTest|Soak", meta = (ClampMin = 1, ClampMax = 64))
+	int32 NumClients = 4;
+
+	/** Firing duration per preset (seconds) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NetworkTest|Soak", meta = (ClampMin = 1.0))
+	float SecondsPerPreset = 30.0f;
+
+	/** Time after firing stops before cell states are compared (seconds) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NetworkTest|Soak", meta = (ClampMin = 0.0))
+	float SettleSeconds = 5.0f;
+
+	/** Requests per simulated client per second */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NetworkTest|Soak", meta = (ClampMin = 0.1))
+	float ShotsPerClientPerSecond = 4.0f;
+
+	/** Impact pattern */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NetworkTest|Soak")
+	ENetworkSoakPattern Pattern = ENetworkSoakPattern::Sweep;
+
+	/** Cylinder tool radius (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NetworkTest|Soak", meta = (ClampMin = 1.0))
+	float ToolRadius = 15.0f;
+
+	/** Presets to cycle through (empty = all presets) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NetworkTest|Soak")
+	TArray<ENetworkTestPreset> Presets;
+
+	/** Write the report to Saved/Destruction/ when finished */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NetworkTest|Soak")
+	bool bExportCSV = true;
+};
+
+/**
+ * Soak Test Result (one per preset)
+ */
+USTRUCT(BlueprintType)
+struct REALTIMEDESTRUCTION_API FNetworkSoakPresetReport
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "NetworkTest|Soak")
+	FString PresetName;
+
+	/** Requests injected on the server by simulated clients */
+	UPROPERTY(BlueprintReadOnly, Category = "NetworkTest|Soak")
+	int32 ShotsFired = 0;
+
+	/** Shots whose trace did not hit a chunk or that failed server validation (skipped) */
+	UPROPERTY(BlueprintReadOnly, Category = "NetworkTest|Soak")
+	int32 ShotsMissed = 0;
+
+	/** Average NetDriver outgoing bandwidth (bytes/s) */
+	UPROPERTY(BlueprintReadOnly, Category = "NetworkTest|Soak")
+	float AvgOutBytesPerSec = 0.0f;
+
+	/** Peak NetDriver outgoing bandwidth (bytes/s) */
+	UPROPERTY(BlueprintReadOnly, Category = "NetworkTest|Soak")
+	float PeakOutBytesPerSec = 0.0f;
+
+	/** Average NetDriver incoming bandwidth (bytes/s) */
+	UPROPERTY(BlueprintReadOnly, Category = "NetworkTest|Soak")
+	float AvgInBytesPerSec = 0.0f;
+
+	/**
+	 * Server RPCs recorded by the debugger during this preset.
+	 * Synthetic for simulated clients: one is recorded per injected shot, no RPC is actually sent.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "NetworkTest|Soak")
+	int32 ServerRPCCount = 0;
+
+	/** Multicast RPCs recorded by the debugger during this preset */
+	UPROPERTY(BlueprintReadOnly, Category = "NetworkTest|Soak")
+	int32 MulticastRPCCount = 0;
+
+	/** Remote connections on the server NetDriver at the end of the preset */
+	UPROPERTY(BlueprintReadOnly, Category = "NetworkTest|Soak")
+	int32 ConnectedClients = 0;
+
+	/** Longest time for a client that joined mid-run to match server cell state (ms, -1 = no late join) */
+	UPROPERTY(BlueprintReadOnly, Category = "NetworkTest|Soak")
+	float LateJoinSyncMs = -1.0f;
+
+	/** Client component views compared against the server (in-process clients only) */
+	UPROPERTY(BlueprintReadOnly, Category = "NetworkTest|Soak")
+	int32 ComparedViews = 0;
+
+	/** Client component views whose cell state hash differs from the server */
+	UPROPERTY(BlueprintReadOnly, Category = "NetworkTest|Soak")
+	int32 MismatchedViews = 0;
+
+	bool IsCellStateAgreed() const { return MismatchedViews == 0; }
+};
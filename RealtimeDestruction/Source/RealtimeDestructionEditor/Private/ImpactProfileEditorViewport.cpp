@@ -29,9 +29,47 @@
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Engine/SCS_Node.h"
 #include "Engine/SimpleConstructionScript.h"
+#include "HAL/PlatformTime.h"
 static const float UE_RadiusOffset = 50.0f;
 static const float UE_HeightOffset = 50.0f;
 
+namespace
+{
+	/** Edits must settle this long before the wireframes are rebuilt */
+	constexpr double WireframeDebounceSeconds = 0.05;
+
+	/** Edits must settle this long before the preview actor is rebuilt */
+	constexpr double PreviewRefreshDebounceSeconds = 0.1;
+
+	/** Edits must settle this long before the component is written and dirtied */
+	constexpr double SaveStateDebounceSeconds = 0.25;
+
+	/** Wireframes kept per cache before it is reset */
+	constexpr int32 MaxCachedWireframes = 64;
+
+	constexpr int32 WireframeSegments = 6;
+	constexpr float WireframeThickness = 2.0f;
+
+	void AddLine(TArray<FBatchedLine>& OutLines, const FVector& Start, const FVector& End, const FColor& Color)
+	{
+		OutLines.Emplace(Start, End, FLinearColor(Color), 0.0f, WireframeThickness, SDPG_Foreground);
+	}
+
+	void AddCircle(TArray<FBatchedLine>& OutLines, const FVector& Center, const FVector& AxisX, const FVector& AxisY,
+		float Radius, int32 Segments, const FColor& Color)
+	{
+		const float AngleStep = 2.0f * PI / Segments;
+		FVector Prev = Center + AxisX * Radius;
+		for (int32 i = 1; i <= Segments; ++i)
+		{
+			const float Angle = AngleStep * i;
+			const FVector Next = Center + (AxisX * FMath::Cos(Angle) + AxisY * FMath::Sin(Angle)) * Radius;
+			AddLine(OutLines, Prev, Next, Color);
+			Prev = Next;
+		}
+	}
+}
+
 void SImpactProfileEditorViewport::Construct(const FArguments& InArgs)
 { 
 	// 외부에서 전달 받은 데이터를 저장
@@ -99,6 +137,18 @@ void SImpactProfileEditorViewport::Construct(const FArguments& InArgs)
 
 SImpactProfileEditorViewport::~SImpactProfileEditorViewport()
 {
+	// 진행 중인 와이어프레임 빌드 종료 대기 (UObject를 건드리지 않으므로 결과는 버림)
+	if (WireframeTask.IsValid())
+	{
+		WireframeTask.Wait();
+	}
+
+	// 디바운스 중이던 상태 저장
+	if (bStateDirty)
+	{
+		SaveState();
+	}
+
 	if (ViewportClient.IsValid())
 	{
 		ViewportClient.Reset(); 
@@ -151,11 +201,57 @@ void SImpactProfileEditorViewport::AddReferencedObjects(FReferenceCollector& Col
 	{
 		Collector.AddReferencedObject(DecalMaterial);
 	}
+	if (PlaneMesh)
+	{
+		Collector.AddReferencedObject(PlaneMesh);
+	}
+	if (SurfaceMaterial)
+	{
+		Collector.AddReferencedObject(SurfaceMaterial);
+	}
+}
+
+void SImpactProfileEditorViewport::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SEditorViewport::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	// 백그라운드 빌드 완료 시 적용
+	if (WireframeTask.IsValid() && WireframeTask.IsCompleted())
+	{
+		FWireframeResult Result = MoveTemp(WireframeTask.GetResult());
+		WireframeTask = UE::Tasks::TTask<FWireframeResult>();
+		ApplyWireframeResult(MoveTemp(Result));
+	}
+
+	// 슬라이더 드래그 중에는 마지막 결과를 유지하고, 입력이 멈추면 다시 빌드
+	const double SinceLastEdit = FPlatformTime::Seconds() - LastEditTime;
+	if (bWireframeDirty && !WireframeTask.IsValid() && SinceLastEdit >= WireframeDebounceSeconds)
+	{
+		StartWireframeUpdate();
+	}
+
+	if (bStateDirty && SinceLastEdit >= SaveStateDebounceSeconds)
+	{
+		SaveState();
+	}
+
+	// 프리뷰 액터 재생성은 무거우므로 디테일 패널 편집이 멈춘 뒤 한 번만
+	if (bPreviewDirty && SinceLastEdit >= PreviewRefreshDebounceSeconds)
+	{
+		RefreshPreview();
+	}
+}
 
+void SImpactProfileEditorViewport::RequestRefreshPreview()
+{
+	bPreviewDirty = true;
+	LastEditTime = FPlatformTime::Seconds();
 }
 
 void SImpactProfileEditorViewport::RefreshPreview()
 {
+	bPreviewDirty = false;
+
 	if (!PreviewScene.IsValid())
 	{
 		return;
@@ -178,13 +274,17 @@ void SImpactProfileEditorViewport::RefreshPreview()
 		DecalWireframe = nullptr; 
 	} 
 
-	// 기본 메시 로드
-	UStaticMesh* SphereMesh = LoadObject<UStaticMesh>(nullptr,
-		TEXT("/Engine/BasicShapes/Sphere.Sphere"));
-	UStaticMesh* CylinderMesh = LoadObject<UStaticMesh>(nullptr,
-		TEXT("/Engine/BasicShapes/Cylinder.Cylinder"));
-	UStaticMesh* PlaneMesh = LoadObject<UStaticMesh>(nullptr,
-		TEXT("/Engine/BasicShapes/Plane.Plane"));
+	// 기본 에셋 로드 (최초 1회)
+	if (!PlaneMesh)
+	{
+		PlaneMesh = LoadObject<UStaticMesh>(nullptr,
+			TEXT("/Engine/BasicShapes/Plane.Plane"));
+	}
+	if (!SurfaceMaterial)
+	{
+		SurfaceMaterial = LoadObject<UMaterial>(nullptr,
+			TEXT("/Engine/BasicShapes/BasicShapeMaterial.BasicShapeMaterial"));
+	}
 
 
 	// 프리뷰 액터 생성
@@ -292,11 +392,9 @@ void SImpactProfileEditorViewport::RefreshPreview()
 	DecalTargetSurface->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 
 	// 기본 머티리얼 (밝은 회색)
-	UMaterial* DefaultMat = LoadObject<UMaterial>(nullptr,
-		TEXT("/Engine/BasicShapes/BasicShapeMaterial.BasicShapeMaterial"));
-	if (DefaultMat)
+	if (SurfaceMaterial)
 	{
-		DecalTargetSurface->SetMaterial(0, DefaultMat);
+		DecalTargetSurface->SetMaterial(0, SurfaceMaterial);
 	}
 	DecalTargetSurface->RegisterComponent();
 
@@ -319,8 +417,11 @@ void SImpactProfileEditorViewport::RefreshPreview()
 	DecalWireframe->RegisterComponent();
 
 	// Transform / Scale 적용 
-	UpdateToolShapeWireframe();
 	UpdateDecalMesh();
+
+	// 새 라인 배치에 마지막 결과를 먼저 그리고, 최신 파라미터로 다시 빌드
+	RedrawWireframes();
+	UpdateToolShapeWireframe();
  
 	// 씬 갱신
 	if (ViewportClient.IsValid())
@@ -333,21 +434,21 @@ void SImpactProfileEditorViewport::SetDecalTransform(const FTransform& InTransfo
 {
 	DecalTransform = InTransform;
 	UpdateDecalMesh();
-	SaveState();
+	RequestSaveState();
 }
 
 void SImpactProfileEditorViewport::SetToolShapeLocation(const FVector& InLocation)
 {
 	ToolShapeTransform.SetLocation(InLocation);
 	UpdateToolShapeWireframe(); 
-	SaveState();
+	RequestSaveState();
 }
 
 void SImpactProfileEditorViewport::SetToolShapeRotation(const FRotator& InRotation)
 {
 	ToolShapeTransform.SetRotation(InRotation.Quaternion()); 
 	UpdateToolShapeWireframe();  
-	SaveState();
+	RequestSaveState();
 }
 
 void SImpactProfileEditorViewport::SetPreviewMesh(UStaticMesh* InPreviewMesh)
@@ -371,7 +472,7 @@ void SImpactProfileEditorViewport::SetPreviewMesh(UStaticMesh* InPreviewMesh)
 void SImpactProfileEditorViewport::SetPreviewToolShape(EDestructionToolShape NewShape)
 {
 	PreviewToolShape = NewShape;
-	RefreshPreview();
+	UpdateToolShapeWireframe();
 	SaveState();
 }
 
@@ -379,21 +480,21 @@ void SImpactProfileEditorViewport::SetPreviewSphere(float InRadius)
 {
 	PreviewSphereRadius = InRadius;
 	UpdateToolShapeWireframe(); 
-	SaveState();
+	RequestSaveState();
 }
 
 void SImpactProfileEditorViewport::SetPreviewCylinderRadius(float InRadius)
 {
 	PreviewCylinderRadius = InRadius;
 	UpdateToolShapeWireframe(); 
-	SaveState();
+	RequestSaveState();
 }
 
 void SImpactProfileEditorViewport::SetPreviewCylinderHeight(float InHeight)
 {
 	PreviewCylinderHeight = InHeight;
 	UpdateToolShapeWireframe(); 
-	SaveState();
+	RequestSaveState();
 }
 
 void SImpactProfileEditorViewport::SetPreviewMeshLocation(const FVector& InLocation)
@@ -502,66 +603,7 @@ void SImpactProfileEditorViewport::UpdateDecalMesh()
 
 void SImpactProfileEditorViewport::UpdateDecalWireframe()
 {
-	if (!DecalWireframe)
-	{
-		return;
-	}
-
-	DecalWireframe->Flush();
-
-	const FColor WireColor = FColor::Green;
-	const float Thickness= 2.0f;
-	const float LifeTime = 0.0f;
-	const uint8 DepthPriority = SDPG_Foreground;  // 항상 앞에 그리기
-
-	const FVector HalfSize = DecalPreviewComponent->DecalSize;
-
-	TArray<FVector> LocalCorners;
-	LocalCorners.SetNum(8);
-	
-	LocalCorners[0] = FVector(-HalfSize.X, -HalfSize.Y,  HalfSize.Z);  // 전면 좌상
-	LocalCorners[1] = FVector(-HalfSize.X,  HalfSize.Y,  HalfSize.Z);  // 전면 우상
-	LocalCorners[2] = FVector(-HalfSize.X, -HalfSize.Y, -HalfSize.Z);  // 전면 좌하
-	LocalCorners[3] = FVector(-HalfSize.X,  HalfSize.Y, -HalfSize.Z);  // 전면 우하
-	LocalCorners[4] = FVector( HalfSize.X, -HalfSize.Y,  HalfSize.Z);  // 후면 좌상
-	LocalCorners[5] = FVector( HalfSize.X,  HalfSize.Y,  HalfSize.Z);  // 후면 우상
-	LocalCorners[6] = FVector( HalfSize.X, -HalfSize.Y, -HalfSize.Z);  // 후면 좌하
-	LocalCorners[7] = FVector( HalfSize.X,  HalfSize.Y, -HalfSize.Z);  // 후면 우하
-
-	FRotator Rotation = DecalPreviewComponent->GetRelativeRotation();
-	FVector Location = DecalPreviewComponent->GetRelativeLocation();
-	
-	FTransform BoxTransform(Rotation, Location, FVector::OneVector);
-
-	// 월드 좌표로 변환
-	TArray<FVector> WorldCorners;
-	WorldCorners.SetNum(8);
-	for (int32 i = 0; i < 8; i++)
-	{
-		WorldCorners[i] = BoxTransform.TransformPosition(LocalCorners[i]);
-	}
-
-	// 12개의 Edge 그리기
-
-	// 전면 (Front face)
-	DecalWireframe->DrawLine(WorldCorners[0], WorldCorners[1], WireColor, DepthPriority, Thickness, LifeTime);
-	DecalWireframe->DrawLine(WorldCorners[1], WorldCorners[3], WireColor, DepthPriority, Thickness, LifeTime);
-	DecalWireframe->DrawLine(WorldCorners[3], WorldCorners[2], WireColor, DepthPriority, Thickness, LifeTime);
-	DecalWireframe->DrawLine(WorldCorners[2], WorldCorners[0], WireColor, DepthPriority, Thickness, LifeTime);
-
-	// 후면 (Back face) 
-	DecalWireframe->DrawLine(WorldCorners[4], WorldCorners[5], WireColor, DepthPriority, Thickness, LifeTime);
-	DecalWireframe->DrawLine(WorldCorners[5], WorldCorners[7], WireColor, DepthPriority, Thickness, LifeTime);
-	DecalWireframe->DrawLine(WorldCorners[7], WorldCorners[6], WireColor, DepthPriority, Thickness, LifeTime);
-	DecalWireframe->DrawLine(WorldCorners[6], WorldCorners[4], WireColor, DepthPriority, Thickness, LifeTime);
-
-	// 연결 Edge  
-	DecalWireframe->DrawLine(WorldCorners[0], WorldCorners[4], WireColor, DepthPriority, Thickness, LifeTime);
-	DecalWireframe->DrawLine(WorldCorners[1], WorldCorners[5], WireColor, DepthPriority, Thickness, LifeTime);
-	DecalWireframe->DrawLine(WorldCorners[2], WorldCorners[6], WireColor, DepthPriority, Thickness, LifeTime);
-	DecalWireframe->DrawLine(WorldCorners[3], WorldCorners[7], WireColor, DepthPriority, Thickness, LifeTime);
-
-	DecalWireframe->MarkRenderStateDirty(); 
+	RequestWireframeUpdate();
 }
 
 void SImpactProfileEditorViewport::SetDecalMaterial(UMaterialInterface* InMaterial)
@@ -586,7 +628,7 @@ void SImpactProfileEditorViewport::SetDecalSize(const FVector& InSize)
 {
 	DecalSize = InSize;
 	UpdateDecalMesh();
-	SaveState();
+	RequestSaveState();
 }
 
 
@@ -618,60 +660,238 @@ TSharedRef<FEditorViewportClient> SImpactProfileEditorViewport::MakeEditorViewpo
 
 void SImpactProfileEditorViewport::UpdateToolShapeWireframe()
 {
-	if (!ToolShapeWireframe)
-	{
-		return;
-	}
+	RequestWireframeUpdate();
+}
 
-	ToolShapeWireframe->Flush();
+SImpactProfileEditorViewport::FToolShapeKey SImpactProfileEditorViewport::FWireframeParams::GetToolShapeKey() const
+{
+	FToolShapeKey Key;
+	Key.ToolShape = ToolShape;
+	Key.Location = ToolShapeLocation;
+	if (ToolShape == EDestructionToolShape::Sphere)
+	{
+		// 구는 회전/원기둥 파라미터와 무관
+		Key.SphereRadius = SphereRadius;
+		return Key;
+	}
+	Key.Rotation = ToolShapeRotation;
+	Key.CylinderRadius = CylinderRadius;
+	Key.CylinderHeight = CylinderHeight;
+	return Key;
+}
+
+SImpactProfileEditorViewport::FDecalKey SImpactProfileEditorViewport::FWireframeParams::GetDecalKey() const
+{
+	FDecalKey Key;
+	Key.Location = DecalLocation;
+	Key.Rotation = DecalRotation;
+	Key.HalfSize = DecalHalfSize;
+	return Key;
+}
 
+SImpactProfileEditorViewport::FWireframeParams SImpactProfileEditorViewport::MakeWireframeParams() const
+{
+	FWireframeParams Params;
+	Params.ToolShape = PreviewToolShape;
+	Params.ToolShapeLocation = ToolShapeTransform.GetLocation();
+	Params.ToolShapeRotation = ToolShapeTransform.GetRotation().Rotator();
+	Params.SphereRadius = PreviewSphereRadius;
+	Params.CylinderRadius = PreviewCylinderRadius;
+	Params.CylinderHeight = PreviewCylinderHeight;
+
+	// UpdateDecalMesh와 같은 기준 (표면을 향한 기본 회전 + 편집 값)
+	Params.DecalLocation = DecalTransform.GetLocation();
+	Params.DecalRotation = FRotator(0.0f, 180.0f, 0.0f) + DecalTransform.GetRotation().Rotator();
+	Params.DecalHalfSize = DecalSize * DecalTransform.GetScale3D();
+	return Params;
+}
+
+void SImpactProfileEditorViewport::BuildToolShapeLines(const FWireframeParams& Params, TArray<FBatchedLine>& OutLines)
+{
 	const FColor WireColor = FColor::Yellow;
-	const float Thickness = 2.0f;
-	const float LifeTime = 0.0f;
-	const uint8 DepthPriority = SDPG_Foreground; 
-	const int Segments = 6;
-	FVector Location = ToolShapeTransform.GetLocation();
-	FRotator Rotation = ToolShapeTransform.GetRotation().Rotator();
-	float HalfHeight = PreviewCylinderHeight * 0.5f;
-	switch (PreviewToolShape)
-	{
-		case EDestructionToolShape::Cylinder: 
-		{ 
-			FVector UpDir = Rotation.RotateVector(FVector::UpVector);
-			FVector StartPoint = Location - (UpDir * HalfHeight); // 바닥 중심
-			FVector EndPoint = Location + (UpDir * HalfHeight); // 천장 중심
-			ToolShapeWireframe->DrawCylinder(StartPoint, EndPoint, PreviewCylinderRadius, Segments, WireColor, LifeTime, DepthPriority, Thickness);
-		} 
-		break;
+	const FVector Location = Params.ToolShapeLocation;
 
-		case EDestructionToolShape::Sphere:
+	if (Params.ToolShape == EDestructionToolShape::Sphere)
+	{
+		// 위도 링 + 경도 링
+		const float Radius = Params.SphereRadius;
+		for (int32 i = 1; i < WireframeSegments; ++i)
 		{
-			ToolShapeWireframe->DrawSphere(Location, PreviewSphereRadius, Segments, WireColor, LifeTime, DepthPriority, Thickness);  
+			const float Theta = PI * i / WireframeSegments;
+			const FVector RingCenter = Location + FVector::UpVector * (Radius * FMath::Cos(Theta));
+			AddCircle(OutLines, RingCenter, FVector::ForwardVector, FVector::RightVector, Radius * FMath::Sin(Theta), WireframeSegments * 2, WireColor);
 		}
-		
-		break; 
-
-		default:
-		{	
-			FVector UpDir = Rotation.RotateVector(FVector::UpVector);
-			FVector StartPoint = Location - (UpDir * HalfHeight); // 바닥 중심
-			FVector EndPoint = Location + (UpDir * HalfHeight); // 천장 중심
-			ToolShapeWireframe->DrawCylinder(StartPoint, EndPoint, PreviewCylinderRadius, Segments, WireColor, LifeTime, DepthPriority, Thickness);
-			
+		for (int32 i = 0; i < WireframeSegments; ++i)
+		{
+			const float Phi = PI * i / WireframeSegments;
+			const FVector Axis(FMath::Cos(Phi), FMath::Sin(Phi), 0.0f);
+			AddCircle(OutLines, Location, Axis, FVector::UpVector, Radius, WireframeSegments * 2, WireColor);
 		}
-			break;	
+		return;
+	}
+
+	// Cylinder (기본)
+	const FQuat Rotation = Params.ToolShapeRotation.Quaternion();
+	const FVector UpDir = Rotation.GetUpVector();
+	const FVector AxisX = Rotation.GetForwardVector();
+	const FVector AxisY = Rotation.GetRightVector();
+	const float HalfHeight = Params.CylinderHeight * 0.5f;
+	const FVector StartPoint = Location - (UpDir * HalfHeight); // 바닥 중심
+	const FVector EndPoint = Location + (UpDir * HalfHeight);   // 천장 중심
+
+	AddCircle(OutLines, StartPoint, AxisX, AxisY, Params.CylinderRadius, WireframeSegments, WireColor);
+	AddCircle(OutLines, EndPoint, AxisX, AxisY, Params.CylinderRadius, WireframeSegments, WireColor);
+
+	const float AngleStep = 2.0f * PI / WireframeSegments;
+	for (int32 i = 0; i < WireframeSegments; ++i)
+	{
+		const FVector Offset = (AxisX * FMath::Cos(AngleStep * i) + AxisY * FMath::Sin(AngleStep * i)) * Params.CylinderRadius;
+		AddLine(OutLines, StartPoint + Offset, EndPoint + Offset, WireColor);
 	}
+}
 
-	ToolShapeWireframe->MarkRenderStateDirty();
+void SImpactProfileEditorViewport::BuildDecalLines(const FWireframeParams& Params, TArray<FBatchedLine>& OutLines)
+{
+	const FColor WireColor = FColor::Green;
+	const FVector HalfSize = Params.DecalHalfSize;
+	const FTransform BoxTransform(Params.DecalRotation, Params.DecalLocation, FVector::OneVector);
+
+	FVector Corners[8];
+	Corners[0] = BoxTransform.TransformPosition(FVector(-HalfSize.X, -HalfSize.Y,  HalfSize.Z));  // 전면 좌상
+	Corners[1] = BoxTransform.TransformPosition(FVector(-HalfSize.X,  HalfSize.Y,  HalfSize.Z));  // 전면 우상
+	Corners[2] = BoxTransform.TransformPosition(FVector(-HalfSize.X, -HalfSize.Y, -HalfSize.Z));  // 전면 좌하
+	Corners[3] = BoxTransform.TransformPosition(FVector(-HalfSize.X,  HalfSize.Y, -HalfSize.Z));  // 전면 우하
+	Corners[4] = BoxTransform.TransformPosition(FVector( HalfSize.X, -HalfSize.Y,  HalfSize.Z));  // 후면 좌상
+	Corners[5] = BoxTransform.TransformPosition(FVector( HalfSize.X,  HalfSize.Y,  HalfSize.Z));  // 후면 우상
+	Corners[6] = BoxTransform.TransformPosition(FVector( HalfSize.X, -HalfSize.Y, -HalfSize.Z));  // 후면 좌하
+	Corners[7] = BoxTransform.TransformPosition(FVector( HalfSize.X,  HalfSize.Y, -HalfSize.Z));  // 후면 우하
+
+	// 12개의 Edge (전면, 후면, 연결)
+	static const int32 Edges[12][2] = {
+		{0, 1}, {1, 3}, {3, 2}, {2, 0},
+		{4, 5}, {5, 7}, {7, 6}, {6, 4},
+		{0, 4}, {1, 5}, {2, 6}, {3, 7}
+	};
+	for (const int32 (&Edge)[2] : Edges)
+	{
+		AddLine(OutLines, Corners[Edge[0]], Corners[Edge[1]], WireColor);
+	}
+}
+
+void SImpactProfileEditorViewport::RequestWireframeUpdate()
+{
+	bWireframeDirty = true;
+	LastEditTime = FPlatformTime::Seconds();
+}
+
+void SImpactProfileEditorViewport::StartWireframeUpdate()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(ImpactProfileViewport_StartWireframeUpdate);
+
+	bWireframeDirty = false;
+
+	const FWireframeParams Params = MakeWireframeParams();
+	const FToolShapeKey ToolShapeKey = Params.GetToolShapeKey();
+	const FDecalKey DecalKey = Params.GetDecalKey();
+
+	const TArray<FBatchedLine>* CachedToolShape = ToolShapeLineCache.Find(ToolShapeKey);
+	const TArray<FBatchedLine>* CachedDecal = DecalLineCache.Find(DecalKey);
+
+	// 둘 다 캐시에 있으면 바로 적용
+	if (CachedToolShape && CachedDecal)
+	{
+		FWireframeResult Result;
+		Result.ToolShapeKey = ToolShapeKey;
+		Result.DecalKey = DecalKey;
+		Result.ToolShapeLines = *CachedToolShape;
+		Result.DecalLines = *CachedDecal;
+		ApplyWireframeResult(MoveTemp(Result));
+		return;
+	}
+
+	// 캐시에 없는 쪽만 백그라운드에서 빌드
+	FWireframeResult Seed;
+	Seed.ToolShapeKey = ToolShapeKey;
+	Seed.DecalKey = DecalKey;
+	if (CachedToolShape)
+	{
+		Seed.ToolShapeLines = *CachedToolShape;
+	}
+	if (CachedDecal)
+	{
+		Seed.DecalLines = *CachedDecal;
+	}
+
+	const bool bBuildToolShape = (CachedToolShape == nullptr);
+	const bool bBuildDecal = (CachedDecal == nullptr);
+	WireframeTask = UE::Tasks::Launch(UE_SOURCE_LOCATION,
+		[Params, Seed = MoveTemp(Seed), bBuildToolShape, bBuildDecal]() mutable
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(ImpactProfileViewport_BuildWireframes);
+			if (bBuildToolShape)
+			{
+				BuildToolShapeLines(Params, Seed.ToolShapeLines);
+			}
+			if (bBuildDecal)
+			{
+				BuildDecalLines(Params, Seed.DecalLines);
+			}
+			return MoveTemp(Seed);
+		},
+		UE::Tasks::ETaskPriority::BackgroundNormal);
+}
+
+void SImpactProfileEditorViewport::ApplyWireframeResult(FWireframeResult&& Result)
+{
+	if (ToolShapeLineCache.Num() >= MaxCachedWireframes)
+	{
+		ToolShapeLineCache.Reset();
+	}
+	if (DecalLineCache.Num() >= MaxCachedWireframes)
+	{
+		DecalLineCache.Reset();
+	}
+	ToolShapeLineCache.FindOrAdd(Result.ToolShapeKey) = Result.ToolShapeLines;
+	DecalLineCache.FindOrAdd(Result.DecalKey) = Result.DecalLines;
+
+	AppliedToolShapeLines = MoveTemp(Result.ToolShapeLines);
+	AppliedDecalLines = MoveTemp(Result.DecalLines);
+
+	RedrawWireframes();
+}
+
+void SImpactProfileEditorViewport::RedrawWireframes()
+{
+	if (ToolShapeWireframe)
+	{
+		ToolShapeWireframe->Flush();
+		ToolShapeWireframe->DrawLines(AppliedToolShapeLines);
+		ToolShapeWireframe->MarkRenderStateDirty();
+	}
+
+	if (DecalWireframe)
+	{
+		DecalWireframe->Flush();
+		DecalWireframe->DrawLines(AppliedDecalLines);
+		DecalWireframe->MarkRenderStateDirty();
+	}
 
 	if (ViewportClient.IsValid())
 	{
 		ViewportClient->Invalidate();
 	}
 }
-  
+
+void SImpactProfileEditorViewport::RequestSaveState()
+{
+	bStateDirty = true;
+	LastEditTime = FPlatformTime::Seconds();
+}
+
 void SImpactProfileEditorViewport::SaveState()
 {
+	bStateDirty = false;
+
 	UDestructionProjectileComponent* Comp = TargetComponent.Get();
 	if (!Comp)
 	{
@@ -618,9 +618,10 @@ TSharedRef<SWidget> SImpactProfileEditorWindow::CreateDecalSection()
 void SImpactProfileEditorWindow::NotifyPostChange(const FPropertyChangedEvent& PropertyChangedEvent,
                                               FProperty* PropertyThatChanged)
 {
+	// 슬라이더 드래그 중 매 틱 호출되므로 바로 재생성하지 않고 디바운스
 	if (Viewport.IsValid())
 	{
-		Viewport->RefreshPreview();
+		Viewport->RequestRefreshPreview();
 	}
 }
 
@@ -13,6 +13,8 @@
 #include "SEditorViewport.h"
 #include "SCommonEditorViewportToolbarBase.h"
 #include "AdvancedPreviewScene.h"
+#include "Components/LineBatchComponent.h"
+#include "Tasks/Task.h"
 #include "RealtimeDestruction/Public/Components/DestructionTypes.h"
 
 class UDestructionProjectileComponent;
@@ -32,6 +34,9 @@ public:
 	void Construct(const FArguments& InArgs);
 	virtual ~SImpactProfileEditorViewport();
 
+	// SWidget Interface
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+
 	// FGCObject Interface
 	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
 	virtual FString GetReferencerName() const override { return TEXT("SImpactProfileEditorViewport"); };
@@ -42,6 +47,9 @@ public:
 	/** Refresh preview */
 	void RefreshPreview();
 
+	/** Rebuild the preview once edits settle (property change notifications arrive per slider tick) */
+	void RequestRefreshPreview();
+
 	/** Set Decal Transform */
 	void SetDecalTransform(const FTransform& InTransform);
 	FTransform GetDecalTransform() const { return DecalTransform; }
@@ -73,6 +81,8 @@ public:
 	
 	/** Update preview mesh only (without full Refresh) */ 
 	void UpdateDecalMesh();   
+
+	/** Request a decal wireframe rebuild (built in the background, applied after the debounce) */
 	void UpdateDecalWireframe();
 	
 	 
@@ -136,6 +146,121 @@ private:
 	/** Decal Material */
 	TObjectPtr<UMaterialInterface> DecalMaterial;
 
+	/** Basic assets for the preview scene (loaded once) */
+	TObjectPtr<UStaticMesh> PlaneMesh = nullptr;
+	TObjectPtr<UMaterialInterface> SurfaceMaterial = nullptr;
+
+	/** Tool shape wireframe cache key; parameters the shape ignores are left at zero */
+	struct FToolShapeKey
+	{
+		EDestructionToolShape ToolShape = EDestructionToolShape::Cylinder;
+		FVector Location = FVector::ZeroVector;
+		FRotator Rotation = FRotator::ZeroRotator;
+		float SphereRadius = 0.0f;
+		float CylinderRadius = 0.0f;
+		float CylinderHeight = 0.0f;
+
+		bool operator==(const FToolShapeKey& Other) const
+		{
+			return ToolShape == Other.ToolShape && Location == Other.Location && Rotation == Other.Rotation
+				&& SphereRadius == Other.SphereRadius && CylinderRadius == Other.CylinderRadius
+				&& CylinderHeight == Other.CylinderHeight;
+		}
+
+		friend uint32 GetTypeHash(const FToolShapeKey& Key)
+		{
+			uint32 Hash = HashCombine(::GetTypeHash(static_cast<uint8>(Key.ToolShape)), GetTypeHash(Key.Location));
+			Hash = HashCombine(Hash, GetTypeHash(FVector(Key.Rotation.Pitch, Key.Rotation.Yaw, Key.Rotation.Roll)));
+			Hash = HashCombine(Hash, ::GetTypeHash(Key.SphereRadius));
+			Hash = HashCombine(Hash, ::GetTypeHash(Key.CylinderRadius));
+			return HashCombine(Hash, ::GetTypeHash(Key.CylinderHeight));
+		}
+	};
+
+	/** Decal wireframe cache key */
+	struct FDecalKey
+	{
+		FVector Location = FVector::ZeroVector;
+		FRotator Rotation = FRotator::ZeroRotator;
+		FVector HalfSize = FVector::ZeroVector;
+
+		bool operator==(const FDecalKey& Other) const
+		{
+			return Location == Other.Location && Rotation == Other.Rotation && HalfSize == Other.HalfSize;
+		}
+
+		friend uint32 GetTypeHash(const FDecalKey& Key)
+		{
+			uint32 Hash = GetTypeHash(Key.Location);
+			Hash = HashCombine(Hash, GetTypeHash(FVector(Key.Rotation.Pitch, Key.Rotation.Yaw, Key.Rotation.Roll)));
+			return HashCombine(Hash, GetTypeHash(Key.HalfSize));
+		}
+	};
+
+	/** Snapshot of the parameters a wireframe is built from */
+	struct FWireframeParams
+	{
+		EDestructionToolShape ToolShape = EDestructionToolShape::Cylinder;
+		FVector ToolShapeLocation = FVector::ZeroVector;
+		FRotator ToolShapeRotation = FRotator::ZeroRotator;
+		float SphereRadius = 0.0f;
+		float CylinderRadius = 0.0f;
+		float CylinderHeight = 0.0f;
+
+		FVector DecalLocation = FVector::ZeroVector;
+		FRotator DecalRotation = FRotator::ZeroRotator;
+		FVector DecalHalfSize = FVector::ZeroVector;
+
+		/** Cache keys (only the parameters the wireframe depends on) */
+		FToolShapeKey GetToolShapeKey() const;
+		FDecalKey GetDecalKey() const;
+	};
+
+	/** Output of a background wireframe build */
+	struct FWireframeResult
+	{
+		FToolShapeKey ToolShapeKey;
+		FDecalKey DecalKey;
+		TArray<FBatchedLine> ToolShapeLines;
+		TArray<FBatchedLine> DecalLines;
+	};
+
+	/** Capture the current editor state */
+	FWireframeParams MakeWireframeParams() const;
+
+	/** Build wireframe lines (thread safe, touches no UObject) */
+	static void BuildToolShapeLines(const FWireframeParams& Params, TArray<FBatchedLine>& OutLines);
+	static void BuildDecalLines(const FWireframeParams& Params, TArray<FBatchedLine>& OutLines);
+
+	/** Mark the wireframes stale; the rebuild starts once edits settle */
+	void RequestWireframeUpdate();
+
+	/** Serve the request from the cache or start a background build */
+	void StartWireframeUpdate();
+
+	/** Cache a finished build and push it to the line batchers */
+	void ApplyWireframeResult(FWireframeResult&& Result);
+
+	/** Push the last applied lines to the line batchers */
+	void RedrawWireframes();
+
+	/** Background wireframe build in flight */
+	UE::Tasks::TTask<FWireframeResult> WireframeTask;
+
+	/** Built wireframes by parameter key */
+	TMap<FToolShapeKey, TArray<FBatchedLine>> ToolShapeLineCache;
+	TMap<FDecalKey, TArray<FBatchedLine>> DecalLineCache;
+
+	/** Lines on screen (kept until a newer build is applied) */
+	TArray<FBatchedLine> AppliedToolShapeLines;
+	TArray<FBatchedLine> AppliedDecalLines;
+
+	/** Pending edits */
+	bool bWireframeDirty = false;
+	bool bStateDirty = false;
+	bool bPreviewDirty = false;
+	double LastEditTime = 0.0;
+
 	/** Visibility flags */
 	bool bShowDecal = true;
 	bool bShowToolShape = true;
@@ -143,6 +268,9 @@ private:
 
 	/** Function for saving state */
 	void SaveState();
+
+	/** Save state once edits settle (slider drags dirty the package only once) */
+	void RequestSaveState();
 };
 
 